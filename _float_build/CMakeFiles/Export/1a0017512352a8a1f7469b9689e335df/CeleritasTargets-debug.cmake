@@ -0,0 +1,30 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "Celeritas::celeritas" for configuration "Debug"
+set_property(TARGET Celeritas::celeritas APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Celeritas::celeritas PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libceleritas.so"
+  IMPORTED_SONAME_DEBUG "libceleritas.so"
+  )
+
+list(APPEND _cmake_import_check_targets Celeritas::celeritas )
+list(APPEND _cmake_import_check_files_for_Celeritas::celeritas "${_IMPORT_PREFIX}/lib/libceleritas.so" )
+
+# Import target "Celeritas::celeritas_io" for configuration "Debug"
+set_property(TARGET Celeritas::celeritas_io APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Celeritas::celeritas_io PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_DEBUG "Celeritas::celeritas"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libceleritas_io.so"
+  IMPORTED_SONAME_DEBUG "libceleritas_io.so"
+  )
+
+list(APPEND _cmake_import_check_targets Celeritas::celeritas_io )
+list(APPEND _cmake_import_check_files_for_Celeritas::celeritas_io "${_IMPORT_PREFIX}/lib/libceleritas_io.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,256 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfig.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfigVersion.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/app/CMakeLists.txt"
+  "/root/repo/cmake/CeleritasAddTest.cmake"
+  "/root/repo/cmake/CeleritasConfig.cmake.in"
+  "/root/repo/cmake/CeleritasGen.cmake"
+  "/root/repo/cmake/CeleritasLibrary.cmake"
+  "/root/repo/cmake/CeleritasMakeRulesOverride.cmake"
+  "/root/repo/cmake/CeleritasUtils.cmake"
+  "/root/repo/cmake/CgvFindVersion.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/celeritas_cmake_strings.h.in"
+  "/root/repo/src/celeritas_config.h.in"
+  "/root/repo/src/celeritas_version.cc.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/testdetail/TestConfig.cc.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "lib/cmake/CeleritasConfig.cmake"
+  "lib/cmake/CeleritasConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/celeritas_config.h"
+  "src/celeritas_cmake_strings.h"
+  "src/celeritas_version.cc"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/TestConfig.cc"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "app/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/CMakeFiles/celeritas.dir/DependInfo.cmake"
+  "src/CMakeFiles/celeritas_io.dir/DependInfo.cmake"
+  "test/CMakeFiles/CelerTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/detail_TestMacros.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Array.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Span.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_LabelIdMultiMap.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Range.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Collection.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Copier.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_DeviceAllocation.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_DeviceVector.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_OpaqueId.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_StackAllocator.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Join.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Logger.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_OutputManager.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Repr.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_StringEnumMap.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_StringUtils.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Algorithms.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_ArrayUtils.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_HashUtils.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_NumericLimits.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Quantity.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_SoftEqual.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_VectorUtils.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Environment.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_TypeDemangler.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_ScopedSignalHandler.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_ScopedStreamRedirect.dir/DependInfo.cmake"
+  "test/CMakeFiles/corecel_Stopwatch.dir/DependInfo.cmake"
+  "test/CMakeFiles/CeleritasOrangeTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_BoundingBox.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_QuadraticSolver.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_CylCentered.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_GeneralQuadric.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_PlaneAligned.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_Sphere.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SphereCentered.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SurfaceAction.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SurfaceDeduplicator.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_LogicEvaluator.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_LogicStack.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SurfaceFunctors.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SenseCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_VolumeView.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_SimpleUnitTracker.dir/DependInfo.cmake"
+  "test/CMakeFiles/orange_Orange.dir/DependInfo.cmake"
+  "test/CMakeFiles/CeleritasTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_Constants.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_BetheHeitler.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_CombinedBrem.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_EPlusGG.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_EmStandardInteractAction.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_Fluctuation.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_KleinNishina.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_LivermorePE.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_MollerBhabha.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_MuBremsstrahlung.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_NativeEmTableBuilder.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_Rayleigh.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_RelativisticBrem.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_SeltzerBerger.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_TsaiUrbanDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_ImportedProcesses.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_em_UrbanMsc.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_ext_EventReader.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_ext_GeantImporter.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_ext_MpiCommunicator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_ext_RootImporter.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_Fields.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_Steppers.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_FieldDriver.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_FieldRegion.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_FieldPropagator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_LinearPropagator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_field_MagFieldEquation.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_geo_Geometry.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_geo_GeoMaterial.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_ActionRegistry.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_ActionSequence.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_AlongStep.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_Benchmark.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_BatchNavigation.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_EnergyMonitor.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_EventTally.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_Stepper.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_TrackSlotPolicy.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_global_VolumeProfiler.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_GenericXsCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_GridIdFinder.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_Interpolator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_InverseRangeCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_NonuniformGrid.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_PolyEvaluator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_RangeCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_TwodGridCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_UniformGrid.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_ValueGridBuilder.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_ValueGridInserter.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_grid_XsCalculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_io_SeltzerBergerReader.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_mat_ElementSelector.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_mat_Material.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_CutoffParams.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_MortonSort.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_Particle.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_Physics.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_PhysicsStepUtils.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_PrimaryBatchGenerator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_phys_PrimaryGenerator.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_RngEngine.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_Selector.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_XorwowRngEngine.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_BernoulliDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_ExponentialDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_GammaDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_IsotropicDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_NormalDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_PoissonDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_RadialDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_ReciprocalDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_UniformBoxDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_random_UniformRealDistribution.dir/DependInfo.cmake"
+  "test/CMakeFiles/celeritas_track_TrackInit.dir/DependInfo.cmake"
+  "test/CMakeFiles/update-four-slabs.dir/DependInfo.cmake"
+  "test/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "app/CMakeFiles/celer-export-geant.dir/DependInfo.cmake"
+  "app/CMakeFiles/celer-dump-data.dir/DependInfo.cmake"
+  "app/CMakeFiles/celer-orange-binary.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celer-dump-data.dir/celer-dump-data.cc.o"
+  "CMakeFiles/celer-dump-data.dir/celer-dump-data.cc.o.d"
+  "celer-dump-data"
+  "celer-dump-data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celer-dump-data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/app/celer-export-geant.cc" "app/CMakeFiles/celer-export-geant.dir/celer-export-geant.cc.o" "gcc" "app/CMakeFiles/celer-export-geant.dir/celer-export-geant.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_float_build/src/CMakeFiles/celeritas_io.dir/DependInfo.cmake"
+  "/root/repo/_float_build/src/CMakeFiles/celeritas.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
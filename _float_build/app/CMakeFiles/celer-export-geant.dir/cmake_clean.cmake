@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celer-export-geant.dir/celer-export-geant.cc.o"
+  "CMakeFiles/celer-export-geant.dir/celer-export-geant.cc.o.d"
+  "celer-export-geant"
+  "celer-export-geant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celer-export-geant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
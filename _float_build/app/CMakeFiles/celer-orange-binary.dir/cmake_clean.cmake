@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celer-orange-binary.dir/celer-orange-binary.cc.o"
+  "CMakeFiles/celer-orange-binary.dir/celer-orange-binary.cc.o.d"
+  "celer-orange-binary"
+  "celer-orange-binary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celer-orange-binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
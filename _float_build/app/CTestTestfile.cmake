@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/app
+# Build directory: /root/repo/_float_build/app
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[app/celer-orange-binary]=] "/root/repo/_float_build/app/celer-orange-binary" "/root/repo/app/data/simple-cms.org.json" "simple-cms.org.bin")
+set_tests_properties([=[app/celer-orange-binary]=] PROPERTIES  LABELS "app" REQUIRED_FILES "/root/repo/app/data/simple-cms.org.json" _BACKTRACE_TRIPLES "/root/repo/app/CMakeLists.txt;85;add_test;/root/repo/app/CMakeLists.txt;0;")
@@ -0,0 +1,188 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/celeritas/Types.cc" "src/CMakeFiles/celeritas.dir/celeritas/Types.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/Types.cc.o.d"
+  "/root/repo/src/celeritas/em/AtomicRelaxationParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/AtomicRelaxationParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/AtomicRelaxationParams.cc.o.d"
+  "/root/repo/src/celeritas/em/FluctuationParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/FluctuationParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/FluctuationParams.cc.o.d"
+  "/root/repo/src/celeritas/em/NativeEmTableBuilder.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/NativeEmTableBuilder.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/NativeEmTableBuilder.cc.o.d"
+  "/root/repo/src/celeritas/em/detail/Utils.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/detail/Utils.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/detail/Utils.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/BetheHeitlerInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/BetheHeitlerInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/CombinedBremInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/CombinedBremInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/EPlusGGInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/EPlusGGInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/EmStandardInteractAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/EmStandardInteractAction.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/KleinNishinaInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/KleinNishinaInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/LivermorePEInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/LivermorePEInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/MollerBhabhaInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/MollerBhabhaInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/MuBremsstrahlungInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/MuBremsstrahlungInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/RayleighInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/RayleighInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/RelativisticBremInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/RelativisticBremInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/SeltzerBergerInteract.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/generated/SeltzerBergerInteract.cc.o.d"
+  "/root/repo/src/celeritas/em/model/BetheHeitlerModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/BetheHeitlerModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/BetheHeitlerModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/CombinedBremModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/CombinedBremModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/CombinedBremModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/EPlusGGModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/EPlusGGModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/EPlusGGModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/KleinNishinaModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/KleinNishinaModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/KleinNishinaModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/LivermorePEModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/LivermorePEModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/LivermorePEModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/MollerBhabhaModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/MollerBhabhaModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/MollerBhabhaModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/MuBremsstrahlungModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/MuBremsstrahlungModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/MuBremsstrahlungModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/RayleighModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/RayleighModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/RayleighModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/RelativisticBremModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/RelativisticBremModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/RelativisticBremModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/SeltzerBergerModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/SeltzerBergerModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/SeltzerBergerModel.cc.o.d"
+  "/root/repo/src/celeritas/em/model/UrbanMscModel.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/UrbanMscModel.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/model/UrbanMscModel.cc.o.d"
+  "/root/repo/src/celeritas/em/process/BremsstrahlungProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/BremsstrahlungProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/BremsstrahlungProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/ComptonProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/ComptonProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/ComptonProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/EIonizationProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/EIonizationProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/EIonizationProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/EPlusAnnihilationProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/EPlusAnnihilationProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/EPlusAnnihilationProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/GammaConversionProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/GammaConversionProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/GammaConversionProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/MultipleScatteringProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/MultipleScatteringProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/MultipleScatteringProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/PhotoelectricProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/PhotoelectricProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/PhotoelectricProcess.cc.o.d"
+  "/root/repo/src/celeritas/em/process/RayleighProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/RayleighProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/em/process/RayleighProcess.cc.o.d"
+  "/root/repo/src/celeritas/ext/MpiCommunicator.cc" "src/CMakeFiles/celeritas.dir/celeritas/ext/MpiCommunicator.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/ext/MpiCommunicator.cc.o.d"
+  "/root/repo/src/celeritas/ext/ScopedMpiInit.cc" "src/CMakeFiles/celeritas.dir/celeritas/ext/ScopedMpiInit.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/ext/ScopedMpiInit.cc.o.d"
+  "/root/repo/src/celeritas/field/FieldDriverOptionsIO.json.cc" "src/CMakeFiles/celeritas.dir/celeritas/field/FieldDriverOptionsIO.json.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/field/FieldDriverOptionsIO.json.cc.o.d"
+  "/root/repo/src/celeritas/field/FieldRegionParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/field/FieldRegionParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/field/FieldRegionParams.cc.o.d"
+  "/root/repo/src/celeritas/geo/GeoMaterialParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/geo/GeoMaterialParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/geo/GeoMaterialParams.cc.o.d"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/geo/generated/BoundaryAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/geo/generated/BoundaryAction.cc.o.d"
+  "/root/repo/src/celeritas/global/ActionInterface.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionInterface.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionInterface.cc.o.d"
+  "/root/repo/src/celeritas/global/ActionRegistry.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionRegistry.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionRegistry.cc.o.d"
+  "/root/repo/src/celeritas/global/ActionRegistryOutput.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionRegistryOutput.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/ActionRegistryOutput.cc.o.d"
+  "/root/repo/src/celeritas/global/CoreParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/CoreParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/CoreParams.cc.o.d"
+  "/root/repo/src/celeritas/global/EnergyMonitorAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/EnergyMonitorAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/EnergyMonitorAction.cc.o.d"
+  "/root/repo/src/celeritas/global/EventTallyAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/EventTallyAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/EventTallyAction.cc.o.d"
+  "/root/repo/src/celeritas/global/Stepper.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/Stepper.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/Stepper.cc.o.d"
+  "/root/repo/src/celeritas/global/TrackSlotPolicy.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/TrackSlotPolicy.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/TrackSlotPolicy.cc.o.d"
+  "/root/repo/src/celeritas/global/VolumeProfilerAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerAction.cc.o.d"
+  "/root/repo/src/celeritas/global/VolumeProfilerOutput.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerOutput.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerOutput.cc.o.d"
+  "/root/repo/src/celeritas/global/alongstep/AlongStepGeneralLinearAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepGeneralLinearAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepGeneralLinearAction.cc.o.d"
+  "/root/repo/src/celeritas/global/alongstep/AlongStepNeutralAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepNeutralAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepNeutralAction.cc.o.d"
+  "/root/repo/src/celeritas/global/alongstep/AlongStepUniformMscAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepUniformMscAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepUniformMscAction.cc.o.d"
+  "/root/repo/src/celeritas/global/detail/ActionSequence.cc" "src/CMakeFiles/celeritas.dir/celeritas/global/detail/ActionSequence.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/global/detail/ActionSequence.cc.o.d"
+  "/root/repo/src/celeritas/grid/InverseRangeInserter.cc" "src/CMakeFiles/celeritas.dir/celeritas/grid/InverseRangeInserter.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/grid/InverseRangeInserter.cc.o.d"
+  "/root/repo/src/celeritas/grid/ValueGridBuilder.cc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridBuilder.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridBuilder.cc.o.d"
+  "/root/repo/src/celeritas/grid/ValueGridInserter.cc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInserter.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInserter.cc.o.d"
+  "/root/repo/src/celeritas/grid/ValueGridInterface.cc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInterface.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInterface.cc.o.d"
+  "/root/repo/src/celeritas/io/AtomicRelaxationReader.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/AtomicRelaxationReader.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/AtomicRelaxationReader.cc.o.d"
+  "/root/repo/src/celeritas/io/EventReader.nohepmc.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/EventReader.nohepmc.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/EventReader.nohepmc.cc.o.d"
+  "/root/repo/src/celeritas/io/ImportData.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportData.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportData.cc.o.d"
+  "/root/repo/src/celeritas/io/ImportPhysicsTable.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsTable.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsTable.cc.o.d"
+  "/root/repo/src/celeritas/io/ImportPhysicsVector.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsVector.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsVector.cc.o.d"
+  "/root/repo/src/celeritas/io/ImportProcess.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportProcess.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/ImportProcess.cc.o.d"
+  "/root/repo/src/celeritas/io/LivermorePEReader.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/LivermorePEReader.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/LivermorePEReader.cc.o.d"
+  "/root/repo/src/celeritas/io/SeltzerBergerReader.cc" "src/CMakeFiles/celeritas.dir/celeritas/io/SeltzerBergerReader.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/io/SeltzerBergerReader.cc.o.d"
+  "/root/repo/src/celeritas/mat/MaterialParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/mat/MaterialParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/mat/MaterialParams.cc.o.d"
+  "/root/repo/src/celeritas/mat/detail/Utils.cc" "src/CMakeFiles/celeritas.dir/celeritas/mat/detail/Utils.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/mat/detail/Utils.cc.o.d"
+  "/root/repo/src/celeritas/phys/CompactSecondariesAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/CompactSecondariesAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/CompactSecondariesAction.cc.o.d"
+  "/root/repo/src/celeritas/phys/CutoffParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/CutoffParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/CutoffParams.cc.o.d"
+  "/root/repo/src/celeritas/phys/ImportedModelAdapter.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ImportedModelAdapter.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ImportedModelAdapter.cc.o.d"
+  "/root/repo/src/celeritas/phys/ImportedProcessAdapter.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ImportedProcessAdapter.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ImportedProcessAdapter.cc.o.d"
+  "/root/repo/src/celeritas/phys/MortonSort.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/MortonSort.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/MortonSort.cc.o.d"
+  "/root/repo/src/celeritas/phys/ParticleParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ParticleParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ParticleParams.cc.o.d"
+  "/root/repo/src/celeritas/phys/PhysicsParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParams.cc.o.d"
+  "/root/repo/src/celeritas/phys/PhysicsParamsOutput.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParamsOutput.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParamsOutput.cc.o.d"
+  "/root/repo/src/celeritas/phys/PrimaryGeneratorOptionsIO.json.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PrimaryGeneratorOptionsIO.json.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/PrimaryGeneratorOptionsIO.json.cc.o.d"
+  "/root/repo/src/celeritas/phys/Process.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/Process.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/Process.cc.o.d"
+  "/root/repo/src/celeritas/phys/ProcessBuilder.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ProcessBuilder.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/ProcessBuilder.cc.o.d"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/generated/DiscreteSelectAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/generated/DiscreteSelectAction.cc.o.d"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.cc" "src/CMakeFiles/celeritas.dir/celeritas/phys/generated/PreStepAction.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/phys/generated/PreStepAction.cc.o.d"
+  "/root/repo/src/celeritas/random/CuHipRngData.cc" "src/CMakeFiles/celeritas.dir/celeritas/random/CuHipRngData.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/random/CuHipRngData.cc.o.d"
+  "/root/repo/src/celeritas/random/XorwowRngData.cc" "src/CMakeFiles/celeritas.dir/celeritas/random/XorwowRngData.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/random/XorwowRngData.cc.o.d"
+  "/root/repo/src/celeritas/random/XorwowRngParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/random/XorwowRngParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/random/XorwowRngParams.cc.o.d"
+  "/root/repo/src/celeritas/random/detail/CuHipRngStateInit.cc" "src/CMakeFiles/celeritas.dir/celeritas/random/detail/CuHipRngStateInit.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/random/detail/CuHipRngStateInit.cc.o.d"
+  "/root/repo/src/celeritas/track/TrackInitParams.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/TrackInitParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/TrackInitParams.cc.o.d"
+  "/root/repo/src/celeritas/track/detail/TrackInitAlgorithms.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/detail/TrackInitAlgorithms.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/detail/TrackInitAlgorithms.cc.o.d"
+  "/root/repo/src/celeritas/track/generated/InitTracks.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/InitTracks.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/InitTracks.cc.o.d"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/LocateAlive.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/LocateAlive.cc.o.d"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/MoveTracks.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/MoveTracks.cc.o.d"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessPrimaries.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessPrimaries.cc.o.d"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessSecondaries.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessSecondaries.cc.o.d"
+  "/root/repo/_float_build/src/celeritas_version.cc" "src/CMakeFiles/celeritas.dir/celeritas_version.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/celeritas_version.cc.o.d"
+  "/root/repo/src/corecel/Assert.cc" "src/CMakeFiles/celeritas.dir/corecel/Assert.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/Assert.cc.o.d"
+  "/root/repo/src/corecel/cont/Label.cc" "src/CMakeFiles/celeritas.dir/corecel/cont/Label.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/cont/Label.cc.o.d"
+  "/root/repo/src/corecel/data/Copier.cc" "src/CMakeFiles/celeritas.dir/corecel/data/Copier.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/data/Copier.cc.o.d"
+  "/root/repo/src/corecel/data/DeviceAllocation.cc" "src/CMakeFiles/celeritas.dir/corecel/data/DeviceAllocation.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/data/DeviceAllocation.cc.o.d"
+  "/root/repo/src/corecel/io/BuildOutput.cc" "src/CMakeFiles/celeritas.dir/corecel/io/BuildOutput.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/BuildOutput.cc.o.d"
+  "/root/repo/src/corecel/io/ColorUtils.cc" "src/CMakeFiles/celeritas.dir/corecel/io/ColorUtils.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/ColorUtils.cc.o.d"
+  "/root/repo/src/corecel/io/ExceptionOutput.cc" "src/CMakeFiles/celeritas.dir/corecel/io/ExceptionOutput.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/ExceptionOutput.cc.o.d"
+  "/root/repo/src/corecel/io/Logger.cc" "src/CMakeFiles/celeritas.dir/corecel/io/Logger.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/Logger.cc.o.d"
+  "/root/repo/src/corecel/io/LoggerTypes.cc" "src/CMakeFiles/celeritas.dir/corecel/io/LoggerTypes.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/LoggerTypes.cc.o.d"
+  "/root/repo/src/corecel/io/OutputInterface.cc" "src/CMakeFiles/celeritas.dir/corecel/io/OutputInterface.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/OutputInterface.cc.o.d"
+  "/root/repo/src/corecel/io/OutputManager.cc" "src/CMakeFiles/celeritas.dir/corecel/io/OutputManager.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/OutputManager.cc.o.d"
+  "/root/repo/src/corecel/io/ScopedStreamRedirect.cc" "src/CMakeFiles/celeritas.dir/corecel/io/ScopedStreamRedirect.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/ScopedStreamRedirect.cc.o.d"
+  "/root/repo/src/corecel/io/ScopedTimeAndRedirect.cc" "src/CMakeFiles/celeritas.dir/corecel/io/ScopedTimeAndRedirect.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/ScopedTimeAndRedirect.cc.o.d"
+  "/root/repo/src/corecel/io/StringUtils.cc" "src/CMakeFiles/celeritas.dir/corecel/io/StringUtils.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/StringUtils.cc.o.d"
+  "/root/repo/src/corecel/io/detail/LoggerMessage.cc" "src/CMakeFiles/celeritas.dir/corecel/io/detail/LoggerMessage.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/detail/LoggerMessage.cc.o.d"
+  "/root/repo/src/corecel/io/detail/ReprImpl.cc" "src/CMakeFiles/celeritas.dir/corecel/io/detail/ReprImpl.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/io/detail/ReprImpl.cc.o.d"
+  "/root/repo/src/corecel/math/VectorUtils.cc" "src/CMakeFiles/celeritas.dir/corecel/math/VectorUtils.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/math/VectorUtils.cc.o.d"
+  "/root/repo/src/corecel/sys/Device.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/Device.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/Device.cc.o.d"
+  "/root/repo/src/corecel/sys/DeviceIO.json.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/DeviceIO.json.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/DeviceIO.json.cc.o.d"
+  "/root/repo/src/corecel/sys/Environment.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/Environment.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/Environment.cc.o.d"
+  "/root/repo/src/corecel/sys/HostThread.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/HostThread.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/HostThread.cc.o.d"
+  "/root/repo/src/corecel/sys/KernelDiagnostics.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnostics.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnostics.cc.o.d"
+  "/root/repo/src/corecel/sys/KernelDiagnosticsIO.json.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnosticsIO.json.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnosticsIO.json.cc.o.d"
+  "/root/repo/src/corecel/sys/ScopedSignalHandler.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/ScopedSignalHandler.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/ScopedSignalHandler.cc.o.d"
+  "/root/repo/src/corecel/sys/TypeDemangler.cc" "src/CMakeFiles/celeritas.dir/corecel/sys/TypeDemangler.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/corecel/sys/TypeDemangler.cc.o.d"
+  "/root/repo/src/orange/OrangeParams.cc" "src/CMakeFiles/celeritas.dir/orange/OrangeParams.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/OrangeParams.cc.o.d"
+  "/root/repo/src/orange/Types.cc" "src/CMakeFiles/celeritas.dir/orange/Types.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/Types.cc.o.d"
+  "/root/repo/src/orange/construct/OrangeInputIO.json.cc" "src/CMakeFiles/celeritas.dir/orange/construct/OrangeInputIO.json.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/construct/OrangeInputIO.json.cc.o.d"
+  "/root/repo/src/orange/construct/SurfaceInputBuilder.cc" "src/CMakeFiles/celeritas.dir/orange/construct/SurfaceInputBuilder.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/construct/SurfaceInputBuilder.cc.o.d"
+  "/root/repo/src/orange/detail/OrangeBinaryIO.cc" "src/CMakeFiles/celeritas.dir/orange/detail/OrangeBinaryIO.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/detail/OrangeBinaryIO.cc.o.d"
+  "/root/repo/src/orange/detail/SurfaceDeduplicator.cc" "src/CMakeFiles/celeritas.dir/orange/detail/SurfaceDeduplicator.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/detail/SurfaceDeduplicator.cc.o.d"
+  "/root/repo/src/orange/detail/UnitInserter.cc" "src/CMakeFiles/celeritas.dir/orange/detail/UnitInserter.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/detail/UnitInserter.cc.o.d"
+  "/root/repo/src/orange/surf/SurfaceIO.cc" "src/CMakeFiles/celeritas.dir/orange/surf/SurfaceIO.cc.o" "gcc" "src/CMakeFiles/celeritas.dir/orange/surf/SurfaceIO.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cu" "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cc"
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.hh" "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cc"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cu" "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.hh" "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cu" "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cc"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.hh" "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cc"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cu" "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cc"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.hh" "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cc"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cu" "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.hh" "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cu" "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cc"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.hh" "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cu" "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.hh" "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cu" "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.hh" "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.cu" "/root/repo/src/celeritas/em/generated/RayleighInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.hh" "/root/repo/src/celeritas/em/generated/RayleighInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cu" "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.hh" "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cu" "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cc"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.hh" "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cc"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.cu" "/root/repo/src/celeritas/geo/generated/BoundaryAction.cc"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.hh" "/root/repo/src/celeritas/geo/generated/BoundaryAction.cc"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cu" "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cc"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.hh" "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cc"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.cu" "/root/repo/src/celeritas/phys/generated/PreStepAction.cc"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.hh" "/root/repo/src/celeritas/phys/generated/PreStepAction.cc"
+  "/root/repo/src/celeritas/track/generated/InitTracks.cu" "/root/repo/src/celeritas/track/generated/InitTracks.cc"
+  "/root/repo/src/celeritas/track/generated/InitTracks.hh" "/root/repo/src/celeritas/track/generated/InitTracks.cc"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.cu" "/root/repo/src/celeritas/track/generated/LocateAlive.cc"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.hh" "/root/repo/src/celeritas/track/generated/LocateAlive.cc"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.cu" "/root/repo/src/celeritas/track/generated/MoveTracks.cc"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.hh" "/root/repo/src/celeritas/track/generated/MoveTracks.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cu" "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.hh" "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cu" "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.hh" "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cc"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
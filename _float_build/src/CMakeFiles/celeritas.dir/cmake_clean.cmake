@@ -0,0 +1,320 @@
+file(REMOVE_RECURSE
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cc"
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.cu"
+  "/root/repo/src/celeritas/em/generated/BetheHeitlerInteract.hh"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.cu"
+  "/root/repo/src/celeritas/em/generated/CombinedBremInteract.hh"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cc"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.cu"
+  "/root/repo/src/celeritas/em/generated/EPlusGGInteract.hh"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cc"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.cu"
+  "/root/repo/src/celeritas/em/generated/EmStandardInteractAction.hh"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.cu"
+  "/root/repo/src/celeritas/em/generated/KleinNishinaInteract.hh"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cc"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.cu"
+  "/root/repo/src/celeritas/em/generated/LivermorePEInteract.hh"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.cu"
+  "/root/repo/src/celeritas/em/generated/MollerBhabhaInteract.hh"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cc"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.cu"
+  "/root/repo/src/celeritas/em/generated/MuBremsstrahlungInteract.hh"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.cu"
+  "/root/repo/src/celeritas/em/generated/RayleighInteract.hh"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cc"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.cu"
+  "/root/repo/src/celeritas/em/generated/RelativisticBremInteract.hh"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cc"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.cu"
+  "/root/repo/src/celeritas/em/generated/SeltzerBergerInteract.hh"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.cc"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.cu"
+  "/root/repo/src/celeritas/geo/generated/BoundaryAction.hh"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cc"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.cu"
+  "/root/repo/src/celeritas/phys/generated/DiscreteSelectAction.hh"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.cc"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.cu"
+  "/root/repo/src/celeritas/phys/generated/PreStepAction.hh"
+  "/root/repo/src/celeritas/track/generated/InitTracks.cc"
+  "/root/repo/src/celeritas/track/generated/InitTracks.cu"
+  "/root/repo/src/celeritas/track/generated/InitTracks.hh"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.cc"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.cu"
+  "/root/repo/src/celeritas/track/generated/LocateAlive.hh"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.cc"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.cu"
+  "/root/repo/src/celeritas/track/generated/MoveTracks.hh"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.cu"
+  "/root/repo/src/celeritas/track/generated/ProcessPrimaries.hh"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cc"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.cu"
+  "/root/repo/src/celeritas/track/generated/ProcessSecondaries.hh"
+  "CMakeFiles/celeritas.dir/celeritas/Types.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/Types.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/AtomicRelaxationParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/AtomicRelaxationParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/FluctuationParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/FluctuationParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/NativeEmTableBuilder.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/NativeEmTableBuilder.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/detail/Utils.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/detail/Utils.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/BetheHeitlerInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/BetheHeitlerInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/CombinedBremInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/CombinedBremInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/EPlusGGInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/EPlusGGInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/EmStandardInteractAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/EmStandardInteractAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/KleinNishinaInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/KleinNishinaInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/LivermorePEInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/LivermorePEInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/MollerBhabhaInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/MollerBhabhaInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/MuBremsstrahlungInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/MuBremsstrahlungInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/RayleighInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/RayleighInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/RelativisticBremInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/RelativisticBremInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/SeltzerBergerInteract.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/generated/SeltzerBergerInteract.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/BetheHeitlerModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/BetheHeitlerModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/CombinedBremModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/CombinedBremModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/EPlusGGModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/EPlusGGModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/KleinNishinaModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/KleinNishinaModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/LivermorePEModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/LivermorePEModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/MollerBhabhaModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/MollerBhabhaModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/MuBremsstrahlungModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/MuBremsstrahlungModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/RayleighModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/RayleighModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/RelativisticBremModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/RelativisticBremModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/SeltzerBergerModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/SeltzerBergerModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/UrbanMscModel.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/model/UrbanMscModel.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/BremsstrahlungProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/BremsstrahlungProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/ComptonProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/ComptonProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/EIonizationProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/EIonizationProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/EPlusAnnihilationProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/EPlusAnnihilationProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/GammaConversionProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/GammaConversionProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/MultipleScatteringProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/MultipleScatteringProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/PhotoelectricProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/PhotoelectricProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/RayleighProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/em/process/RayleighProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/ext/MpiCommunicator.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/ext/MpiCommunicator.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/ext/ScopedMpiInit.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/ext/ScopedMpiInit.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/field/FieldDriverOptionsIO.json.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/field/FieldDriverOptionsIO.json.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/field/FieldRegionParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/field/FieldRegionParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/geo/GeoMaterialParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/geo/GeoMaterialParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/geo/generated/BoundaryAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/geo/generated/BoundaryAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionInterface.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionInterface.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionRegistry.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionRegistry.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionRegistryOutput.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/ActionRegistryOutput.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/CoreParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/CoreParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/EnergyMonitorAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/EnergyMonitorAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/EventTallyAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/EventTallyAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/Stepper.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/Stepper.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/TrackSlotPolicy.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/TrackSlotPolicy.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerOutput.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/VolumeProfilerOutput.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepGeneralLinearAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepGeneralLinearAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepNeutralAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepNeutralAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepUniformMscAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/alongstep/AlongStepUniformMscAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/global/detail/ActionSequence.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/global/detail/ActionSequence.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/grid/InverseRangeInserter.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/grid/InverseRangeInserter.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridBuilder.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridBuilder.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInserter.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInserter.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInterface.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/grid/ValueGridInterface.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/AtomicRelaxationReader.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/AtomicRelaxationReader.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/EventReader.nohepmc.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/EventReader.nohepmc.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportData.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportData.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsTable.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsTable.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsVector.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportPhysicsVector.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportProcess.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/ImportProcess.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/LivermorePEReader.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/LivermorePEReader.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/io/SeltzerBergerReader.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/io/SeltzerBergerReader.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/mat/MaterialParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/mat/MaterialParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/mat/detail/Utils.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/mat/detail/Utils.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/CompactSecondariesAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/CompactSecondariesAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/CutoffParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/CutoffParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ImportedModelAdapter.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ImportedModelAdapter.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ImportedProcessAdapter.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ImportedProcessAdapter.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/MortonSort.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/MortonSort.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ParticleParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ParticleParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParamsOutput.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PhysicsParamsOutput.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PrimaryGeneratorOptionsIO.json.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/PrimaryGeneratorOptionsIO.json.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/Process.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/Process.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ProcessBuilder.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/ProcessBuilder.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/generated/DiscreteSelectAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/generated/DiscreteSelectAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/phys/generated/PreStepAction.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/phys/generated/PreStepAction.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/random/CuHipRngData.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/random/CuHipRngData.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/random/XorwowRngData.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/random/XorwowRngData.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/random/XorwowRngParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/random/XorwowRngParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/random/detail/CuHipRngStateInit.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/random/detail/CuHipRngStateInit.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/TrackInitParams.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/TrackInitParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/detail/TrackInitAlgorithms.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/detail/TrackInitAlgorithms.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/InitTracks.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/InitTracks.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/LocateAlive.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/LocateAlive.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/MoveTracks.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/MoveTracks.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessPrimaries.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessPrimaries.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessSecondaries.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas/track/generated/ProcessSecondaries.cc.o.d"
+  "CMakeFiles/celeritas.dir/celeritas_version.cc.o"
+  "CMakeFiles/celeritas.dir/celeritas_version.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/Assert.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/Assert.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/cont/Label.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/cont/Label.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/data/Copier.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/data/Copier.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/data/DeviceAllocation.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/data/DeviceAllocation.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/BuildOutput.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/BuildOutput.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/ColorUtils.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/ColorUtils.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/ExceptionOutput.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/ExceptionOutput.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/Logger.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/Logger.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/LoggerTypes.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/LoggerTypes.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/OutputInterface.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/OutputInterface.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/OutputManager.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/OutputManager.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/ScopedStreamRedirect.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/ScopedStreamRedirect.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/ScopedTimeAndRedirect.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/ScopedTimeAndRedirect.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/StringUtils.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/StringUtils.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/detail/LoggerMessage.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/detail/LoggerMessage.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/io/detail/ReprImpl.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/io/detail/ReprImpl.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/math/VectorUtils.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/math/VectorUtils.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/Device.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/Device.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/DeviceIO.json.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/DeviceIO.json.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/Environment.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/Environment.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/HostThread.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/HostThread.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnostics.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnostics.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnosticsIO.json.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/KernelDiagnosticsIO.json.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/ScopedSignalHandler.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/ScopedSignalHandler.cc.o.d"
+  "CMakeFiles/celeritas.dir/corecel/sys/TypeDemangler.cc.o"
+  "CMakeFiles/celeritas.dir/corecel/sys/TypeDemangler.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/OrangeParams.cc.o"
+  "CMakeFiles/celeritas.dir/orange/OrangeParams.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/Types.cc.o"
+  "CMakeFiles/celeritas.dir/orange/Types.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/construct/OrangeInputIO.json.cc.o"
+  "CMakeFiles/celeritas.dir/orange/construct/OrangeInputIO.json.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/construct/SurfaceInputBuilder.cc.o"
+  "CMakeFiles/celeritas.dir/orange/construct/SurfaceInputBuilder.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/detail/OrangeBinaryIO.cc.o"
+  "CMakeFiles/celeritas.dir/orange/detail/OrangeBinaryIO.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/detail/SurfaceDeduplicator.cc.o"
+  "CMakeFiles/celeritas.dir/orange/detail/SurfaceDeduplicator.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/detail/UnitInserter.cc.o"
+  "CMakeFiles/celeritas.dir/orange/detail/UnitInserter.cc.o.d"
+  "CMakeFiles/celeritas.dir/orange/surf/SurfaceIO.cc.o"
+  "CMakeFiles/celeritas.dir/orange/surf/SurfaceIO.cc.o.d"
+  "libceleritas.pdb"
+  "libceleritas.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
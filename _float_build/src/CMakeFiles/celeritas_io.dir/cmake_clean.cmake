@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_io.dir/celeritas/ext/GeantPhysicsOptionsIO.json.cc.o"
+  "CMakeFiles/celeritas_io.dir/celeritas/ext/GeantPhysicsOptionsIO.json.cc.o.d"
+  "libceleritas_io.pdb"
+  "libceleritas_io.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
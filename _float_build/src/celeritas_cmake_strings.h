@@ -0,0 +1,19 @@
+/*----------------------------------*-C-*------------------------------------*
+ * Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+ * See the top-level COPYRIGHT file for details.
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ *---------------------------------------------------------------------------*/
+/*! \file celeritas_cmake_strings.h
+ * Detailed CMake configuration information.
+ *---------------------------------------------------------------------------*/
+#ifndef celeritas_cmake_strings_h
+#define celeritas_cmake_strings_h
+
+static const char celeritas_rng[] = "XORWOW";
+;static const char celeritas_real_type[] = "float";
+static const char celeritas_build_type[] = "Debug";
+static const char celeritas_clhep_version[] = "";
+static const char celeritas_geant4_version[] = "";
+static const char celeritas_vecgeom_version[] = "";
+
+#endif /* celeritas_cmake_strings_h */
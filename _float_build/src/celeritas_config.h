@@ -0,0 +1,32 @@
+/*----------------------------------*-C-*------------------------------------*
+ * Copyright 2020-2022 UT-Battelle, LLC, and other Celeritas developers.
+ * See the top-level COPYRIGHT file for details.
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ *---------------------------------------------------------------------------*/
+/*! \file celeritas_config.h
+ * Configuration-specific options for Celeritas.
+ *---------------------------------------------------------------------------*/
+#ifndef celeritas_config_h
+#define celeritas_config_h
+
+#define CELERITAS_USE_CUDA 0
+#define CELERITAS_USE_GEANT4 0
+#define CELERITAS_USE_HEPMC3 0
+#define CELERITAS_USE_HIP 0
+#define CELERITAS_USE_JSON 1
+#define CELERITAS_USE_MPI 0
+#define CELERITAS_USE_OPENMP 1
+#define CELERITAS_USE_ROOT 0
+#define CELERITAS_USE_VECGEOM 0
+
+#define CELERITAS_DEBUG 1
+#define CELERITAS_LAUNCH_BOUNDS 0
+
+#define CELERITAS_RNG_XORWOW 1
+#define CELERITAS_RNG CELERITAS_RNG_XORWOW
+
+#define CELERITAS_REAL_TYPE_DOUBLE 1
+#define CELERITAS_REAL_TYPE_FLOAT 2
+#define CELERITAS_REAL_TYPE CELERITAS_REAL_TYPE_FLOAT
+
+#endif /* celeritas_config_h */
@@ -0,0 +1,17 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021-2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas_version.cc
+//---------------------------------------------------------------------------//
+#include "celeritas_version.h"
+
+extern "C" {
+
+const char celeritas_version[]    = "v0.0.0+df149a13";
+const int celeritas_version_major = 0;
+const int celeritas_version_minor = 0;
+const int celeritas_version_patch = 0;
+
+}
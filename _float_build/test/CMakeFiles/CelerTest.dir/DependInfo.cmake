@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/Test.cc" "test/CMakeFiles/CelerTest.dir/Test.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/Test.cc.o.d"
+  "/root/repo/_float_build/test/TestConfig.cc" "test/CMakeFiles/CelerTest.dir/TestConfig.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/TestConfig.cc.o.d"
+  "/root/repo/test/testdetail/NonMasterResultPrinter.cc" "test/CMakeFiles/CelerTest.dir/testdetail/NonMasterResultPrinter.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/testdetail/NonMasterResultPrinter.cc.o.d"
+  "/root/repo/test/testdetail/ParallelHandler.cc" "test/CMakeFiles/CelerTest.dir/testdetail/ParallelHandler.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/testdetail/ParallelHandler.cc.o.d"
+  "/root/repo/test/testdetail/TestMacrosImpl.cc" "test/CMakeFiles/CelerTest.dir/testdetail/TestMacrosImpl.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/testdetail/TestMacrosImpl.cc.o.d"
+  "/root/repo/test/testdetail/TestMainImpl.cc" "test/CMakeFiles/CelerTest.dir/testdetail/TestMainImpl.cc.o" "gcc" "test/CMakeFiles/CelerTest.dir/testdetail/TestMainImpl.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_float_build/src/CMakeFiles/celeritas.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
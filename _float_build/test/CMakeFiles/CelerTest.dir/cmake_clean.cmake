@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CelerTest.dir/Test.cc.o"
+  "CMakeFiles/CelerTest.dir/Test.cc.o.d"
+  "CMakeFiles/CelerTest.dir/TestConfig.cc.o"
+  "CMakeFiles/CelerTest.dir/TestConfig.cc.o.d"
+  "CMakeFiles/CelerTest.dir/testdetail/NonMasterResultPrinter.cc.o"
+  "CMakeFiles/CelerTest.dir/testdetail/NonMasterResultPrinter.cc.o.d"
+  "CMakeFiles/CelerTest.dir/testdetail/ParallelHandler.cc.o"
+  "CMakeFiles/CelerTest.dir/testdetail/ParallelHandler.cc.o.d"
+  "CMakeFiles/CelerTest.dir/testdetail/TestMacrosImpl.cc.o"
+  "CMakeFiles/CelerTest.dir/testdetail/TestMacrosImpl.cc.o.d"
+  "CMakeFiles/CelerTest.dir/testdetail/TestMainImpl.cc.o"
+  "CMakeFiles/CelerTest.dir/testdetail/TestMainImpl.cc.o.d"
+  "libCelerTest.pdb"
+  "libCelerTest.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CelerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
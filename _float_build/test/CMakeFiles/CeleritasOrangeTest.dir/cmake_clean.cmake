@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CeleritasOrangeTest.dir/orange/OrangeGeoTestBase.cc.o"
+  "CMakeFiles/CeleritasOrangeTest.dir/orange/OrangeGeoTestBase.cc.o.d"
+  "libCeleritasOrangeTest.pdb"
+  "libCeleritasOrangeTest.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CeleritasOrangeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
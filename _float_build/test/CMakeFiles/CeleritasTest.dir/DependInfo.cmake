@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/celeritas/GeantTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GeantTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GeantTestBase.cc.o.d"
+  "/root/repo/test/celeritas/GlobalGeoTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GlobalGeoTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GlobalGeoTestBase.cc.o.d"
+  "/root/repo/test/celeritas/GlobalTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GlobalTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/GlobalTestBase.cc.o.d"
+  "/root/repo/test/celeritas/MockTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/MockTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/MockTestBase.cc.o.d"
+  "/root/repo/test/celeritas/SimpleTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/SimpleTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/SimpleTestBase.cc.o.d"
+  "/root/repo/test/celeritas/global/AlongStepTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/global/AlongStepTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/global/AlongStepTestBase.cc.o.d"
+  "/root/repo/test/celeritas/global/StepperTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/global/StepperTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/global/StepperTestBase.cc.o.d"
+  "/root/repo/test/celeritas/grid/CalculatorTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/grid/CalculatorTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/grid/CalculatorTestBase.cc.o.d"
+  "/root/repo/test/celeritas/phys/InteractionIO.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractionIO.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractionIO.cc.o.d"
+  "/root/repo/test/celeritas/phys/InteractorHostTestBase.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractorHostTestBase.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractorHostTestBase.cc.o.d"
+  "/root/repo/test/celeritas/phys/MockModel.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/MockModel.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/MockModel.cc.o.d"
+  "/root/repo/test/celeritas/phys/MockProcess.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/MockProcess.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/MockProcess.cc.o.d"
+  "/root/repo/test/celeritas/phys/SecondaryIO.cc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/SecondaryIO.cc.o" "gcc" "test/CMakeFiles/CeleritasTest.dir/celeritas/phys/SecondaryIO.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_float_build/src/CMakeFiles/celeritas_io.dir/DependInfo.cmake"
+  "/root/repo/_float_build/test/CMakeFiles/CelerTest.dir/DependInfo.cmake"
+  "/root/repo/_float_build/src/CMakeFiles/celeritas.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
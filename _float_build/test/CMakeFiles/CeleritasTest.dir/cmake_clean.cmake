@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CeleritasTest.dir/celeritas/GeantTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/GeantTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/GlobalGeoTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/GlobalGeoTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/GlobalTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/GlobalTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/MockTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/MockTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/SimpleTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/SimpleTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/global/AlongStepTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/global/AlongStepTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/global/StepperTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/global/StepperTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/grid/CalculatorTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/grid/CalculatorTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractionIO.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractionIO.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractorHostTestBase.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/InteractorHostTestBase.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/MockModel.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/MockModel.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/MockProcess.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/MockProcess.cc.o.d"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/SecondaryIO.cc.o"
+  "CMakeFiles/CeleritasTest.dir/celeritas/phys/SecondaryIO.cc.o.d"
+  "libCeleritasTest.pdb"
+  "libCeleritasTest.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CeleritasTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
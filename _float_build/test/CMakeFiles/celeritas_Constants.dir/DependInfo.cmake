@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/celeritas/Constants.test.cc" "test/CMakeFiles/celeritas_Constants.dir/celeritas/Constants.test.cc.o" "gcc" "test/CMakeFiles/celeritas_Constants.dir/celeritas/Constants.test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_float_build/test/CMakeFiles/CeleritasTest.dir/DependInfo.cmake"
+  "/root/repo/_float_build/test/CMakeFiles/CelerTest.dir/DependInfo.cmake"
+  "/root/repo/_float_build/src/CMakeFiles/celeritas.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
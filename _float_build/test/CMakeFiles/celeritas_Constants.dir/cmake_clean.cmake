@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_Constants.dir/celeritas/Constants.test.cc.o"
+  "CMakeFiles/celeritas_Constants.dir/celeritas/Constants.test.cc.o.d"
+  "celeritas_Constants"
+  "celeritas_Constants.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_Constants.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_BetheHeitler.dir/celeritas/em/BetheHeitler.test.cc.o"
+  "CMakeFiles/celeritas_em_BetheHeitler.dir/celeritas/em/BetheHeitler.test.cc.o.d"
+  "celeritas_em_BetheHeitler"
+  "celeritas_em_BetheHeitler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_BetheHeitler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_CombinedBrem.dir/celeritas/em/CombinedBrem.test.cc.o"
+  "CMakeFiles/celeritas_em_CombinedBrem.dir/celeritas/em/CombinedBrem.test.cc.o.d"
+  "celeritas_em_CombinedBrem"
+  "celeritas_em_CombinedBrem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_CombinedBrem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_EPlusGG.dir/celeritas/em/EPlusGG.test.cc.o"
+  "CMakeFiles/celeritas_em_EPlusGG.dir/celeritas/em/EPlusGG.test.cc.o.d"
+  "celeritas_em_EPlusGG"
+  "celeritas_em_EPlusGG.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_EPlusGG.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
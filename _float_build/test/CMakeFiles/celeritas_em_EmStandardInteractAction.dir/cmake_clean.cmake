@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_EmStandardInteractAction.dir/celeritas/em/EmStandardInteractAction.test.cc.o"
+  "CMakeFiles/celeritas_em_EmStandardInteractAction.dir/celeritas/em/EmStandardInteractAction.test.cc.o.d"
+  "celeritas_em_EmStandardInteractAction"
+  "celeritas_em_EmStandardInteractAction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_EmStandardInteractAction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
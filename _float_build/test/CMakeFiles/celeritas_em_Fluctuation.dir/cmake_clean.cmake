@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_Fluctuation.dir/celeritas/em/Fluctuation.test.cc.o"
+  "CMakeFiles/celeritas_em_Fluctuation.dir/celeritas/em/Fluctuation.test.cc.o.d"
+  "celeritas_em_Fluctuation"
+  "celeritas_em_Fluctuation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_Fluctuation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_ImportedProcesses.dir/celeritas/em/ImportedProcesses.test.cc.o"
+  "CMakeFiles/celeritas_em_ImportedProcesses.dir/celeritas/em/ImportedProcesses.test.cc.o.d"
+  "celeritas_em_ImportedProcesses"
+  "celeritas_em_ImportedProcesses.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_ImportedProcesses.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
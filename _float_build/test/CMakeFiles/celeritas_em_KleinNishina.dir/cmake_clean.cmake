@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_KleinNishina.dir/celeritas/em/KleinNishina.test.cc.o"
+  "CMakeFiles/celeritas_em_KleinNishina.dir/celeritas/em/KleinNishina.test.cc.o.d"
+  "celeritas_em_KleinNishina"
+  "celeritas_em_KleinNishina.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_KleinNishina.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_LivermorePE.dir/celeritas/em/LivermorePE.test.cc.o"
+  "CMakeFiles/celeritas_em_LivermorePE.dir/celeritas/em/LivermorePE.test.cc.o.d"
+  "celeritas_em_LivermorePE"
+  "celeritas_em_LivermorePE.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_LivermorePE.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
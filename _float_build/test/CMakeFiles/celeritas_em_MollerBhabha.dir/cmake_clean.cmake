@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_MollerBhabha.dir/celeritas/em/MollerBhabha.test.cc.o"
+  "CMakeFiles/celeritas_em_MollerBhabha.dir/celeritas/em/MollerBhabha.test.cc.o.d"
+  "celeritas_em_MollerBhabha"
+  "celeritas_em_MollerBhabha.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_MollerBhabha.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_MuBremsstrahlung.dir/celeritas/em/MuBremsstrahlung.test.cc.o"
+  "CMakeFiles/celeritas_em_MuBremsstrahlung.dir/celeritas/em/MuBremsstrahlung.test.cc.o.d"
+  "celeritas_em_MuBremsstrahlung"
+  "celeritas_em_MuBremsstrahlung.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_MuBremsstrahlung.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_NativeEmTableBuilder.dir/celeritas/em/NativeEmTableBuilder.test.cc.o"
+  "CMakeFiles/celeritas_em_NativeEmTableBuilder.dir/celeritas/em/NativeEmTableBuilder.test.cc.o.d"
+  "celeritas_em_NativeEmTableBuilder"
+  "celeritas_em_NativeEmTableBuilder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_NativeEmTableBuilder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_Rayleigh.dir/celeritas/em/Rayleigh.test.cc.o"
+  "CMakeFiles/celeritas_em_Rayleigh.dir/celeritas/em/Rayleigh.test.cc.o.d"
+  "celeritas_em_Rayleigh"
+  "celeritas_em_Rayleigh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_Rayleigh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
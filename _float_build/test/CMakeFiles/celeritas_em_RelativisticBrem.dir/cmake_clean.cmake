@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_RelativisticBrem.dir/celeritas/em/RelativisticBrem.test.cc.o"
+  "CMakeFiles/celeritas_em_RelativisticBrem.dir/celeritas/em/RelativisticBrem.test.cc.o.d"
+  "celeritas_em_RelativisticBrem"
+  "celeritas_em_RelativisticBrem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_RelativisticBrem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_SeltzerBerger.dir/celeritas/em/SeltzerBerger.test.cc.o"
+  "CMakeFiles/celeritas_em_SeltzerBerger.dir/celeritas/em/SeltzerBerger.test.cc.o.d"
+  "celeritas_em_SeltzerBerger"
+  "celeritas_em_SeltzerBerger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_SeltzerBerger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_TsaiUrbanDistribution.dir/celeritas/em/TsaiUrbanDistribution.test.cc.o"
+  "CMakeFiles/celeritas_em_TsaiUrbanDistribution.dir/celeritas/em/TsaiUrbanDistribution.test.cc.o.d"
+  "celeritas_em_TsaiUrbanDistribution"
+  "celeritas_em_TsaiUrbanDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_TsaiUrbanDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_em_UrbanMsc.dir/celeritas/em/UrbanMsc.test.cc.o"
+  "CMakeFiles/celeritas_em_UrbanMsc.dir/celeritas/em/UrbanMsc.test.cc.o.d"
+  "celeritas_em_UrbanMsc"
+  "celeritas_em_UrbanMsc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_em_UrbanMsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
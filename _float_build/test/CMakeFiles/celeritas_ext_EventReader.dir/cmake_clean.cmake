@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_ext_EventReader.dir/celeritas/ext/EventReader.test.cc.o"
+  "CMakeFiles/celeritas_ext_EventReader.dir/celeritas/ext/EventReader.test.cc.o.d"
+  "celeritas_ext_EventReader"
+  "celeritas_ext_EventReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_ext_EventReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_ext_GeantImporter.dir/celeritas/ext/GeantImporter.test.cc.o"
+  "CMakeFiles/celeritas_ext_GeantImporter.dir/celeritas/ext/GeantImporter.test.cc.o.d"
+  "celeritas_ext_GeantImporter"
+  "celeritas_ext_GeantImporter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_ext_GeantImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
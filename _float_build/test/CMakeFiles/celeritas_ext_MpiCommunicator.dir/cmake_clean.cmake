@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_ext_MpiCommunicator.dir/celeritas/ext/MpiCommunicator.test.cc.o"
+  "CMakeFiles/celeritas_ext_MpiCommunicator.dir/celeritas/ext/MpiCommunicator.test.cc.o.d"
+  "celeritas_ext_MpiCommunicator"
+  "celeritas_ext_MpiCommunicator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_ext_MpiCommunicator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_ext_RootImporter.dir/celeritas/ext/RootImporter.test.cc.o"
+  "CMakeFiles/celeritas_ext_RootImporter.dir/celeritas/ext/RootImporter.test.cc.o.d"
+  "celeritas_ext_RootImporter"
+  "celeritas_ext_RootImporter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_ext_RootImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_FieldDriver.dir/celeritas/field/FieldDriver.test.cc.o"
+  "CMakeFiles/celeritas_field_FieldDriver.dir/celeritas/field/FieldDriver.test.cc.o.d"
+  "celeritas_field_FieldDriver"
+  "celeritas_field_FieldDriver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_FieldDriver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
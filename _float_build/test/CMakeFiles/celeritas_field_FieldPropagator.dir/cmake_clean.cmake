@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_FieldPropagator.dir/celeritas/field/FieldPropagator.test.cc.o"
+  "CMakeFiles/celeritas_field_FieldPropagator.dir/celeritas/field/FieldPropagator.test.cc.o.d"
+  "celeritas_field_FieldPropagator"
+  "celeritas_field_FieldPropagator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_FieldPropagator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_FieldRegion.dir/celeritas/field/FieldRegion.test.cc.o"
+  "CMakeFiles/celeritas_field_FieldRegion.dir/celeritas/field/FieldRegion.test.cc.o.d"
+  "celeritas_field_FieldRegion"
+  "celeritas_field_FieldRegion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_FieldRegion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/CMSFieldMapReader.cc.o"
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/CMSFieldMapReader.cc.o.d"
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/Fields.test.cc.o"
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/Fields.test.cc.o.d"
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/MagFieldMap.cc.o"
+  "CMakeFiles/celeritas_field_Fields.dir/celeritas/field/MagFieldMap.cc.o.d"
+  "celeritas_field_Fields"
+  "celeritas_field_Fields.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_Fields.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
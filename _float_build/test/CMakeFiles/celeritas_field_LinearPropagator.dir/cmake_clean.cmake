@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_LinearPropagator.dir/celeritas/field/LinearPropagator.test.cc.o"
+  "CMakeFiles/celeritas_field_LinearPropagator.dir/celeritas/field/LinearPropagator.test.cc.o.d"
+  "celeritas_field_LinearPropagator"
+  "celeritas_field_LinearPropagator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_LinearPropagator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
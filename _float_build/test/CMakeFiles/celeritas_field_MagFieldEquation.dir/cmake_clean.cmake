@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_MagFieldEquation.dir/celeritas/field/MagFieldEquation.test.cc.o"
+  "CMakeFiles/celeritas_field_MagFieldEquation.dir/celeritas/field/MagFieldEquation.test.cc.o.d"
+  "celeritas_field_MagFieldEquation"
+  "celeritas_field_MagFieldEquation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_MagFieldEquation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
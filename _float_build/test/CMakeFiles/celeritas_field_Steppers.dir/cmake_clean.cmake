@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_field_Steppers.dir/celeritas/field/Steppers.test.cc.o"
+  "CMakeFiles/celeritas_field_Steppers.dir/celeritas/field/Steppers.test.cc.o.d"
+  "celeritas_field_Steppers"
+  "celeritas_field_Steppers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_field_Steppers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_geo_GeoMaterial.dir/celeritas/geo/GeoMaterial.test.cc.o"
+  "CMakeFiles/celeritas_geo_GeoMaterial.dir/celeritas/geo/GeoMaterial.test.cc.o.d"
+  "celeritas_geo_GeoMaterial"
+  "celeritas_geo_GeoMaterial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_geo_GeoMaterial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_geo_Geometry.dir/celeritas/geo/Geometry.test.cc.o"
+  "CMakeFiles/celeritas_geo_Geometry.dir/celeritas/geo/Geometry.test.cc.o.d"
+  "CMakeFiles/celeritas_geo_Geometry.dir/celeritas/geo/HeuristicGeoTestBase.cc.o"
+  "CMakeFiles/celeritas_geo_Geometry.dir/celeritas/geo/HeuristicGeoTestBase.cc.o.d"
+  "celeritas_geo_Geometry"
+  "celeritas_geo_Geometry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_geo_Geometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_ActionRegistry.dir/celeritas/global/ActionRegistry.test.cc.o"
+  "CMakeFiles/celeritas_global_ActionRegistry.dir/celeritas/global/ActionRegistry.test.cc.o.d"
+  "celeritas_global_ActionRegistry"
+  "celeritas_global_ActionRegistry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_ActionRegistry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
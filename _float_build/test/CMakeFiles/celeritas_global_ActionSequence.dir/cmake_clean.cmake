@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_ActionSequence.dir/celeritas/global/ActionSequence.test.cc.o"
+  "CMakeFiles/celeritas_global_ActionSequence.dir/celeritas/global/ActionSequence.test.cc.o.d"
+  "celeritas_global_ActionSequence"
+  "celeritas_global_ActionSequence.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_ActionSequence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_AlongStep.dir/celeritas/global/AlongStep.test.cc.o"
+  "CMakeFiles/celeritas_global_AlongStep.dir/celeritas/global/AlongStep.test.cc.o.d"
+  "celeritas_global_AlongStep"
+  "celeritas_global_AlongStep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_AlongStep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_BatchNavigation.dir/celeritas/global/BatchNavigation.test.cc.o"
+  "CMakeFiles/celeritas_global_BatchNavigation.dir/celeritas/global/BatchNavigation.test.cc.o.d"
+  "celeritas_global_BatchNavigation"
+  "celeritas_global_BatchNavigation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_BatchNavigation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
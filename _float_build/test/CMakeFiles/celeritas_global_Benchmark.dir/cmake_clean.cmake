@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_Benchmark.dir/celeritas/global/Benchmark.test.cc.o"
+  "CMakeFiles/celeritas_global_Benchmark.dir/celeritas/global/Benchmark.test.cc.o.d"
+  "celeritas_global_Benchmark"
+  "celeritas_global_Benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_Benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
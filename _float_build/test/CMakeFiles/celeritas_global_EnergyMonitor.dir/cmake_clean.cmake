@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_EnergyMonitor.dir/celeritas/global/EnergyMonitor.test.cc.o"
+  "CMakeFiles/celeritas_global_EnergyMonitor.dir/celeritas/global/EnergyMonitor.test.cc.o.d"
+  "celeritas_global_EnergyMonitor"
+  "celeritas_global_EnergyMonitor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_EnergyMonitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
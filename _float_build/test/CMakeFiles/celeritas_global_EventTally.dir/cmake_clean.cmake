@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_EventTally.dir/celeritas/global/EventTally.test.cc.o"
+  "CMakeFiles/celeritas_global_EventTally.dir/celeritas/global/EventTally.test.cc.o.d"
+  "celeritas_global_EventTally"
+  "celeritas_global_EventTally.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_EventTally.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_Stepper.dir/celeritas/global/Stepper.test.cc.o"
+  "CMakeFiles/celeritas_global_Stepper.dir/celeritas/global/Stepper.test.cc.o.d"
+  "celeritas_global_Stepper"
+  "celeritas_global_Stepper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_Stepper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_TrackSlotPolicy.dir/celeritas/global/TrackSlotPolicy.test.cc.o"
+  "CMakeFiles/celeritas_global_TrackSlotPolicy.dir/celeritas/global/TrackSlotPolicy.test.cc.o.d"
+  "celeritas_global_TrackSlotPolicy"
+  "celeritas_global_TrackSlotPolicy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_TrackSlotPolicy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_global_VolumeProfiler.dir/celeritas/global/VolumeProfiler.test.cc.o"
+  "CMakeFiles/celeritas_global_VolumeProfiler.dir/celeritas/global/VolumeProfiler.test.cc.o.d"
+  "celeritas_global_VolumeProfiler"
+  "celeritas_global_VolumeProfiler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_global_VolumeProfiler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
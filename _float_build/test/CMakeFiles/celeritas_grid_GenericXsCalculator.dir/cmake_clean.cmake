@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_GenericXsCalculator.dir/celeritas/grid/GenericXsCalculator.test.cc.o"
+  "CMakeFiles/celeritas_grid_GenericXsCalculator.dir/celeritas/grid/GenericXsCalculator.test.cc.o.d"
+  "celeritas_grid_GenericXsCalculator"
+  "celeritas_grid_GenericXsCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_GenericXsCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
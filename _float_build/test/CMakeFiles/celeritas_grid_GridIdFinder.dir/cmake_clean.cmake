@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_GridIdFinder.dir/celeritas/grid/GridIdFinder.test.cc.o"
+  "CMakeFiles/celeritas_grid_GridIdFinder.dir/celeritas/grid/GridIdFinder.test.cc.o.d"
+  "celeritas_grid_GridIdFinder"
+  "celeritas_grid_GridIdFinder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_GridIdFinder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
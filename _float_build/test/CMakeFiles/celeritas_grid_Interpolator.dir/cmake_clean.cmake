@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_Interpolator.dir/celeritas/grid/Interpolator.test.cc.o"
+  "CMakeFiles/celeritas_grid_Interpolator.dir/celeritas/grid/Interpolator.test.cc.o.d"
+  "celeritas_grid_Interpolator"
+  "celeritas_grid_Interpolator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_Interpolator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_InverseRangeCalculator.dir/celeritas/grid/InverseRangeCalculator.test.cc.o"
+  "CMakeFiles/celeritas_grid_InverseRangeCalculator.dir/celeritas/grid/InverseRangeCalculator.test.cc.o.d"
+  "celeritas_grid_InverseRangeCalculator"
+  "celeritas_grid_InverseRangeCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_InverseRangeCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_NonuniformGrid.dir/celeritas/grid/NonuniformGrid.test.cc.o"
+  "CMakeFiles/celeritas_grid_NonuniformGrid.dir/celeritas/grid/NonuniformGrid.test.cc.o.d"
+  "celeritas_grid_NonuniformGrid"
+  "celeritas_grid_NonuniformGrid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_NonuniformGrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_PolyEvaluator.dir/celeritas/grid/PolyEvaluator.test.cc.o"
+  "CMakeFiles/celeritas_grid_PolyEvaluator.dir/celeritas/grid/PolyEvaluator.test.cc.o.d"
+  "celeritas_grid_PolyEvaluator"
+  "celeritas_grid_PolyEvaluator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_PolyEvaluator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_RangeCalculator.dir/celeritas/grid/RangeCalculator.test.cc.o"
+  "CMakeFiles/celeritas_grid_RangeCalculator.dir/celeritas/grid/RangeCalculator.test.cc.o.d"
+  "celeritas_grid_RangeCalculator"
+  "celeritas_grid_RangeCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_RangeCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_TwodGridCalculator.dir/celeritas/grid/TwodGridCalculator.test.cc.o"
+  "CMakeFiles/celeritas_grid_TwodGridCalculator.dir/celeritas/grid/TwodGridCalculator.test.cc.o.d"
+  "celeritas_grid_TwodGridCalculator"
+  "celeritas_grid_TwodGridCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_TwodGridCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
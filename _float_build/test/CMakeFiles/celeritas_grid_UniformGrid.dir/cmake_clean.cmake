@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_UniformGrid.dir/celeritas/grid/UniformGrid.test.cc.o"
+  "CMakeFiles/celeritas_grid_UniformGrid.dir/celeritas/grid/UniformGrid.test.cc.o.d"
+  "celeritas_grid_UniformGrid"
+  "celeritas_grid_UniformGrid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_UniformGrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_ValueGridBuilder.dir/celeritas/grid/ValueGridBuilder.test.cc.o"
+  "CMakeFiles/celeritas_grid_ValueGridBuilder.dir/celeritas/grid/ValueGridBuilder.test.cc.o.d"
+  "celeritas_grid_ValueGridBuilder"
+  "celeritas_grid_ValueGridBuilder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_ValueGridBuilder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
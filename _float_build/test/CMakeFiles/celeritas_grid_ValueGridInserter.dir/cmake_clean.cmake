@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_ValueGridInserter.dir/celeritas/grid/ValueGridInserter.test.cc.o"
+  "CMakeFiles/celeritas_grid_ValueGridInserter.dir/celeritas/grid/ValueGridInserter.test.cc.o.d"
+  "celeritas_grid_ValueGridInserter"
+  "celeritas_grid_ValueGridInserter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_ValueGridInserter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
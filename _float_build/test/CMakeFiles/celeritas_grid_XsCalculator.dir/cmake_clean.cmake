@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_grid_XsCalculator.dir/celeritas/grid/XsCalculator.test.cc.o"
+  "CMakeFiles/celeritas_grid_XsCalculator.dir/celeritas/grid/XsCalculator.test.cc.o.d"
+  "celeritas_grid_XsCalculator"
+  "celeritas_grid_XsCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_grid_XsCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_io_SeltzerBergerReader.dir/celeritas/io/SeltzerBergerReader.test.cc.o"
+  "CMakeFiles/celeritas_io_SeltzerBergerReader.dir/celeritas/io/SeltzerBergerReader.test.cc.o.d"
+  "celeritas_io_SeltzerBergerReader"
+  "celeritas_io_SeltzerBergerReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_io_SeltzerBergerReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
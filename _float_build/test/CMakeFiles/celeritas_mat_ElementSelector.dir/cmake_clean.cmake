@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_mat_ElementSelector.dir/celeritas/mat/ElementSelector.test.cc.o"
+  "CMakeFiles/celeritas_mat_ElementSelector.dir/celeritas/mat/ElementSelector.test.cc.o.d"
+  "celeritas_mat_ElementSelector"
+  "celeritas_mat_ElementSelector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_mat_ElementSelector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
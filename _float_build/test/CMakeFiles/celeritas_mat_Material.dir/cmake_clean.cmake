@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_mat_Material.dir/celeritas/mat/Material.test.cc.o"
+  "CMakeFiles/celeritas_mat_Material.dir/celeritas/mat/Material.test.cc.o.d"
+  "celeritas_mat_Material"
+  "celeritas_mat_Material.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_mat_Material.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
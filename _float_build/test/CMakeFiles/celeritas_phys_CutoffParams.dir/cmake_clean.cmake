@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_CutoffParams.dir/celeritas/phys/CutoffParams.test.cc.o"
+  "CMakeFiles/celeritas_phys_CutoffParams.dir/celeritas/phys/CutoffParams.test.cc.o.d"
+  "celeritas_phys_CutoffParams"
+  "celeritas_phys_CutoffParams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_CutoffParams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
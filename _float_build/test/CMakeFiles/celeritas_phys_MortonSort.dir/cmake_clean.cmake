@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_MortonSort.dir/celeritas/phys/MortonSort.test.cc.o"
+  "CMakeFiles/celeritas_phys_MortonSort.dir/celeritas/phys/MortonSort.test.cc.o.d"
+  "celeritas_phys_MortonSort"
+  "celeritas_phys_MortonSort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_MortonSort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
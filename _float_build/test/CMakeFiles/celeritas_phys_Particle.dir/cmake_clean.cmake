@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_Particle.dir/celeritas/phys/Particle.test.cc.o"
+  "CMakeFiles/celeritas_phys_Particle.dir/celeritas/phys/Particle.test.cc.o.d"
+  "celeritas_phys_Particle"
+  "celeritas_phys_Particle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_Particle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_Physics.dir/celeritas/phys/Physics.test.cc.o"
+  "CMakeFiles/celeritas_phys_Physics.dir/celeritas/phys/Physics.test.cc.o.d"
+  "celeritas_phys_Physics"
+  "celeritas_phys_Physics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_Physics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_PhysicsStepUtils.dir/celeritas/phys/PhysicsStepUtils.test.cc.o"
+  "CMakeFiles/celeritas_phys_PhysicsStepUtils.dir/celeritas/phys/PhysicsStepUtils.test.cc.o.d"
+  "celeritas_phys_PhysicsStepUtils"
+  "celeritas_phys_PhysicsStepUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_PhysicsStepUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
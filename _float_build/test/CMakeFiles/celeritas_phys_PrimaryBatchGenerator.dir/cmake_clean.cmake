@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_PrimaryBatchGenerator.dir/celeritas/phys/PrimaryBatchGenerator.test.cc.o"
+  "CMakeFiles/celeritas_phys_PrimaryBatchGenerator.dir/celeritas/phys/PrimaryBatchGenerator.test.cc.o.d"
+  "celeritas_phys_PrimaryBatchGenerator"
+  "celeritas_phys_PrimaryBatchGenerator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_PrimaryBatchGenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
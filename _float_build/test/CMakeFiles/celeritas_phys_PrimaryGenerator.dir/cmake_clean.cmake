@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_phys_PrimaryGenerator.dir/celeritas/phys/PrimaryGenerator.test.cc.o"
+  "CMakeFiles/celeritas_phys_PrimaryGenerator.dir/celeritas/phys/PrimaryGenerator.test.cc.o.d"
+  "celeritas_phys_PrimaryGenerator"
+  "celeritas_phys_PrimaryGenerator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_phys_PrimaryGenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_BernoulliDistribution.dir/celeritas/random/distribution/BernoulliDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_BernoulliDistribution.dir/celeritas/random/distribution/BernoulliDistribution.test.cc.o.d"
+  "celeritas_random_BernoulliDistribution"
+  "celeritas_random_BernoulliDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_BernoulliDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_ExponentialDistribution.dir/celeritas/random/distribution/ExponentialDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_ExponentialDistribution.dir/celeritas/random/distribution/ExponentialDistribution.test.cc.o.d"
+  "celeritas_random_ExponentialDistribution"
+  "celeritas_random_ExponentialDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_ExponentialDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
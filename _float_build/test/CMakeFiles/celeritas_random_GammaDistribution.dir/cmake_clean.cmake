@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_GammaDistribution.dir/celeritas/random/distribution/GammaDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_GammaDistribution.dir/celeritas/random/distribution/GammaDistribution.test.cc.o.d"
+  "celeritas_random_GammaDistribution"
+  "celeritas_random_GammaDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_GammaDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
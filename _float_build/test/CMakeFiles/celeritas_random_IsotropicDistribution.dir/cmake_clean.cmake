@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_IsotropicDistribution.dir/celeritas/random/distribution/IsotropicDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_IsotropicDistribution.dir/celeritas/random/distribution/IsotropicDistribution.test.cc.o.d"
+  "celeritas_random_IsotropicDistribution"
+  "celeritas_random_IsotropicDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_IsotropicDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_NormalDistribution.dir/celeritas/random/distribution/NormalDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_NormalDistribution.dir/celeritas/random/distribution/NormalDistribution.test.cc.o.d"
+  "celeritas_random_NormalDistribution"
+  "celeritas_random_NormalDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_NormalDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
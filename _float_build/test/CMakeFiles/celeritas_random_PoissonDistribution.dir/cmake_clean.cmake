@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_PoissonDistribution.dir/celeritas/random/distribution/PoissonDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_PoissonDistribution.dir/celeritas/random/distribution/PoissonDistribution.test.cc.o.d"
+  "celeritas_random_PoissonDistribution"
+  "celeritas_random_PoissonDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_PoissonDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_RadialDistribution.dir/celeritas/random/distribution/RadialDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_RadialDistribution.dir/celeritas/random/distribution/RadialDistribution.test.cc.o.d"
+  "celeritas_random_RadialDistribution"
+  "celeritas_random_RadialDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_RadialDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_ReciprocalDistribution.dir/celeritas/random/distribution/ReciprocalDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_ReciprocalDistribution.dir/celeritas/random/distribution/ReciprocalDistribution.test.cc.o.d"
+  "celeritas_random_ReciprocalDistribution"
+  "celeritas_random_ReciprocalDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_ReciprocalDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_RngEngine.dir/celeritas/random/RngEngine.test.cc.o"
+  "CMakeFiles/celeritas_random_RngEngine.dir/celeritas/random/RngEngine.test.cc.o.d"
+  "celeritas_random_RngEngine"
+  "celeritas_random_RngEngine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_RngEngine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_Selector.dir/celeritas/random/Selector.test.cc.o"
+  "CMakeFiles/celeritas_random_Selector.dir/celeritas/random/Selector.test.cc.o.d"
+  "celeritas_random_Selector"
+  "celeritas_random_Selector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_Selector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
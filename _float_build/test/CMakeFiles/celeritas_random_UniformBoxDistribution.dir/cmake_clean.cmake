@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_UniformBoxDistribution.dir/celeritas/random/distribution/UniformBoxDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_UniformBoxDistribution.dir/celeritas/random/distribution/UniformBoxDistribution.test.cc.o.d"
+  "celeritas_random_UniformBoxDistribution"
+  "celeritas_random_UniformBoxDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_UniformBoxDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_UniformRealDistribution.dir/celeritas/random/distribution/UniformRealDistribution.test.cc.o"
+  "CMakeFiles/celeritas_random_UniformRealDistribution.dir/celeritas/random/distribution/UniformRealDistribution.test.cc.o.d"
+  "celeritas_random_UniformRealDistribution"
+  "celeritas_random_UniformRealDistribution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_UniformRealDistribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
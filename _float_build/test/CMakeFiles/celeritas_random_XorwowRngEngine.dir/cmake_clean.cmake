@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_random_XorwowRngEngine.dir/celeritas/random/XorwowRngEngine.test.cc.o"
+  "CMakeFiles/celeritas_random_XorwowRngEngine.dir/celeritas/random/XorwowRngEngine.test.cc.o.d"
+  "celeritas_random_XorwowRngEngine"
+  "celeritas_random_XorwowRngEngine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_random_XorwowRngEngine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/celeritas_track_TrackInit.dir/celeritas/track/TrackInit.test.cc.o"
+  "CMakeFiles/celeritas_track_TrackInit.dir/celeritas/track/TrackInit.test.cc.o.d"
+  "celeritas_track_TrackInit"
+  "celeritas_track_TrackInit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/celeritas_track_TrackInit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
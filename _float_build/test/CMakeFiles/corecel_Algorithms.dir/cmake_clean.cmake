@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Algorithms.dir/corecel/math/Algorithms.test.cc.o"
+  "CMakeFiles/corecel_Algorithms.dir/corecel/math/Algorithms.test.cc.o.d"
+  "corecel_Algorithms"
+  "corecel_Algorithms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Algorithms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
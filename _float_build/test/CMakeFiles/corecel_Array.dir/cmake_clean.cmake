@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Array.dir/corecel/cont/Array.test.cc.o"
+  "CMakeFiles/corecel_Array.dir/corecel/cont/Array.test.cc.o.d"
+  "corecel_Array"
+  "corecel_Array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
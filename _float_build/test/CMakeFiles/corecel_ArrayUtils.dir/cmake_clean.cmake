@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_ArrayUtils.dir/corecel/math/ArrayUtils.test.cc.o"
+  "CMakeFiles/corecel_ArrayUtils.dir/corecel/math/ArrayUtils.test.cc.o.d"
+  "corecel_ArrayUtils"
+  "corecel_ArrayUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_ArrayUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Collection.dir/corecel/data/Collection.test.cc.o"
+  "CMakeFiles/corecel_Collection.dir/corecel/data/Collection.test.cc.o.d"
+  "corecel_Collection"
+  "corecel_Collection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Collection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Copier.dir/corecel/data/Copier.test.cc.o"
+  "CMakeFiles/corecel_Copier.dir/corecel/data/Copier.test.cc.o.d"
+  "corecel_Copier"
+  "corecel_Copier.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Copier.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
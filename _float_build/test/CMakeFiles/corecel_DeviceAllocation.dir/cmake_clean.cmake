@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_DeviceAllocation.dir/corecel/data/DeviceAllocation.test.cc.o"
+  "CMakeFiles/corecel_DeviceAllocation.dir/corecel/data/DeviceAllocation.test.cc.o.d"
+  "corecel_DeviceAllocation"
+  "corecel_DeviceAllocation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_DeviceAllocation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_DeviceVector.dir/corecel/data/DeviceVector.test.cc.o"
+  "CMakeFiles/corecel_DeviceVector.dir/corecel/data/DeviceVector.test.cc.o.d"
+  "corecel_DeviceVector"
+  "corecel_DeviceVector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_DeviceVector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
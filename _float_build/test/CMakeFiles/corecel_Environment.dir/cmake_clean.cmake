@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Environment.dir/corecel/sys/Environment.test.cc.o"
+  "CMakeFiles/corecel_Environment.dir/corecel/sys/Environment.test.cc.o.d"
+  "corecel_Environment"
+  "corecel_Environment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Environment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
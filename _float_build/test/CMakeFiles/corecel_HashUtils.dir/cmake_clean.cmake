@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_HashUtils.dir/corecel/math/HashUtils.test.cc.o"
+  "CMakeFiles/corecel_HashUtils.dir/corecel/math/HashUtils.test.cc.o.d"
+  "corecel_HashUtils"
+  "corecel_HashUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_HashUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
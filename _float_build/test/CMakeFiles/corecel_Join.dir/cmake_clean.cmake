@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Join.dir/corecel/io/Join.test.cc.o"
+  "CMakeFiles/corecel_Join.dir/corecel/io/Join.test.cc.o.d"
+  "corecel_Join"
+  "corecel_Join.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Join.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
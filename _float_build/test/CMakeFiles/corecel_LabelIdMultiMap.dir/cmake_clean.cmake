@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_LabelIdMultiMap.dir/corecel/cont/LabelIdMultiMap.test.cc.o"
+  "CMakeFiles/corecel_LabelIdMultiMap.dir/corecel/cont/LabelIdMultiMap.test.cc.o.d"
+  "corecel_LabelIdMultiMap"
+  "corecel_LabelIdMultiMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_LabelIdMultiMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
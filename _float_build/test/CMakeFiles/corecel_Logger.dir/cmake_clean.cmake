@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Logger.dir/corecel/io/Logger.test.cc.o"
+  "CMakeFiles/corecel_Logger.dir/corecel/io/Logger.test.cc.o.d"
+  "corecel_Logger"
+  "corecel_Logger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Logger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
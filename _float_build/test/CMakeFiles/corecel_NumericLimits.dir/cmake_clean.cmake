@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_NumericLimits.dir/corecel/math/NumericLimits.test.cc.o"
+  "CMakeFiles/corecel_NumericLimits.dir/corecel/math/NumericLimits.test.cc.o.d"
+  "corecel_NumericLimits"
+  "corecel_NumericLimits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_NumericLimits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_OpaqueId.dir/corecel/OpaqueId.test.cc.o"
+  "CMakeFiles/corecel_OpaqueId.dir/corecel/OpaqueId.test.cc.o.d"
+  "corecel_OpaqueId"
+  "corecel_OpaqueId.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_OpaqueId.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
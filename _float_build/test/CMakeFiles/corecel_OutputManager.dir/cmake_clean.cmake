@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_OutputManager.dir/corecel/io/OutputManager.test.cc.o"
+  "CMakeFiles/corecel_OutputManager.dir/corecel/io/OutputManager.test.cc.o.d"
+  "corecel_OutputManager"
+  "corecel_OutputManager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_OutputManager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Quantity.dir/corecel/math/Quantity.test.cc.o"
+  "CMakeFiles/corecel_Quantity.dir/corecel/math/Quantity.test.cc.o.d"
+  "corecel_Quantity"
+  "corecel_Quantity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Quantity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
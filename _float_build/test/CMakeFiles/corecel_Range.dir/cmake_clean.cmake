@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Range.dir/corecel/cont/Range.test.cc.o"
+  "CMakeFiles/corecel_Range.dir/corecel/cont/Range.test.cc.o.d"
+  "corecel_Range"
+  "corecel_Range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Repr.dir/corecel/io/Repr.test.cc.o"
+  "CMakeFiles/corecel_Repr.dir/corecel/io/Repr.test.cc.o.d"
+  "corecel_Repr"
+  "corecel_Repr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Repr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_ScopedSignalHandler.dir/corecel/sys/ScopedSignalHandler.test.cc.o"
+  "CMakeFiles/corecel_ScopedSignalHandler.dir/corecel/sys/ScopedSignalHandler.test.cc.o.d"
+  "corecel_ScopedSignalHandler"
+  "corecel_ScopedSignalHandler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_ScopedSignalHandler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
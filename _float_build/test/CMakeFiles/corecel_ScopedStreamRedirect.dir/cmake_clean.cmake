@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_ScopedStreamRedirect.dir/corecel/sys/ScopedStreamRedirect.test.cc.o"
+  "CMakeFiles/corecel_ScopedStreamRedirect.dir/corecel/sys/ScopedStreamRedirect.test.cc.o.d"
+  "corecel_ScopedStreamRedirect"
+  "corecel_ScopedStreamRedirect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_ScopedStreamRedirect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_SoftEqual.dir/corecel/math/SoftEqual.test.cc.o"
+  "CMakeFiles/corecel_SoftEqual.dir/corecel/math/SoftEqual.test.cc.o.d"
+  "corecel_SoftEqual"
+  "corecel_SoftEqual.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_SoftEqual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Span.dir/corecel/cont/Span.test.cc.o"
+  "CMakeFiles/corecel_Span.dir/corecel/cont/Span.test.cc.o.d"
+  "corecel_Span"
+  "corecel_Span.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Span.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_StackAllocator.dir/corecel/data/StackAllocator.test.cc.o"
+  "CMakeFiles/corecel_StackAllocator.dir/corecel/data/StackAllocator.test.cc.o.d"
+  "corecel_StackAllocator"
+  "corecel_StackAllocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_StackAllocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_Stopwatch.dir/corecel/sys/Stopwatch.test.cc.o"
+  "CMakeFiles/corecel_Stopwatch.dir/corecel/sys/Stopwatch.test.cc.o.d"
+  "corecel_Stopwatch"
+  "corecel_Stopwatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_Stopwatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_StringEnumMap.dir/corecel/io/StringEnumMap.test.cc.o"
+  "CMakeFiles/corecel_StringEnumMap.dir/corecel/io/StringEnumMap.test.cc.o.d"
+  "corecel_StringEnumMap"
+  "corecel_StringEnumMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_StringEnumMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
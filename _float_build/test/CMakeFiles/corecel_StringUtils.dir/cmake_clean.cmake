@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_StringUtils.dir/corecel/io/StringUtils.test.cc.o"
+  "CMakeFiles/corecel_StringUtils.dir/corecel/io/StringUtils.test.cc.o.d"
+  "corecel_StringUtils"
+  "corecel_StringUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_StringUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
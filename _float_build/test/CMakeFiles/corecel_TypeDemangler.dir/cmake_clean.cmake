@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_TypeDemangler.dir/corecel/sys/TypeDemangler.test.cc.o"
+  "CMakeFiles/corecel_TypeDemangler.dir/corecel/sys/TypeDemangler.test.cc.o.d"
+  "corecel_TypeDemangler"
+  "corecel_TypeDemangler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_TypeDemangler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
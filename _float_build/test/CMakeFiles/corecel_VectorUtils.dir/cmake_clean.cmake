@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corecel_VectorUtils.dir/corecel/math/VectorUtils.test.cc.o"
+  "CMakeFiles/corecel_VectorUtils.dir/corecel/math/VectorUtils.test.cc.o.d"
+  "corecel_VectorUtils"
+  "corecel_VectorUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corecel_VectorUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/detail_TestMacros.dir/TestMacros.test.cc.o"
+  "CMakeFiles/detail_TestMacros.dir/TestMacros.test.cc.o.d"
+  "detail_TestMacros"
+  "detail_TestMacros.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/detail_TestMacros.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_BoundingBox.dir/orange/BoundingBox.test.cc.o"
+  "CMakeFiles/orange_BoundingBox.dir/orange/BoundingBox.test.cc.o.d"
+  "orange_BoundingBox"
+  "orange_BoundingBox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_BoundingBox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
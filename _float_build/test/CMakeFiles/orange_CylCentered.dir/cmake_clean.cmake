@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_CylCentered.dir/orange/surf/CylCentered.test.cc.o"
+  "CMakeFiles/orange_CylCentered.dir/orange/surf/CylCentered.test.cc.o.d"
+  "orange_CylCentered"
+  "orange_CylCentered.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_CylCentered.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
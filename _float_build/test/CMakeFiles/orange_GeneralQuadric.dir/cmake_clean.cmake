@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_GeneralQuadric.dir/orange/surf/GeneralQuadric.test.cc.o"
+  "CMakeFiles/orange_GeneralQuadric.dir/orange/surf/GeneralQuadric.test.cc.o.d"
+  "orange_GeneralQuadric"
+  "orange_GeneralQuadric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_GeneralQuadric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_LogicEvaluator.dir/orange/univ/detail/LogicEvaluator.test.cc.o"
+  "CMakeFiles/orange_LogicEvaluator.dir/orange/univ/detail/LogicEvaluator.test.cc.o.d"
+  "orange_LogicEvaluator"
+  "orange_LogicEvaluator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_LogicEvaluator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
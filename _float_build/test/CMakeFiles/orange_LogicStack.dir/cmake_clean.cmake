@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_LogicStack.dir/orange/univ/detail/LogicStack.test.cc.o"
+  "CMakeFiles/orange_LogicStack.dir/orange/univ/detail/LogicStack.test.cc.o.d"
+  "orange_LogicStack"
+  "orange_LogicStack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_LogicStack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
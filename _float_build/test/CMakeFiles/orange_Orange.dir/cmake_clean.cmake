@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_Orange.dir/orange/Orange.test.cc.o"
+  "CMakeFiles/orange_Orange.dir/orange/Orange.test.cc.o.d"
+  "orange_Orange"
+  "orange_Orange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_Orange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
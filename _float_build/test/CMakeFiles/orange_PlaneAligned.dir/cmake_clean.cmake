@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_PlaneAligned.dir/orange/surf/PlaneAligned.test.cc.o"
+  "CMakeFiles/orange_PlaneAligned.dir/orange/surf/PlaneAligned.test.cc.o.d"
+  "orange_PlaneAligned"
+  "orange_PlaneAligned.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_PlaneAligned.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_QuadraticSolver.dir/orange/surf/detail/QuadraticSolver.test.cc.o"
+  "CMakeFiles/orange_QuadraticSolver.dir/orange/surf/detail/QuadraticSolver.test.cc.o.d"
+  "orange_QuadraticSolver"
+  "orange_QuadraticSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_QuadraticSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
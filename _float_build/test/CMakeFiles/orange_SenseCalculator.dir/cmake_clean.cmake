@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SenseCalculator.dir/orange/univ/detail/SenseCalculator.test.cc.o"
+  "CMakeFiles/orange_SenseCalculator.dir/orange/univ/detail/SenseCalculator.test.cc.o.d"
+  "orange_SenseCalculator"
+  "orange_SenseCalculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SenseCalculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
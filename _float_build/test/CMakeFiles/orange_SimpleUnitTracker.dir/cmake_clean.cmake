@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SimpleUnitTracker.dir/orange/univ/SimpleUnitTracker.test.cc.o"
+  "CMakeFiles/orange_SimpleUnitTracker.dir/orange/univ/SimpleUnitTracker.test.cc.o.d"
+  "orange_SimpleUnitTracker"
+  "orange_SimpleUnitTracker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SimpleUnitTracker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
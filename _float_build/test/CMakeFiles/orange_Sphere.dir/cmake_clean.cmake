@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_Sphere.dir/orange/surf/Sphere.test.cc.o"
+  "CMakeFiles/orange_Sphere.dir/orange/surf/Sphere.test.cc.o.d"
+  "orange_Sphere"
+  "orange_Sphere.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_Sphere.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SphereCentered.dir/orange/surf/SphereCentered.test.cc.o"
+  "CMakeFiles/orange_SphereCentered.dir/orange/surf/SphereCentered.test.cc.o.d"
+  "orange_SphereCentered"
+  "orange_SphereCentered.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SphereCentered.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SurfaceAction.dir/orange/surf/SurfaceAction.test.cc.o"
+  "CMakeFiles/orange_SurfaceAction.dir/orange/surf/SurfaceAction.test.cc.o.d"
+  "orange_SurfaceAction"
+  "orange_SurfaceAction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SurfaceAction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SurfaceDeduplicator.dir/orange/detail/SurfaceDeduplicator.test.cc.o"
+  "CMakeFiles/orange_SurfaceDeduplicator.dir/orange/detail/SurfaceDeduplicator.test.cc.o.d"
+  "orange_SurfaceDeduplicator"
+  "orange_SurfaceDeduplicator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SurfaceDeduplicator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
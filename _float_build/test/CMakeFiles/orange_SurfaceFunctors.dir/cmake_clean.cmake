@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_SurfaceFunctors.dir/orange/univ/detail/SurfaceFunctors.test.cc.o"
+  "CMakeFiles/orange_SurfaceFunctors.dir/orange/univ/detail/SurfaceFunctors.test.cc.o.d"
+  "orange_SurfaceFunctors"
+  "orange_SurfaceFunctors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_SurfaceFunctors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orange_VolumeView.dir/orange/univ/VolumeView.test.cc.o"
+  "CMakeFiles/orange_VolumeView.dir/orange/univ/VolumeView.test.cc.o.d"
+  "orange_VolumeView"
+  "orange_VolumeView.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orange_VolumeView.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
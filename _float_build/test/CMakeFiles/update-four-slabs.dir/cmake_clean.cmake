@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/update-four-slabs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/update-four-slabs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,252 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_float_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[detail/TestMacros]=] "/root/repo/_float_build/test/detail_TestMacros")
+set_tests_properties([=[detail/TestMacros]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;114;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Array]=] "/root/repo/_float_build/test/corecel_Array")
+set_tests_properties([=[corecel/Array]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;122;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Span]=] "/root/repo/_float_build/test/corecel_Span")
+set_tests_properties([=[corecel/Span]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;123;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/LabelIdMultiMap]=] "/root/repo/_float_build/test/corecel_LabelIdMultiMap")
+set_tests_properties([=[corecel/LabelIdMultiMap]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;124;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Range]=] "/root/repo/_float_build/test/corecel_Range")
+set_tests_properties([=[corecel/Range]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;125;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Collection]=] "/root/repo/_float_build/test/corecel_Collection")
+set_tests_properties([=[corecel/Collection]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;128;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Copier]=] "/root/repo/_float_build/test/corecel_Copier")
+set_tests_properties([=[corecel/Copier]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;129;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/DeviceAllocation]=] "/root/repo/_float_build/test/corecel_DeviceAllocation")
+set_tests_properties([=[corecel/DeviceAllocation]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;130;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/DeviceVector]=] "/root/repo/_float_build/test/corecel_DeviceVector")
+set_tests_properties([=[corecel/DeviceVector]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;131;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/OpaqueId]=] "/root/repo/_float_build/test/corecel_OpaqueId")
+set_tests_properties([=[corecel/OpaqueId]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;132;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/StackAllocator]=] "/root/repo/_float_build/test/corecel_StackAllocator")
+set_tests_properties([=[corecel/StackAllocator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;133;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Join]=] "/root/repo/_float_build/test/corecel_Join")
+set_tests_properties([=[corecel/Join]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;136;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Logger]=] "/root/repo/_float_build/test/corecel_Logger")
+set_tests_properties([=[corecel/Logger]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;137;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/OutputManager]=] "/root/repo/_float_build/test/corecel_OutputManager")
+set_tests_properties([=[corecel/OutputManager]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;138;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Repr]=] "/root/repo/_float_build/test/corecel_Repr")
+set_tests_properties([=[corecel/Repr]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;139;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/StringEnumMap]=] "/root/repo/_float_build/test/corecel_StringEnumMap")
+set_tests_properties([=[corecel/StringEnumMap]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;140;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/StringUtils]=] "/root/repo/_float_build/test/corecel_StringUtils")
+set_tests_properties([=[corecel/StringUtils]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;141;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Algorithms]=] "/root/repo/_float_build/test/corecel_Algorithms")
+set_tests_properties([=[corecel/Algorithms]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;144;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/ArrayUtils]=] "/root/repo/_float_build/test/corecel_ArrayUtils")
+set_tests_properties([=[corecel/ArrayUtils]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;145;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/HashUtils]=] "/root/repo/_float_build/test/corecel_HashUtils")
+set_tests_properties([=[corecel/HashUtils]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;146;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/NumericLimits]=] "/root/repo/_float_build/test/corecel_NumericLimits")
+set_tests_properties([=[corecel/NumericLimits]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;147;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Quantity]=] "/root/repo/_float_build/test/corecel_Quantity")
+set_tests_properties([=[corecel/Quantity]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;148;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/SoftEqual]=] "/root/repo/_float_build/test/corecel_SoftEqual")
+set_tests_properties([=[corecel/SoftEqual]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;149;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/VectorUtils]=] "/root/repo/_float_build/test/corecel_VectorUtils")
+set_tests_properties([=[corecel/VectorUtils]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;150;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Environment]=] "/root/repo/_float_build/test/corecel_Environment")
+set_tests_properties([=[corecel/Environment]=] PROPERTIES  ENVIRONMENT "ENVTEST_ONE=1;ENVTEST_ZERO=0;ENVTEST_EMPTY=;CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;153;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/TypeDemangler]=] "/root/repo/_float_build/test/corecel_TypeDemangler")
+set_tests_properties([=[corecel/TypeDemangler]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;156;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/ScopedSignalHandler]=] "/root/repo/_float_build/test/corecel_ScopedSignalHandler")
+set_tests_properties([=[corecel/ScopedSignalHandler]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;157;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/ScopedStreamRedirect]=] "/root/repo/_float_build/test/corecel_ScopedStreamRedirect")
+set_tests_properties([=[corecel/ScopedStreamRedirect]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;158;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[corecel/Stopwatch]=] "/root/repo/_float_build/test/corecel_Stopwatch")
+set_tests_properties([=[corecel/Stopwatch]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "nomemcheck" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;159;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/BoundingBox]=] "/root/repo/_float_build/test/orange_BoundingBox")
+set_tests_properties([=[orange/BoundingBox]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;176;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/QuadraticSolver]=] "/root/repo/_float_build/test/orange_QuadraticSolver")
+set_tests_properties([=[orange/QuadraticSolver]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;179;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/CylCentered]=] "/root/repo/_float_build/test/orange_CylCentered")
+set_tests_properties([=[orange/CylCentered]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;180;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/GeneralQuadric]=] "/root/repo/_float_build/test/orange_GeneralQuadric")
+set_tests_properties([=[orange/GeneralQuadric]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;181;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/PlaneAligned]=] "/root/repo/_float_build/test/orange_PlaneAligned")
+set_tests_properties([=[orange/PlaneAligned]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;182;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/Sphere]=] "/root/repo/_float_build/test/orange_Sphere")
+set_tests_properties([=[orange/Sphere]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;183;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SphereCentered]=] "/root/repo/_float_build/test/orange_SphereCentered")
+set_tests_properties([=[orange/SphereCentered]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;184;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SurfaceAction]=] "/root/repo/_float_build/test/orange_SurfaceAction")
+set_tests_properties([=[orange/SurfaceAction]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;185;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SurfaceDeduplicator]=] "/root/repo/_float_build/test/orange_SurfaceDeduplicator")
+set_tests_properties([=[orange/SurfaceDeduplicator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;188;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/LogicEvaluator]=] "/root/repo/_float_build/test/orange_LogicEvaluator")
+set_tests_properties([=[orange/LogicEvaluator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;191;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/LogicStack]=] "/root/repo/_float_build/test/orange_LogicStack")
+set_tests_properties([=[orange/LogicStack]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;192;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SurfaceFunctors]=] "/root/repo/_float_build/test/orange_SurfaceFunctors")
+set_tests_properties([=[orange/SurfaceFunctors]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;193;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SenseCalculator]=] "/root/repo/_float_build/test/orange_SenseCalculator")
+set_tests_properties([=[orange/SenseCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;197;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/VolumeView]=] "/root/repo/_float_build/test/orange_VolumeView")
+set_tests_properties([=[orange/VolumeView]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;198;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/SimpleUnitTracker]=] "/root/repo/_float_build/test/orange_SimpleUnitTracker")
+set_tests_properties([=[orange/SimpleUnitTracker]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;199;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[orange/Orange]=] "/root/repo/_float_build/test/orange_Orange")
+set_tests_properties([=[orange/Orange]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;200;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/Constants]=] "/root/repo/_float_build/test/celeritas_Constants")
+set_tests_properties([=[celeritas/Constants]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;228;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/BetheHeitler]=] "/root/repo/_float_build/test/celeritas_em_BetheHeitler")
+set_tests_properties([=[celeritas/em/BetheHeitler]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;233;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/CombinedBrem]=] "/root/repo/_float_build/test/celeritas_em_CombinedBrem")
+set_tests_properties([=[celeritas/em/CombinedBrem]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;234;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/EPlusGG]=] "/root/repo/_float_build/test/celeritas_em_EPlusGG")
+set_tests_properties([=[celeritas/em/EPlusGG]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;235;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/EmStandardInteractAction]=] "/root/repo/_float_build/test/celeritas_em_EmStandardInteractAction")
+set_tests_properties([=[celeritas/em/EmStandardInteractAction]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;236;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/Fluctuation]=] "/root/repo/_float_build/test/celeritas_em_Fluctuation")
+set_tests_properties([=[celeritas/em/Fluctuation]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;237;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/KleinNishina]=] "/root/repo/_float_build/test/celeritas_em_KleinNishina")
+set_tests_properties([=[celeritas/em/KleinNishina]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;238;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/LivermorePE]=] "/root/repo/_float_build/test/celeritas_em_LivermorePE")
+set_tests_properties([=[celeritas/em/LivermorePE]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;239;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/MollerBhabha]=] "/root/repo/_float_build/test/celeritas_em_MollerBhabha")
+set_tests_properties([=[celeritas/em/MollerBhabha]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;240;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/MuBremsstrahlung]=] "/root/repo/_float_build/test/celeritas_em_MuBremsstrahlung")
+set_tests_properties([=[celeritas/em/MuBremsstrahlung]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;241;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/NativeEmTableBuilder]=] "/root/repo/_float_build/test/celeritas_em_NativeEmTableBuilder")
+set_tests_properties([=[celeritas/em/NativeEmTableBuilder]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;242;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/Rayleigh]=] "/root/repo/_float_build/test/celeritas_em_Rayleigh")
+set_tests_properties([=[celeritas/em/Rayleigh]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;243;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/RelativisticBrem]=] "/root/repo/_float_build/test/celeritas_em_RelativisticBrem")
+set_tests_properties([=[celeritas/em/RelativisticBrem]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;244;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/SeltzerBerger]=] "/root/repo/_float_build/test/celeritas_em_SeltzerBerger")
+set_tests_properties([=[celeritas/em/SeltzerBerger]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;245;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/TsaiUrbanDistribution]=] "/root/repo/_float_build/test/celeritas_em_TsaiUrbanDistribution")
+set_tests_properties([=[celeritas/em/TsaiUrbanDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;246;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/ImportedProcesses]=] "/root/repo/_float_build/test/celeritas_em_ImportedProcesses")
+set_tests_properties([=[celeritas/em/ImportedProcesses]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;248;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/em/UrbanMsc]=] "/root/repo/_float_build/test/celeritas_em_UrbanMsc")
+set_tests_properties([=[celeritas/em/UrbanMsc]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;251;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/ext/EventReader]=] "/root/repo/_float_build/test/celeritas_ext_EventReader")
+set_tests_properties([=[celeritas/ext/EventReader]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;264;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/ext/GeantImporter]=] "/root/repo/_float_build/test/celeritas_ext_GeantImporter")
+set_tests_properties([=[celeritas/ext/GeantImporter]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;265;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/ext/MpiCommunicator]=] "/root/repo/_float_build/test/celeritas_ext_MpiCommunicator")
+set_tests_properties([=[celeritas/ext/MpiCommunicator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;267;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/ext/RootImporter]=] "/root/repo/_float_build/test/celeritas_ext_RootImporter")
+set_tests_properties([=[celeritas/ext/RootImporter]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;269;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/Fields]=] "/root/repo/_float_build/test/celeritas_field_Fields")
+set_tests_properties([=[celeritas/field/Fields]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;276;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/Steppers]=] "/root/repo/_float_build/test/celeritas_field_Steppers")
+set_tests_properties([=[celeritas/field/Steppers]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;281;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/FieldDriver]=] "/root/repo/_float_build/test/celeritas_field_FieldDriver")
+set_tests_properties([=[celeritas/field/FieldDriver]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;282;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/FieldRegion]=] "/root/repo/_float_build/test/celeritas_field_FieldRegion")
+set_tests_properties([=[celeritas/field/FieldRegion]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;283;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/FieldPropagator]=] "/root/repo/_float_build/test/celeritas_field_FieldPropagator")
+set_tests_properties([=[celeritas/field/FieldPropagator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;284;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/LinearPropagator]=] "/root/repo/_float_build/test/celeritas_field_LinearPropagator")
+set_tests_properties([=[celeritas/field/LinearPropagator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;285;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/field/MagFieldEquation]=] "/root/repo/_float_build/test/celeritas_field_MagFieldEquation")
+set_tests_properties([=[celeritas/field/MagFieldEquation]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;286;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/geo/Geometry]=] "/root/repo/_float_build/test/celeritas_geo_Geometry")
+set_tests_properties([=[celeritas/geo/Geometry]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;303;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/geo/GeoMaterial]=] "/root/repo/_float_build/test/celeritas_geo_GeoMaterial")
+set_tests_properties([=[celeritas/geo/GeoMaterial]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;305;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/ActionRegistry]=] "/root/repo/_float_build/test/celeritas_global_ActionRegistry")
+set_tests_properties([=[celeritas/global/ActionRegistry]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;312;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/ActionSequence]=] "/root/repo/_float_build/test/celeritas_global_ActionSequence")
+set_tests_properties([=[celeritas/global/ActionSequence]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;313;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/AlongStep]=] "/root/repo/_float_build/test/celeritas_global_AlongStep")
+set_tests_properties([=[celeritas/global/AlongStep]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;314;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/Benchmark:SimpleBenchmark*]=] "/root/repo/_float_build/test/celeritas_global_Benchmark" "--gtest_filter=SimpleBenchmark*")
+set_tests_properties([=[celeritas/global/Benchmark:SimpleBenchmark*]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;329;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/Benchmark:SecondaryAllocBenchmark*]=] "/root/repo/_float_build/test/celeritas_global_Benchmark" "--gtest_filter=SecondaryAllocBenchmark*")
+set_tests_properties([=[celeritas/global/Benchmark:SecondaryAllocBenchmark*]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;329;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/BatchNavigation]=] "/root/repo/_float_build/test/celeritas_global_BatchNavigation")
+set_tests_properties([=[celeritas/global/BatchNavigation]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;335;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/EnergyMonitor]=] "/root/repo/_float_build/test/celeritas_global_EnergyMonitor")
+set_tests_properties([=[celeritas/global/EnergyMonitor]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;336;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/EventTally]=] "/root/repo/_float_build/test/celeritas_global_EventTally")
+set_tests_properties([=[celeritas/global/EventTally]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;337;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/Stepper:TestEm3*]=] "/root/repo/_float_build/test/celeritas_global_Stepper" "--gtest_filter=TestEm3*")
+set_tests_properties([=[celeritas/global/Stepper:TestEm3*]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;338;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/Stepper:TestEm15FieldTest.*]=] "/root/repo/_float_build/test/celeritas_global_Stepper" "--gtest_filter=TestEm15FieldTest.*")
+set_tests_properties([=[celeritas/global/Stepper:TestEm15FieldTest.*]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;338;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/TrackSlotPolicy]=] "/root/repo/_float_build/test/celeritas_global_TrackSlotPolicy")
+set_tests_properties([=[celeritas/global/TrackSlotPolicy]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;345;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/global/VolumeProfiler]=] "/root/repo/_float_build/test/celeritas_global_VolumeProfiler")
+set_tests_properties([=[celeritas/global/VolumeProfiler]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;346;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/GenericXsCalculator]=] "/root/repo/_float_build/test/celeritas_grid_GenericXsCalculator")
+set_tests_properties([=[celeritas/grid/GenericXsCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;351;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/GridIdFinder]=] "/root/repo/_float_build/test/celeritas_grid_GridIdFinder")
+set_tests_properties([=[celeritas/grid/GridIdFinder]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;352;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/Interpolator]=] "/root/repo/_float_build/test/celeritas_grid_Interpolator")
+set_tests_properties([=[celeritas/grid/Interpolator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;353;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/InverseRangeCalculator]=] "/root/repo/_float_build/test/celeritas_grid_InverseRangeCalculator")
+set_tests_properties([=[celeritas/grid/InverseRangeCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;354;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/NonuniformGrid]=] "/root/repo/_float_build/test/celeritas_grid_NonuniformGrid")
+set_tests_properties([=[celeritas/grid/NonuniformGrid]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;355;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/PolyEvaluator]=] "/root/repo/_float_build/test/celeritas_grid_PolyEvaluator")
+set_tests_properties([=[celeritas/grid/PolyEvaluator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;356;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/RangeCalculator]=] "/root/repo/_float_build/test/celeritas_grid_RangeCalculator")
+set_tests_properties([=[celeritas/grid/RangeCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;357;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/TwodGridCalculator]=] "/root/repo/_float_build/test/celeritas_grid_TwodGridCalculator")
+set_tests_properties([=[celeritas/grid/TwodGridCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;358;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/UniformGrid]=] "/root/repo/_float_build/test/celeritas_grid_UniformGrid")
+set_tests_properties([=[celeritas/grid/UniformGrid]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;359;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/ValueGridBuilder]=] "/root/repo/_float_build/test/celeritas_grid_ValueGridBuilder")
+set_tests_properties([=[celeritas/grid/ValueGridBuilder]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;360;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/ValueGridInserter]=] "/root/repo/_float_build/test/celeritas_grid_ValueGridInserter")
+set_tests_properties([=[celeritas/grid/ValueGridInserter]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;361;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/grid/XsCalculator]=] "/root/repo/_float_build/test/celeritas_grid_XsCalculator")
+set_tests_properties([=[celeritas/grid/XsCalculator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;362;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/io/SeltzerBergerReader]=] "/root/repo/_float_build/test/celeritas_io_SeltzerBergerReader")
+set_tests_properties([=[celeritas/io/SeltzerBergerReader]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;367;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/mat/ElementSelector]=] "/root/repo/_float_build/test/celeritas_mat_ElementSelector")
+set_tests_properties([=[celeritas/mat/ElementSelector]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;372;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/mat/Material]=] "/root/repo/_float_build/test/celeritas_mat_Material")
+set_tests_properties([=[celeritas/mat/Material]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;373;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/CutoffParams]=] "/root/repo/_float_build/test/celeritas_phys_CutoffParams")
+set_tests_properties([=[celeritas/phys/CutoffParams]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;379;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/MortonSort]=] "/root/repo/_float_build/test/celeritas_phys_MortonSort")
+set_tests_properties([=[celeritas/phys/MortonSort]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;381;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/Particle]=] "/root/repo/_float_build/test/celeritas_phys_Particle")
+set_tests_properties([=[celeritas/phys/Particle]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;382;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/Physics]=] "/root/repo/_float_build/test/celeritas_phys_Physics")
+set_tests_properties([=[celeritas/phys/Physics]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;384;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/PhysicsStepUtils]=] "/root/repo/_float_build/test/celeritas_phys_PhysicsStepUtils")
+set_tests_properties([=[celeritas/phys/PhysicsStepUtils]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;385;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/PrimaryBatchGenerator]=] "/root/repo/_float_build/test/celeritas_phys_PrimaryBatchGenerator")
+set_tests_properties([=[celeritas/phys/PrimaryBatchGenerator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;386;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/phys/PrimaryGenerator]=] "/root/repo/_float_build/test/celeritas_phys_PrimaryGenerator")
+set_tests_properties([=[celeritas/phys/PrimaryGenerator]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;387;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/RngEngine]=] "/root/repo/_float_build/test/celeritas_random_RngEngine")
+set_tests_properties([=[celeritas/random/RngEngine]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;393;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/Selector]=] "/root/repo/_float_build/test/celeritas_random_Selector")
+set_tests_properties([=[celeritas/random/Selector]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;394;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/XorwowRngEngine]=] "/root/repo/_float_build/test/celeritas_random_XorwowRngEngine")
+set_tests_properties([=[celeritas/random/XorwowRngEngine]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;395;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/BernoulliDistribution]=] "/root/repo/_float_build/test/celeritas_random_BernoulliDistribution")
+set_tests_properties([=[celeritas/random/BernoulliDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;397;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/ExponentialDistribution]=] "/root/repo/_float_build/test/celeritas_random_ExponentialDistribution")
+set_tests_properties([=[celeritas/random/ExponentialDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;398;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/GammaDistribution]=] "/root/repo/_float_build/test/celeritas_random_GammaDistribution")
+set_tests_properties([=[celeritas/random/GammaDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;399;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/IsotropicDistribution]=] "/root/repo/_float_build/test/celeritas_random_IsotropicDistribution")
+set_tests_properties([=[celeritas/random/IsotropicDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;400;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/NormalDistribution]=] "/root/repo/_float_build/test/celeritas_random_NormalDistribution")
+set_tests_properties([=[celeritas/random/NormalDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;401;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/PoissonDistribution]=] "/root/repo/_float_build/test/celeritas_random_PoissonDistribution")
+set_tests_properties([=[celeritas/random/PoissonDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;402;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/RadialDistribution]=] "/root/repo/_float_build/test/celeritas_random_RadialDistribution")
+set_tests_properties([=[celeritas/random/RadialDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;403;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/ReciprocalDistribution]=] "/root/repo/_float_build/test/celeritas_random_ReciprocalDistribution")
+set_tests_properties([=[celeritas/random/ReciprocalDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;404;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/UniformBoxDistribution]=] "/root/repo/_float_build/test/celeritas_random_UniformBoxDistribution")
+set_tests_properties([=[celeritas/random/UniformBoxDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;405;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/random/UniformRealDistribution]=] "/root/repo/_float_build/test/celeritas_random_UniformRealDistribution")
+set_tests_properties([=[celeritas/random/UniformRealDistribution]=] PROPERTIES  ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;406;celeritas_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[celeritas/track/TrackInit]=] "/root/repo/_float_build/test/celeritas_track_TrackInit")
+set_tests_properties([=[celeritas/track/TrackInit]=] PROPERTIES  DISABLED "TRUE" ENVIRONMENT "CELER_LOG=debug;CELER_LOG_LOCAL=diagnostic" FAIL_REGULAR_EXPRESSION "tests FAILED" LABELS "unit" PASS_REGULAR_EXPRESSION "tests PASSED" _BACKTRACE_TRIPLES "/root/repo/cmake/CeleritasAddTest.cmake;423;add_test;/root/repo/test/CMakeLists.txt;73;celeritas_add_test;/root/repo/test/CMakeLists.txt;419;celeritas_device_test;/root/repo/test/CMakeLists.txt;0;")
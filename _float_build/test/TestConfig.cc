@@ -0,0 +1,21 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020-2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file testdetail/TestConfig.cc
+//---------------------------------------------------------------------------//
+
+#include "testdetail/TestConfig.hh"
+
+namespace celeritas
+{
+namespace testdetail
+{
+//---------------------------------------------------------------------------//
+
+extern const char source_dir[] = "/root/repo";
+
+//---------------------------------------------------------------------------//
+} // namespace testdetail
+} // namespace celeritas
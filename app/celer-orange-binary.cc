@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celer-orange-binary.cc
+//! Convert an ORANGE JSON geometry to binary and compare load times.
+//---------------------------------------------------------------------------//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "orange/OrangeParams.hh"
+#include "celeritas/ext/MpiCommunicator.hh"
+#include "celeritas/ext/ScopedMpiInit.hh"
+
+using namespace celeritas;
+using std::cout;
+using std::endl;
+
+namespace
+{
+void print_usage(const char* exec_name)
+{
+    cout << "Usage: " << exec_name
+         << " input.org.json output.org.bin [num_repetitions]" << endl;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build an ORANGE geometry from JSON, write it as binary, and time reloading.
+ *
+ * The load time for each format is averaged over the given number of
+ * repetitions (default 1) and printed as a markdown table.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && MpiCommunicator::comm_world().size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    if (args.size() == 1 && (args.front() == "--help" || args.front() == "-h"))
+    {
+        print_usage(argv[0]);
+        return 0;
+    }
+    if (args.size() < 2 || args.size() > 3)
+    {
+        // Incorrect number of arguments: print help and exit
+        print_usage(argv[0]);
+        return 2;
+    }
+    const std::string& json_filename   = args[0];
+    const std::string& binary_filename = args[1];
+    int num_repetitions = (args.size() == 3 ? std::stoi(args[2]) : 1);
+    if (num_repetitions < 1)
+    {
+        CELER_LOG(critical) << "Invalid number of repetitions";
+        return 2;
+    }
+
+    try
+    {
+        double json_time   = 0;
+        double binary_time = 0;
+        for (int i = 0; i < num_repetitions; ++i)
+        {
+            Stopwatch    get_time;
+            OrangeParams geo(json_filename);
+            json_time += get_time();
+            if (i == 0)
+            {
+                geo.write_binary(binary_filename);
+            }
+        }
+        for (int i = 0; i < num_repetitions; ++i)
+        {
+            Stopwatch    get_time;
+            OrangeParams geo(binary_filename);
+            binary_time += get_time();
+        }
+        json_time /= num_repetitions;
+        binary_time /= num_repetitions;
+
+        cout << "| Format | Load time [s] |\n"
+             << "| ------ | ------------- |\n"
+             << "| JSON   | " << std::setw(13) << json_time << " |\n"
+             << "| Binary | " << std::setw(13) << binary_time << " |\n"
+             << endl;
+        CELER_LOG(info) << "Binary loading is " << json_time / binary_time
+                        << "x faster than JSON";
+    }
+    catch (const RuntimeError& e)
+    {
+        CELER_LOG(critical) << "Runtime error: " << e.what();
+        return EXIT_FAILURE;
+    }
+    catch (const DebugError& e)
+    {
+        CELER_LOG(critical) << "Assertion failure: " << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -37,10 +37,11 @@ struct KNDemoRunArgs
 struct KNDemoResult
 {
     using size_type = celeritas::size_type;
+    using real_type = celeritas::real_type;
 
     std::vector<double>    time;  //!< Real time per step
     std::vector<size_type> alive; //!< Num living tracks per step
-    std::vector<double>    edep;  //!< Energy deposition along the grid
+    std::vector<real_type> edep;  //!< Energy deposition along the grid
     double                 total_time = 0; //!< All time
 };
 
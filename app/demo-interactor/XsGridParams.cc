@@ -31,7 +31,8 @@ namespace
 bool is_same_log_grid(const celeritas::UniformGridData&        grid,
                       const std::vector<celeritas::real_type>& energy)
 {
-    celeritas::SoftEqual<> soft_eq(1e-8);
+    celeritas::SoftEqual<> soft_eq(
+        CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-8 : 1e-5);
     celeritas::UniformGrid log_energy(grid);
     if (log_energy.size() != energy.size())
     {
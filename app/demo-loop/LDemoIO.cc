@@ -13,15 +13,19 @@
 
 #include "corecel/cont/Array.json.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/io/StringEnumMap.hh"
 #include "corecel/io/StringUtils.hh"
+#include "celeritas/em/generated/EmStandardInteractAction.hh"
 #include "celeritas/ext/GeantImporter.hh"
 #include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/ext/RootImporter.hh"
 #include "celeritas/field/FieldDriverOptionsIO.json.hh"
+#include "celeritas/field/FieldRegionParams.hh"
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/VolumeProfilerAction.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/io/ImportData.hh"
@@ -118,6 +122,10 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     if (v.mag_field != LDemoArgs::no_field())
     {
         j["field_options"] = v.field_options;
+        if (!v.field_free_volumes.empty())
+        {
+            j["field_free_volumes"] = v.field_free_volumes;
+        }
     }
     if (v.enable_diagnostics)
     {
@@ -127,6 +135,34 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     {
         j["step_limiter"] = v.step_limiter;
     }
+    if (v.volume_hotspots > 0)
+    {
+        j["volume_hotspots"] = v.volume_hotspots;
+    }
+    if (v.enable_event_results)
+    {
+        j["enable_event_results"] = v.enable_event_results;
+    }
+    if (v.native_em_tables)
+    {
+        j["native_em_tables"] = v.native_em_tables;
+    }
+    if (v.msc_step_limit != MscStepLimitAlgorithm::safety)
+    {
+        j["msc_step_limit"] = to_cstring(v.msc_step_limit);
+    }
+    if (v.transparent_boundaries)
+    {
+        j["transparent_boundaries"] = v.transparent_boundaries;
+    }
+    if (v.navigation_batch_size)
+    {
+        j["navigation_batch_size"] = v.navigation_batch_size;
+    }
+    if (v.plan)
+    {
+        j["plan"] = v.plan;
+    }
     if (ends_with(v.physics_filename, ".gdml"))
     {
         j["geant_options"] = v.geant_options;
@@ -139,6 +175,26 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     {
         j["hepmc3_filename"] = v.hepmc3_filename;
     }
+    if (v.sort_primaries)
+    {
+        j["sort_primaries"] = v.sort_primaries;
+    }
+    if (v.secondary_chunk_size > 0)
+    {
+        j["secondary_chunk_size"] = v.secondary_chunk_size;
+    }
+    if (v.concurrent_actions)
+    {
+        j["concurrent_actions"] = v.concurrent_actions;
+    }
+    if (v.fused_interact)
+    {
+        j["fused_interact"] = v.fused_interact;
+    }
+    if (v.init_policy != TrackInitPolicy::lifo)
+    {
+        j["init_policy"] = to_cstring(v.init_policy);
+    }
 }
 
 void from_json(const nlohmann::json& j, LDemoArgs& v)
@@ -156,6 +212,10 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     CELER_VALIDATE(v.hepmc3_filename.empty() != !v.primary_gen_options,
                    << "either a HepMC3 filename or options to generate "
                       "primaries must be provided (but not both)");
+    if (j.contains("sort_primaries"))
+    {
+        j.at("sort_primaries").get_to(v.sort_primaries);
+    }
 
     j.at("seed").get_to(v.seed);
     j.at("max_num_tracks").get_to(v.max_num_tracks);
@@ -165,9 +225,28 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     }
     j.at("initializer_capacity").get_to(v.initializer_capacity);
     j.at("secondary_stack_factor").get_to(v.secondary_stack_factor);
+    if (j.contains("secondary_chunk_size"))
+    {
+        j.at("secondary_chunk_size").get_to(v.secondary_chunk_size);
+    }
     j.at("enable_diagnostics").get_to(v.enable_diagnostics);
     j.at("use_device").get_to(v.use_device);
     j.at("sync").get_to(v.sync);
+    if (j.contains("concurrent_actions"))
+    {
+        j.at("concurrent_actions").get_to(v.concurrent_actions);
+    }
+    if (j.contains("fused_interact"))
+    {
+        j.at("fused_interact").get_to(v.fused_interact);
+    }
+    if (j.contains("init_policy"))
+    {
+        static auto from_string
+            = StringEnumMap<TrackInitPolicy>::from_cstring_func(
+                to_cstring, "track initializer policy");
+        v.init_policy = from_string(j.at("init_policy").get<std::string>());
+    }
     if (j.contains("mag_field"))
     {
         j.at("mag_field").get_to(v.mag_field);
@@ -176,17 +255,54 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     {
         j.at("field_options").get_to(v.field_options);
     }
+    if (v.mag_field != LDemoArgs::no_field()
+        && j.contains("field_free_volumes"))
+    {
+        j.at("field_free_volumes").get_to(v.field_free_volumes);
+    }
     if (j.contains("step_limiter"))
     {
         j.at("step_limiter").get_to(v.step_limiter);
     }
 
     j.at("brem_combined").get_to(v.brem_combined);
+    if (j.contains("native_em_tables"))
+    {
+        j.at("native_em_tables").get_to(v.native_em_tables);
+    }
+    if (j.contains("msc_step_limit"))
+    {
+        static auto from_string
+            = StringEnumMap<MscStepLimitAlgorithm>::from_cstring_func(
+                to_cstring, "MSC step limitation algorithm");
+        v.msc_step_limit
+            = from_string(j.at("msc_step_limit").get<std::string>());
+    }
+    if (j.contains("transparent_boundaries"))
+    {
+        j.at("transparent_boundaries").get_to(v.transparent_boundaries);
+    }
+    if (j.contains("navigation_batch_size"))
+    {
+        j.at("navigation_batch_size").get_to(v.navigation_batch_size);
+    }
 
     if (j.contains("energy_diag"))
     {
         j.at("energy_diag").get_to(v.energy_diag);
     }
+    if (j.contains("volume_hotspots"))
+    {
+        j.at("volume_hotspots").get_to(v.volume_hotspots);
+    }
+    if (j.contains("enable_event_results"))
+    {
+        j.at("enable_event_results").get_to(v.enable_event_results);
+    }
+    if (j.contains("plan"))
+    {
+        j.at("plan").get_to(v.plan);
+    }
 
     if (j.contains("geant_options"))
     {
@@ -295,11 +411,14 @@ TransporterInput load_input(const LDemoArgs& args)
         input.materials                      = params.material;
         input.options.fixed_step_limiter     = args.step_limiter;
         input.options.secondary_stack_factor = args.secondary_stack_factor;
+        input.options.secondary_chunk_size   = args.secondary_chunk_size;
         input.action_registry                = params.action_reg.get();
 
         {
             ProcessBuilder::Options opts;
-            opts.brem_combined = args.brem_combined;
+            opts.brem_combined    = args.brem_combined;
+            opts.native_em_tables = args.native_em_tables;
+            opts.msc_step_limit   = args.msc_step_limit;
 
             ProcessBuilder build_process(
                 imported_data, opts, params.particle, params.material);
@@ -351,8 +470,19 @@ TransporterInput load_input(const LDemoArgs& args)
             f *= units::tesla;
         }
 
-        auto along_step = AlongStepUniformMscAction::from_params(
-            *params.physics, field_params, params.action_reg.get());
+        std::shared_ptr<const FieldRegionParams> field_region;
+        if (!args.field_free_volumes.empty())
+        {
+            field_region = std::make_shared<FieldRegionParams>(
+                FieldRegionParams::field_free_volumes(
+                    *params.geometry, args.field_free_volumes));
+        }
+
+        auto along_step
+            = AlongStepUniformMscAction::from_params(*params.physics,
+                                                     field_params,
+                                                     params.action_reg.get(),
+                                                     std::move(field_region));
         CELER_ASSERT(along_step->field() != LDemoArgs::no_field());
         params.along_step = std::move(along_step);
     }
@@ -362,6 +492,26 @@ TransporterInput load_input(const LDemoArgs& args)
         params.rng = std::make_shared<RngParams>(args.seed);
     }
 
+    params.transparent_boundaries = args.transparent_boundaries;
+    params.navigation_batch_size  = args.navigation_batch_size;
+
+    // Run the standard EM interactions in a single statically composed action
+    if (args.fused_interact)
+    {
+        params.action_reg->insert(
+            std::make_shared<generated::EmStandardInteractAction>(
+                params.action_reg->next_id(), *params.physics));
+    }
+
+    // Create optional per-volume profiler
+    if (args.volume_hotspots > 0)
+    {
+        VolumeProfilerAction::Input input;
+        input.memspace = args.use_device ? MemSpace::device : MemSpace::host;
+        VolumeProfilerAction::from_params(
+            *params.geometry, input, params.action_reg.get());
+    }
+
     // Create params
     CELER_ASSERT(params);
     result.params = std::make_shared<CoreParams>(std::move(params));
@@ -374,11 +524,15 @@ TransporterInput load_input(const LDemoArgs& args)
                    << args.initializer_capacity);
     CELER_VALIDATE(args.max_steps > 0,
                    << "nonpositive max_steps=" << args.max_steps);
-    result.num_track_slots    = args.max_num_tracks;
-    result.num_initializers   = args.initializer_capacity;
-    result.max_steps          = args.max_steps;
-    result.enable_diagnostics = args.enable_diagnostics;
-    result.sync               = args.sync;
+    result.num_track_slots      = args.max_num_tracks;
+    result.num_initializers     = args.initializer_capacity;
+    result.max_steps            = args.max_steps;
+    result.enable_diagnostics   = args.enable_diagnostics;
+    result.enable_event_results = args.enable_event_results;
+    result.sync                 = args.sync;
+    result.concurrent_actions   = args.concurrent_actions;
+    result.init_policy          = args.init_policy;
+    result.count_secondaries    = static_cast<bool>(args.plan);
 
     // Save diagnosics
     result.energy_diag = args.energy_diag;
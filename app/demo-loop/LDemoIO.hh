@@ -8,15 +8,18 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 
 #include "corecel/Types.hh"
 #include "corecel/math/NumericLimits.hh"
+#include "celeritas/Types.hh"
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/field/FieldDriverOptions.hh"
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
 
+#include "TrackPlanner.hh"
 #include "Transporter.hh"
 
 namespace demo_loop
@@ -41,19 +44,29 @@ struct LDemoArgs
     // Optional setup options for generating primaries programmatically
     celeritas::PrimaryGeneratorOptions primary_gen_options;
 
+    // Sort primaries by starting position before transport
+    bool sort_primaries{false};
+
     // Control
     unsigned int seed{};
     size_type    max_num_tracks{};
     size_type    max_steps = TransporterInput::no_max_steps();
     size_type    initializer_capacity{};
     real_type    secondary_stack_factor{};
+    size_type    secondary_chunk_size{};
     bool         enable_diagnostics{};
+    bool         enable_event_results{};
     bool         use_device{};
     bool         sync{};
+    bool         concurrent_actions{};
+    bool         fused_interact{};
+    celeritas::TrackInitPolicy init_policy{celeritas::TrackInitPolicy::lifo};
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3                         mag_field{no_field()};
     celeritas::FieldDriverOptions field_options;
+    // Volumes in which charged particles ignore the magnetic field
+    std::vector<std::string> field_free_volumes;
 
     // Optional fixed-size step limiter for charged particles
     // (non-positive for unused)
@@ -61,10 +74,25 @@ struct LDemoArgs
 
     // Options for physics
     bool brem_combined{true};
+    bool native_em_tables{false};
+    celeritas::MscStepLimitAlgorithm msc_step_limit{
+        celeritas::MscStepLimitAlgorithm::safety};
+
+    // Don't stop neutral particles at boundaries between identical materials
+    bool transparent_boundaries{false};
+    // Group neutral host tracks by volume for VecGeom navigation (zero to
+    // disable)
+    size_type navigation_batch_size{0};
 
     // Diagnostic input
     EnergyDiagInput energy_diag;
 
+    // Number of most-stepped volumes to report (zero to disable profiling)
+    size_type volume_hotspots{};
+
+    // Optional track population planning from a sample of events
+    TrackPlanInput plan;
+
     // Optional setup options if loading directly from Geant4
     celeritas::GeantPhysicsOptions geant_options;
 
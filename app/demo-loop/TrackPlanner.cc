@@ -0,0 +1,258 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/TrackPlanner.cc
+//---------------------------------------------------------------------------//
+#include "TrackPlanner.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/Secondary.hh"
+#include "celeritas/track/TrackInitData.hh"
+
+#if CELERITAS_USE_VECGEOM
+#    include <VecGeom/navigation/NavigationState.h>
+#endif
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Multiply a count by a factor and round up
+size_type scale_count(size_type count, double factor)
+{
+    return static_cast<size_type>(std::ceil(count * factor));
+}
+
+//---------------------------------------------------------------------------//
+//! Total bytes stored in a set of collections
+std::size_t sum_bytes()
+{
+    return 0;
+}
+
+template<class T, Ownership W, MemSpace M, class I, class... Rest>
+std::size_t
+sum_bytes(const Collection<T, W, M, I>& first, const Rest&... rest)
+{
+    return first.size() * sizeof(T) + sum_bytes(rest...);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the core state memory for a single track slot.
+ *
+ * This allocates host states for a block of track slots and sums the sizes of
+ * their collections. The secondary stack is excluded since its size is one of
+ * the planned quantities, and the per-slot initializer data (parents,
+ * secondary counts, and vacancies) is added. The VecGeom navigation states
+ * are counted at their device size.
+ */
+std::size_t measure_track_bytes(const CoreParams& params)
+{
+    constexpr size_type num_tracks = 64;
+
+    CollectionStateStore<CoreStateData, MemSpace::host> store(
+        params.host_ref(), num_tracks);
+    const auto& s = store.ref();
+
+    std::size_t result = 0;
+#if CELERITAS_USE_VECGEOM
+    result += sum_bytes(s.geometry.pos, s.geometry.dir, s.geometry.next_step);
+    result += 2 * num_tracks
+              * vecgeom::NavigationState::SizeOfInstance(
+                  params.geometry()->max_depth());
+#else
+    result += sum_bytes(s.geometry.pos,
+                        s.geometry.dir,
+                        s.geometry.vol,
+                        s.geometry.surf,
+                        s.geometry.sense,
+                        s.geometry.boundary,
+                        s.geometry.next_step,
+                        s.geometry.next_surf,
+                        s.geometry.next_sense,
+                        s.geometry.temp_sense,
+                        s.geometry.temp_surf_sense,
+                        s.geometry.temp_face,
+                        s.geometry.temp_distance,
+                        s.geometry.temp_isect);
+#endif
+#if CELERITAS_DEBUG
+    result += sum_bytes(s.geometry.find_step_count,
+                        s.geometry.cached_step_count);
+#    if !CELERITAS_USE_VECGEOM
+    result += sum_bytes(s.geometry.step_limited);
+#    endif
+#endif
+    result += sum_bytes(s.materials.state,
+                        s.particles.state,
+                        s.physics.state,
+                        s.physics.msc_step,
+                        s.physics.per_process_xs,
+                        s.physics.relaxation.scratch,
+                        s.sim.state);
+#if CELERITAS_RNG == CELERITAS_RNG_XORWOW
+    result += sum_bytes(s.rng.state);
+#else
+    result += sum_bytes(s.rng.rng);
+#endif
+
+    return result / num_tracks + 3 * sizeof(size_type);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fit track population settings to a sample run.
+ *
+ * The outstanding tracks (and thus the initializer capacity) are assumed to
+ * scale linearly with the number of events transported together, and the
+ * secondaries per active track are assumed to be independent of it. The
+ * number of track slots is the largest that fits the memory budget, but no
+ * larger than the number of outstanding tracks.
+ */
+TrackPlan plan_tracks(const TransporterResult& sample,
+                      size_type                num_events,
+                      const TrackPlanInput&    input,
+                      std::size_t              track_bytes)
+{
+    CELER_EXPECT(input);
+    CELER_EXPECT(num_events > 0);
+    CELER_EXPECT(track_bytes > 0);
+    CELER_EXPECT(sample.alive.size() == sample.initializers.size()
+                 && sample.active.size() == sample.alive.size()
+                 && sample.secondaries.size() == sample.alive.size());
+    CELER_VALIDATE(!sample.alive.empty(),
+                   << "no steps were taken in the planning sample");
+
+    TrackPlan result;
+    result.num_events  = num_events;
+    result.track_bytes = track_bytes;
+
+    // Find high-water marks
+    for (auto i : range(sample.alive.size()))
+    {
+        result.max_alive  = std::max(result.max_alive, sample.alive[i]);
+        result.max_queued
+            = std::max(result.max_queued, sample.initializers[i]);
+        result.max_outstanding = std::max(
+            result.max_outstanding, sample.alive[i] + sample.initializers[i]);
+        result.max_secondaries
+            = std::max(result.max_secondaries, sample.secondaries[i]);
+        if (sample.active[i] > 0)
+        {
+            result.secondaries_per_track = std::max(
+                result.secondaries_per_track,
+                static_cast<real_type>(sample.secondaries[i])
+                    / sample.active[i]);
+        }
+    }
+
+    // Scale to the production batch
+    const double batch_scale = static_cast<double>(input.batch_events)
+                               / num_events;
+    const size_type outstanding
+        = scale_count(result.max_outstanding, batch_scale);
+    result.initializer_capacity
+        = std::max<size_type>(scale_count(outstanding, input.margin), 1);
+    result.secondary_stack_factor = std::max<real_type>(
+        std::ceil(input.margin * result.secondaries_per_track * 100) / 100,
+        real_type(0.01));
+
+    // Fit the track slots to the remaining memory
+    const std::size_t init_bytes = result.initializer_capacity
+                                   * sizeof(TrackInitializer);
+    const double slot_bytes
+        = track_bytes + result.secondary_stack_factor * sizeof(Secondary);
+    CELER_VALIDATE(init_bytes < input.memory_budget,
+                   << "memory budget (" << input.memory_budget
+                   << " bytes) is too small for the "
+                   << result.initializer_capacity << " track initializers ("
+                   << init_bytes << " bytes) needed for "
+                   << input.batch_events << " events");
+    const auto max_slots = static_cast<size_type>(
+        (input.memory_budget - init_bytes) / slot_bytes);
+    CELER_VALIDATE(max_slots > 0,
+                   << "memory budget (" << input.memory_budget
+                   << " bytes) cannot hold a single track slot ("
+                   << slot_bytes << " bytes) in addition to the track "
+                      "initializers");
+    result.max_num_tracks
+        = std::min(max_slots, std::max<size_type>(outstanding, 1));
+
+    result.memory = init_bytes
+                    + static_cast<std::size_t>(
+                        std::ceil(result.max_num_tracks * slot_bytes));
+
+    CELER_ENSURE(result.memory <= input.memory_budget);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! I/O routines for JSON
+void to_json(nlohmann::json& j, const TrackPlanInput& v)
+{
+    j = nlohmann::json{{"num_events", v.num_events},
+                       {"batch_events", v.batch_events},
+                       {"memory_budget", v.memory_budget},
+                       {"margin", v.margin}};
+    if (v.track_bytes > 0)
+    {
+        j["track_bytes"] = v.track_bytes;
+    }
+}
+
+void from_json(const nlohmann::json& j, TrackPlanInput& v)
+{
+    j.at("num_events").get_to(v.num_events);
+    j.at("batch_events").get_to(v.batch_events);
+    j.at("memory_budget").get_to(v.memory_budget);
+    if (j.contains("track_bytes"))
+    {
+        j.at("track_bytes").get_to(v.track_bytes);
+    }
+    if (j.contains("margin"))
+    {
+        j.at("margin").get_to(v.margin);
+    }
+}
+
+void to_json(nlohmann::json& j, const TrackPlan& v)
+{
+    j = nlohmann::json{
+        {"sample",
+         {{"num_events", v.num_events},
+          {"max_alive", v.max_alive},
+          {"max_queued", v.max_queued},
+          {"max_outstanding", v.max_outstanding},
+          {"max_secondaries", v.max_secondaries},
+          {"secondaries_per_track", v.secondaries_per_track}}},
+        {"track_bytes", v.track_bytes},
+        {"memory", v.memory},
+        {"recommended",
+         {{"max_num_tracks", v.max_num_tracks},
+          {"initializer_capacity", v.initializer_capacity},
+          {"secondary_stack_factor", v.secondary_stack_factor}}}};
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/TrackPlanner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Types.hh"
+#include "celeritas/global/CoreParams.hh"
+
+#include "Transporter.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Input for planning the track population of a production run.
+ *
+ * A small sample of events is transported on host using the run's capacities,
+ * which should be generous enough that the sample itself does not overflow.
+ * The sampled high-water marks are scaled to the production batch size.
+ *
+ * - \c num_events : number of leading events to transport (zero to disable)
+ * - \c batch_events : number of events transported together in production
+ * - \c memory_budget : target memory for the track states [bytes]
+ * - \c track_bytes : state memory per track slot (zero to measure on host)
+ * - \c margin : safety factor applied to the sampled high-water marks
+ */
+struct TrackPlanInput
+{
+    using size_type = celeritas::size_type;
+    using real_type = celeritas::real_type;
+
+    size_type   num_events{};
+    size_type   batch_events{};
+    std::size_t memory_budget{};
+    std::size_t track_bytes{};
+    real_type   margin{1.25};
+
+    //! Whether planning is enabled
+    explicit operator bool() const
+    {
+        return num_events > 0 && batch_events > 0 && memory_budget > 0
+               && margin >= 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sampled high-water marks and recommended track population settings.
+ *
+ * The outstanding tracks are the alive tracks plus the queued initializers at
+ * the end of a step; the initializer capacity is sized so that all of them
+ * could be queued at once. The secondary stack factor is the largest number
+ * of secondaries allocated per active track in a single step.
+ */
+struct TrackPlan
+{
+    using size_type = celeritas::size_type;
+    using real_type = celeritas::real_type;
+
+    // Sampled high-water marks
+    size_type num_events{};
+    size_type max_alive{};
+    size_type max_queued{};
+    size_type max_outstanding{};
+    size_type max_secondaries{};
+    real_type secondaries_per_track{};
+
+    // Memory model [bytes]
+    std::size_t track_bytes{};
+    std::size_t memory{};
+
+    // Recommended settings
+    size_type max_num_tracks{};
+    size_type initializer_capacity{};
+    real_type secondary_stack_factor{};
+};
+
+//---------------------------------------------------------------------------//
+// Calculate the core state memory for a single track slot
+std::size_t measure_track_bytes(const celeritas::CoreParams& params);
+
+// Fit track population settings to a sample run
+TrackPlan plan_tracks(const TransporterResult& sample,
+                      celeritas::size_type     num_events,
+                      const TrackPlanInput&    input,
+                      std::size_t              track_bytes);
+
+void to_json(nlohmann::json& j, const TrackPlanInput& value);
+void from_json(const nlohmann::json& j, TrackPlanInput& value);
+void to_json(nlohmann::json& j, const TrackPlan& value);
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
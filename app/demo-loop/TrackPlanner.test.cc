@@ -0,0 +1,148 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/TrackPlanner.test.cc
+//---------------------------------------------------------------------------//
+#include "TrackPlanner.hh"
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/phys/Secondary.hh"
+#include "celeritas/track/TrackInitData.hh"
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackPlannerTest : public celeritas::test::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Two events: the initializers drain as the tracks die
+        sample.initializers = {10, 6, 2, 0};
+        sample.active       = {4, 8, 8, 4};
+        sample.alive        = {8, 8, 4, 0};
+        sample.secondaries  = {4, 12, 2, 0};
+
+        input.num_events    = 2;
+        input.batch_events  = 8;
+        input.memory_budget = 1000000;
+    }
+
+    TransporterResult sample;
+    TrackPlanInput    input;
+};
+
+class MeasureTrackBytesTest : public celeritas::test::SimpleTestBase
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackPlannerTest, plan)
+{
+    auto plan = plan_tracks(sample, 2, input, 1000);
+
+    EXPECT_EQ(2, plan.num_events);
+    EXPECT_EQ(8, plan.max_alive);
+    EXPECT_EQ(10, plan.max_queued);
+    EXPECT_EQ(18, plan.max_outstanding);
+    EXPECT_EQ(12, plan.max_secondaries);
+    EXPECT_SOFT_EQ(1.5, plan.secondaries_per_track);
+    EXPECT_EQ(1000, plan.track_bytes);
+
+    // Outstanding tracks scale by four with a 25% margin
+    EXPECT_EQ(90, plan.initializer_capacity);
+    EXPECT_SOFT_EQ(1.88, plan.secondary_stack_factor);
+    // Track slots are limited by the outstanding tracks
+    EXPECT_EQ(72, plan.max_num_tracks);
+    EXPECT_LE(plan.memory, input.memory_budget);
+    EXPECT_LT(72 * 1000 + 90 * sizeof(TrackInitializer), plan.memory);
+}
+
+TEST_F(TrackPlannerTest, limited)
+{
+    const std::size_t init_bytes = 90 * sizeof(TrackInitializer);
+    const double      slot_bytes
+        = 1000 + real_type(1.88) * sizeof(Secondary);
+
+    // Track slots are limited by the memory budget
+    input.memory_budget
+        = init_bytes + static_cast<std::size_t>(10.5 * slot_bytes);
+    auto plan = plan_tracks(sample, 2, input, 1000);
+    EXPECT_EQ(90, plan.initializer_capacity);
+    EXPECT_EQ(10, plan.max_num_tracks);
+    EXPECT_LE(plan.memory, input.memory_budget);
+
+    // No room for a single track slot
+    input.memory_budget = init_bytes + 1;
+    EXPECT_THROW(plan_tracks(sample, 2, input, 1000), RuntimeError);
+
+    // No room for the initializers
+    input.memory_budget = init_bytes;
+    EXPECT_THROW(plan_tracks(sample, 2, input, 1000), RuntimeError);
+}
+
+TEST_F(TrackPlannerTest, errors)
+{
+    // Planning is disabled without a margin or a sample
+    TrackPlanInput disabled = input;
+    disabled.margin         = 0.5;
+    EXPECT_FALSE(disabled);
+    disabled.margin     = 1;
+    disabled.num_events = 0;
+    EXPECT_FALSE(disabled);
+
+    // Sample must have taken at least one step
+    TransporterResult empty;
+    EXPECT_THROW(plan_tracks(empty, 2, input, 1000), RuntimeError);
+}
+
+TEST_F(TrackPlannerTest, io)
+{
+    auto j = nlohmann::json::parse(
+        R"json({"num_events": 3, "batch_events": 16, "memory_budget": 4096})json");
+    auto result = j.get<TrackPlanInput>();
+    EXPECT_EQ(3, result.num_events);
+    EXPECT_EQ(16, result.batch_events);
+    EXPECT_EQ(4096, result.memory_budget);
+    EXPECT_EQ(0, result.track_bytes);
+    EXPECT_SOFT_EQ(1.25, result.margin);
+    EXPECT_TRUE(result);
+
+    // Round trip with optional values
+    result.track_bytes = 512;
+    result.margin      = 2;
+    auto copy = nlohmann::json(result).get<TrackPlanInput>();
+    EXPECT_EQ(512, copy.track_bytes);
+    EXPECT_SOFT_EQ(2, copy.margin);
+
+    // Missing required values
+    EXPECT_THROW(nlohmann::json::parse(R"json({"num_events": 3})json")
+                     .get<TrackPlanInput>(),
+                 nlohmann::json::exception);
+}
+
+TEST_F(MeasureTrackBytesTest, simple)
+{
+    std::size_t track_bytes = measure_track_bytes(*this->core());
+    // At least the particle, material, physics, and position/direction state
+    EXPECT_LT(2 * sizeof(Real3), track_bytes);
+    EXPECT_GT(100000, track_bytes);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace demo_loop
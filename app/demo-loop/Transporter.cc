@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "Transporter.hh"
 
+#include <algorithm>
 #include <csignal>
 #include <memory>
 #include <type_traits>
@@ -18,9 +19,11 @@
 #include "corecel/sys/ScopedSignalHandler.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/EventTallyAction.hh"
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/detail/ActionSequence.hh"
+#include "celeritas/phys/Primary.hh"
 
 #include "diagnostic/EnergyDiagnostic.hh"
 #include "diagnostic/ParticleProcessDiagnostic.hh"
@@ -149,6 +152,14 @@ Transporter<M>::Transporter(TransporterInput inp)
         params.action_reg()->insert(std::make_shared<DiagnosticActionAdapter>(
             diagnostic_action_, diagnostics_));
     }
+
+    // Create per-event tallies
+    if (input_.enable_event_results || input_.event_callback)
+    {
+        event_tally_ = std::make_shared<EventTallyAction>(
+            params.action_reg()->next_id(), M);
+        params.action_reg()->insert(event_tally_);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -168,13 +179,34 @@ TransporterResult Transporter<M>::operator()(VecPrimary primaries)
         result.initializers.reserve(input_.max_steps);
         result.active.reserve(input_.max_steps);
         result.alive.reserve(input_.max_steps);
+        if (input_.count_secondaries)
+        {
+            result.secondaries.reserve(input_.max_steps);
+        }
     }
-    auto append_track_counts = [&result](const StepperResult& track_counts) {
+    auto append_track_counts = [this,
+                                &result](const StepperResult& track_counts) {
         result.initializers.push_back(track_counts.queued);
         result.active.push_back(track_counts.active);
         result.alive.push_back(track_counts.alive);
+        if (input_.count_secondaries)
+        {
+            result.secondaries.push_back(track_counts.secondaries);
+        }
     };
 
+    if (event_tally_)
+    {
+        // Allocate tallies for the events of these primaries
+        EventId::size_type num_events = 0;
+        for (const Primary& p : primaries)
+        {
+            num_events = std::max(num_events, p.event_id.get() + 1);
+        }
+        event_tally_->reset(num_events);
+        result.events.resize(num_events);
+    }
+
     // Abort cleanly for interrupt and user-defined signals
     ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
     CELER_LOG(status) << "Transporting";
@@ -184,14 +216,33 @@ TransporterResult Transporter<M>::operator()(VecPrimary primaries)
     input.num_track_slots    = input_.num_track_slots;
     input.num_initializers   = input_.num_initializers;
     input.sync               = input_.sync;
+    input.concurrent_actions = input_.concurrent_actions;
+    input.init_policy        = input_.init_policy;
+    input.count_secondaries  = input_.count_secondaries;
     Stepper<M> step(std::move(input));
 
+    // Pass the results of newly completed events to the user
+    auto process_events = [this, &result, &step] {
+        if (!event_tally_)
+            return;
+        for (const auto& event_result :
+             event_tally_->pop_completed(step.track_counters()))
+        {
+            result.events[event_result.first.get()] = event_result.second;
+            if (input_.event_callback)
+            {
+                input_.event_callback(event_result.first, event_result.second);
+            }
+        }
+    };
+
     Stopwatch get_step_time;
     size_type remaining_steps = input_.max_steps;
 
     // Copy primaries to device and transport the first step
     auto track_counts = step(std::move(primaries));
     append_track_counts(track_counts);
+    process_events();
     result.time.steps.push_back(get_step_time());
 
     while (track_counts)
@@ -213,6 +264,7 @@ TransporterResult Transporter<M>::operator()(VecPrimary primaries)
         get_step_time = {};
         track_counts  = step();
         append_track_counts(track_counts);
+        process_events();
         result.time.steps.push_back(get_step_time());
     }
 
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -18,9 +19,11 @@
 #include "corecel/math/NumericLimits.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/EventTallyData.hh"
 
 namespace celeritas
 {
+class EventTallyAction;
 struct Primary;
 }
 
@@ -48,6 +51,8 @@ struct TransporterInput
 {
     using size_type  = celeritas::size_type;
     using CoreParams = celeritas::CoreParams;
+    using EventCallback
+        = std::function<void(celeritas::EventId, const celeritas::EventTally&)>;
 
     //! Arbitrarily high number for not stopping the simulation short
     static constexpr size_type no_max_steps()
@@ -60,6 +65,9 @@ struct TransporterInput
     size_type num_track_slots{};  //!< AKA max_num_tracks
     size_type num_initializers{}; //!< AKA initializer_capacity
     bool      sync{false};
+    bool      concurrent_actions{false}; //!< Run interactions as host tasks
+    celeritas::TrackInitPolicy init_policy{celeritas::TrackInitPolicy::lifo};
+    bool      count_secondaries{false}; //!< Record secondary stack usage
 
     // Loop control
     size_type max_steps{};
@@ -68,6 +76,11 @@ struct TransporterInput
     bool            enable_diagnostics{true};
     EnergyDiagInput energy_diag;
 
+    // Per-event results, saved (and passed to the optional callback) as soon
+    // as each event completes
+    bool          enable_event_results{false};
+    EventCallback event_callback;
+
     //! True if all params are assigned
     explicit operator bool() const
     {
@@ -102,6 +115,7 @@ struct TransporterResult
     using VecReal           = std::vector<real_type>;
     using MapStringCount    = std::unordered_map<std::string, size_type>;
     using MapStringVecCount = std::unordered_map<std::string, VecCount>;
+    using VecEventTally     = std::vector<celeritas::EventTally>;
     //!@}
 
     //// DATA ////
@@ -109,9 +123,11 @@ struct TransporterResult
     VecCount          initializers; //!< Num starting track initializers
     VecCount          active;       //!< Num tracks active at beginning of step
     VecCount          alive;        //!< Num living tracks at end of step
+    VecCount          secondaries;  //!< Secondary stack usage (if counted)
     VecReal           edep;         //!< Energy deposition along the grid
     MapStringCount    process;      //!< Count of particle/process interactions
     MapStringVecCount steps;        //!< Distribution of steps
+    VecEventTally     events;       //!< Results for each completed event
     TransporterTiming time;         //!< Timing information
 };
 
@@ -176,8 +192,9 @@ class Transporter final : public TransporterBase
     TransporterResult operator()(VecPrimary primaries) final;
 
   private:
-    std::shared_ptr<DiagnosticStore> diagnostics_;
-    celeritas::ActionId              diagnostic_action_;
+    std::shared_ptr<DiagnosticStore>             diagnostics_;
+    celeritas::ActionId                          diagnostic_action_;
+    std::shared_ptr<celeritas::EventTallyAction> event_tally_;
 };
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,20 @@
 
 #include "Transporter.hh"
 
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Save event results to json
+inline void to_json(nlohmann::json& j, const EventTally& v)
+{
+    j = nlohmann::json{{"edep", v.energy_deposition},
+                       {"steps", v.num_steps},
+                       {"tracks", v.num_tracks}};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
 namespace demo_loop
 {
 //---------------------------------------------------------------------------//
@@ -28,10 +42,15 @@ inline void to_json(nlohmann::json& j, const TransporterResult& v)
     j = nlohmann::json{{"initializers", v.initializers},
                        {"active", v.active},
                        {"alive", v.alive},
+                       {"secondaries", v.secondaries},
                        {"edep", v.edep},
                        {"process", v.process},
                        {"steps", v.steps},
                        {"time", v.time}};
+    if (!v.events.empty())
+    {
+        j["events"] = v.events;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file demo-loop/demo-loop.cc
 //---------------------------------------------------------------------------//
+#include <algorithm>
 #include <cstddef>
 #include <fstream>
 #include <functional>
@@ -16,6 +17,7 @@
 #include <nlohmann/json.hpp>
 
 #include "celeritas_version.h"
+#include "corecel/cont/Span.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
@@ -31,13 +33,18 @@
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/ext/MpiCommunicator.hh"
 #include "celeritas/ext/ScopedMpiInit.hh"
+#include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/ActionRegistryOutput.hh"
+#include "celeritas/global/VolumeProfilerAction.hh"
+#include "celeritas/global/VolumeProfilerOutput.hh"
 #include "celeritas/io/EventReader.hh"
+#include "celeritas/phys/MortonSort.hh"
 #include "celeritas/phys/PhysicsParamsOutput.hh"
 #include "celeritas/phys/Primary.hh"
-#include "celeritas/phys/PrimaryGenerator.hh"
+#include "celeritas/phys/PrimaryBatchGenerator.hh"
 
 #include "LDemoIO.hh"
+#include "TrackPlanner.hh"
 #include "Transporter.hh"
 #include "Transporter.json.hh"
 
@@ -76,6 +83,12 @@ void run(std::istream* is, OutputManager* output)
         "*",
         std::make_shared<LDemoArgs>(run_args)));
 
+    if (run_args.plan && run_args.use_device)
+    {
+        CELER_LOG(info) << "Transporting planning sample on host";
+        run_args.use_device = false;
+    }
+
     // Start timer for overall execution
     Stopwatch get_setup_time;
 
@@ -89,38 +102,101 @@ void run(std::istream* is, OutputManager* output)
         output->insert(std::make_shared<PhysicsParamsOutput>(params.physics()));
         output->insert(
             std::make_shared<ActionRegistryOutput>(params.action_reg()));
+
+        if (ActionId profiler_id
+            = params.action_reg()->find_action("volume-profiler"))
+        {
+            auto profiler
+                = std::dynamic_pointer_cast<const VolumeProfilerAction>(
+                    params.action_reg()->action(profiler_id));
+            CELER_ASSERT(profiler);
+            output->insert(std::make_shared<VolumeProfilerOutput>(
+                std::move(profiler),
+                params.geometry(),
+                run_args.volume_hotspots));
+        }
     }
 
-    // Run all the primaries
+    // Run all the primaries (or only the planning sample)
     TransporterResult    result;
     std::vector<Primary> primaries;
+    size_type            num_events = 0;
+
     if (run_args.primary_gen_options)
     {
-        std::mt19937 rng;
-        auto generate_event = PrimaryGenerator<std::mt19937>::from_options(
-            transport_ptr->params().particle(), run_args.primary_gen_options);
-        auto event = generate_event(rng);
-        while (!event.empty())
+        // Generate all events directly into a single buffer
+        PrimaryGeneratorOptions gen_options = run_args.primary_gen_options;
+        if (run_args.plan)
         {
-            primaries.insert(primaries.end(), event.begin(), event.end());
-            event = generate_event(rng);
+            gen_options.num_events = std::min(gen_options.num_events,
+                                              run_args.plan.num_events);
         }
+        num_events = gen_options.num_events;
+        primaries.resize(num_events * gen_options.primaries_per_event);
+
+        std::mt19937 rng;
+        visit_primary_batch_generator(
+            transport_ptr->params().particle(),
+            gen_options,
+            [&rng, &primaries](auto& generate) {
+                size_type count = generate(rng, make_span(primaries));
+                CELER_ASSERT(count == primaries.size());
+            });
     }
     else
     {
         EventReader read_event(run_args.hepmc3_filename.c_str(),
                                transport_ptr->params().particle());
-        auto        event = read_event();
-        while (!event.empty())
-        {
+        auto add_event = [&](const std::vector<Primary>& event) {
+            if (event.empty()
+                || (run_args.plan && num_events == run_args.plan.num_events))
+            {
+                return false;
+            }
             primaries.insert(primaries.end(), event.begin(), event.end());
-            event = read_event();
-        }
+            ++num_events;
+            return true;
+        };
+        while (add_event(read_event())) {}
+    }
+    if (run_args.sort_primaries)
+    {
+        morton_sort(make_span(primaries));
     }
     result = (*transport_ptr)(std::move(primaries));
 
     result.time.setup = setup_time;
 
+    if (run_args.plan)
+    {
+        // Fit the track population settings to the sample
+        const CoreParams& params      = transport_ptr->params();
+        std::size_t       track_bytes = run_args.plan.track_bytes;
+        if (track_bytes == 0)
+        {
+            track_bytes = measure_track_bytes(params);
+        }
+        auto plan = std::make_shared<TrackPlan>(
+            plan_tracks(result, num_events, run_args.plan, track_bytes));
+        if (plan->max_secondaries
+            >= static_cast<size_type>(run_args.max_num_tracks
+                                      * run_args.secondary_stack_factor))
+        {
+            CELER_LOG(warning) << "Secondary stack was filled during the "
+                                  "planning sample: increase "
+                                  "secondary_stack_factor and rerun";
+        }
+        CELER_LOG(info) << "Recommended track population for "
+                        << run_args.plan.batch_events
+                        << " events: max_num_tracks=" << plan->max_num_tracks
+                        << ", initializer_capacity="
+                        << plan->initializer_capacity
+                        << ", secondary_stack_factor="
+                        << plan->secondary_stack_factor;
+        output->insert(std::make_shared<OutputInterfaceAdapter<TrackPlan>>(
+            OutputInterface::Category::result, "track-plan", std::move(plan)));
+    }
+
     // TODO: convert individual results into OutputInterface so we don't have
     // to use this ugly "global" hack
     output->insert(OutputInterfaceAdapter<TransporterResult>::from_rvalue_ref(
@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Tool to generate a single "interact" action for a fixed list of models.
+
+The generated action executes every model in the list with one loop (host) or
+one kernel (device) rather than one virtual call and one launch per model.
+Each model is given as ``Class:func``, using the same class and function
+prefixes as ``gen-interactor.py``.
+
+Assumptions:
+ - The model class defines ``host_ref()`` and ``device_ref()`` accessors
+   returning ``ClassHostRef`` and ``ClassDeviceRef`` data.
+"""
+
+import os.path
+import sys
+from launchbounds import make_launch_bounds
+
+CLIKE_TOP = '''\
+//{modeline:-^75s}//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \\file {filename}
+//! \\note Auto-generated by {script}: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+'''
+
+HH_TEMPLATE = CLIKE_TOP + """\
+#pragma once
+
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+{data_includes}
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{{
+class PhysicsParams;
+
+namespace generated
+{{
+//---------------------------------------------------------------------------//
+//! Data for all models executed by {clsname}Action
+template<MemSpace M>
+struct {clsname}ModelRefs;
+
+template<>
+struct {clsname}ModelRefs<MemSpace::host>
+{{
+{host_members}
+}};
+
+template<>
+struct {clsname}ModelRefs<MemSpace::device>
+{{
+{device_members}
+}};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interact with a statically composed set of models.
+ *
+ * Models: {model_list}.
+ *
+ * Models in the physics list that are not in this set are still executed
+ * separately. The physics parameters must outlive this action.
+ */
+class {clsname}Action final : public FusedActionInterface,
+                              public ConcreteAction
+{{
+public:
+  // Construct with ID and the models from the physics
+  {clsname}Action(ActionId id, const PhysicsParams& physics);
+
+  // Launch kernel with host data
+  void execute(CoreHostRef const&) const final;
+
+  // Launch kernel with device data
+  void execute(CoreDeviceRef const&) const final;
+
+  //! Dependency ordering of the action
+  ActionOrder order() const final {{ return ActionOrder::post; }}
+
+  //! Model actions executed by this action
+  const VecActionId& fused_actions() const final {{ return fused_; }}
+
+private:
+  {clsname}ModelRefs<MemSpace::host>   host_ref_;
+  {clsname}ModelRefs<MemSpace::device> device_ref_;
+  VecActionId fused_;
+}};
+
+#if !CELER_USE_DEVICE
+inline void {clsname}Action::execute(CoreDeviceRef const&) const
+{{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}}
+#endif
+
+//---------------------------------------------------------------------------//
+}} // namespace generated
+}} // namespace celeritas
+"""
+
+CC_TEMPLATE = CLIKE_TOP + """\
+#include "{clsname}Action.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Device.hh"
+{model_includes}
+#include "celeritas/phys/InteractionLauncher.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+
+namespace celeritas
+{{
+namespace generated
+{{
+{clsname}Action::{clsname}Action(ActionId id, const PhysicsParams& physics)
+    : ConcreteAction(id, "{label}", "interact with {model_list}")
+{{
+    for (auto model_id : range(ModelId{{physics.num_models()}}))
+    {{
+        const Model* model = physics.model(model_id).get();
+        CELER_ASSERT(model);
+        {find_models}
+    }}
+    CELER_VALIDATE(!fused_.empty(),
+                   << "no models in the physics list can be executed by "
+                      "the '{label}' action");
+}}
+
+void {clsname}Action::execute(CoreHostRef const& data) const
+{{
+    CELER_EXPECT(data);
+
+{host_launchers}
+    #pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {{
+        ThreadId tid{{i}};
+{host_launches}
+    }}
+}}
+
+}} // namespace generated
+}} // namespace celeritas
+"""
+
+CU_TEMPLATE = CLIKE_TOP + """\
+#include "{clsname}Action.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "corecel/sys/Device.hh"
+{launcher_includes}
+#include "celeritas/phys/InteractionLauncher.hh"
+
+namespace celeritas
+{{
+namespace generated
+{{
+namespace
+{{
+__global__ void{launch_bounds}{func}_kernel(
+    const {clsname}ModelRefs<MemSpace::device> model_data,
+    CoreDeviceRef const data)
+{{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+{device_launches}
+}}
+}} // namespace
+
+void {clsname}Action::execute(CoreDeviceRef const& data) const
+{{
+    CELER_EXPECT(data);
+    CELER_LAUNCH_KERNEL({func},
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        device_ref_, data);
+}}
+
+}} // namespace generated
+}} // namespace celeritas
+"""
+
+FIND_MODEL_TEMPLATE = """\
+if (auto* m = dynamic_cast<const {cls}Model*>(model))
+        {{
+            host_ref_.{func} = m->host_ref();
+            if (celeritas::device())
+            {{
+                device_ref_.{func} = m->device_ref();
+            }}
+            fused_.push_back(m->action_id());
+        }}"""
+
+LAUNCHER_TEMPLATE = """\
+    auto launch_{func} = make_interaction_launcher(
+        data, {ref}.{func}, {func}_interact_track);
+"""
+
+# Models absent from the physics have a null action, which is also the action
+# of inactive tracks
+LAUNCH_TEMPLATE = """\
+{indent}if ({ref}.{func}.ids.action)
+{indent}    launch_{func}(tid);"""
+
+TEMPLATES = {
+    'hh': HH_TEMPLATE,
+    'cc': CC_TEMPLATE,
+    'cu': CU_TEMPLATE,
+}
+LANG = {
+    'hh': "C++",
+    'cc': "C++",
+    'cu': "CUDA",
+}
+
+def parse_models(models, dirname):
+    result = []
+    for m in models:
+        (cls, func) = m.split(':')
+        result.append({'cls': cls, 'func': func, 'dir': dirname})
+    return result
+
+def make_subs(clsname, func, label, models):
+    def lines(template):
+        return [template.format(**m) for m in models]
+
+    def sorted_lines(template):
+        return "\n".join(sorted(lines(template)))
+
+    return {
+        'data_includes': sorted_lines(
+            '#include "celeritas/{dir}/data/{cls}Data.hh"'),
+        'model_includes': "\n".join(sorted(
+            lines('#include "celeritas/{dir}/launcher/{cls}Launcher.hh"')
+            + lines('#include "celeritas/{dir}/model/{cls}Model.hh"'))),
+        'launcher_includes': sorted_lines(
+            '#include "celeritas/{dir}/launcher/{cls}Launcher.hh"'),
+        'host_members': "\n".join(lines('    {cls}HostRef {func};')),
+        'device_members': "\n".join(lines('    {cls}DeviceRef {func};')),
+        'model_list': ", ".join(m['cls'] for m in models),
+        'find_models': "\n        else ".join(lines(FIND_MODEL_TEMPLATE)),
+        'host_launchers': "".join(
+            LAUNCHER_TEMPLATE.format(ref='host_ref_', **m) for m in models),
+        'host_launches': "\n".join(
+            LAUNCH_TEMPLATE.format(indent='        ', ref='host_ref_', **m)
+            for m in models),
+        'device_launches': "".join(
+            LAUNCHER_TEMPLATE.format(ref='model_data', **m) for m in models)
+            + "\n".join(
+                LAUNCH_TEMPLATE.format(indent='    ', ref='model_data', **m)
+                for m in models),
+    }
+
+def generate(**subs):
+    ext = subs['ext']
+    subs['modeline'] = "-*-{}-*-".format(LANG[ext])
+    template = TEMPLATES[ext]
+    filename = "{basename}.{ext}".format(**subs)
+    subs['filename'] = filename
+    subs['script'] = os.path.basename(sys.argv[0])
+    subs['launch_bounds'] = make_launch_bounds(subs['func'])
+    with open(filename, 'w') as f:
+        f.write(template.format(**subs))
+
+def main():
+    import argparse
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        '--basename',
+        help='File name (without extension) of output')
+    parser.add_argument(
+        '--class', dest='clsname',
+        help='CamelCase name of the class prefix')
+    parser.add_argument(
+        '--func',
+        help='snake_case name of the kernel function')
+    parser.add_argument(
+        '--label',
+        help='Unique action label')
+    parser.add_argument(
+        '--dir',
+        default='em',
+        help='directory inside celeritas for the models')
+    parser.add_argument(
+        '--models', nargs='+',
+        help='Class:func pairs of each model')
+
+    args = parser.parse_args()
+    models = parse_models(args.models, args.dir)
+    subs = make_subs(args.clsname, args.func, args.label, models)
+    for ext in ['hh', 'cc', 'cu']:
+        generate(ext=ext, basename=args.basename, clsname=args.clsname,
+                 func=args.func, label=args.label, **subs)
+
+if __name__ == '__main__':
+    main()
@@ -201,6 +201,14 @@ DEFS = {
         ])),
         "core_data.states.size()",
         ["celeritas/global/CoreTrackData.hh"]),
+    "MoveTracks": KernelDefinition(
+        Function("move_tracks", ParamList([
+            Param("Core{Memspace}Ref", "core_data"),
+            Param("CoreState{Memspace}Ref", "dst_states"),
+            Param("TrackInitState{Memspace}Ref", "init_data"),
+        ])),
+        "core_data.states.size()",
+        ["celeritas/global/CoreTrackData.hh"]),
     "ProcessPrimaries": KernelDefinition(
         Function("process_primaries", ParamList([
             Param("Span<const Primary>", "primaries"),
@@ -34,5 +34,49 @@ const char* to_cstring(ActionOrder value)
     return strings[static_cast<unsigned int>(value)];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a track initializer policy.
+ */
+const char* to_cstring(TrackInitPolicy value)
+{
+    CELER_EXPECT(value != TrackInitPolicy::size_);
+
+    static const char* const strings[] = {
+        "lifo",
+        "fifo",
+        "lowest_energy",
+        "event",
+    };
+    static_assert(
+        static_cast<unsigned int>(TrackInitPolicy::size_) * sizeof(const char*)
+            == sizeof(strings),
+        "Enum strings are incorrect");
+
+    return strings[static_cast<unsigned int>(value)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to an MSC step limitation algorithm.
+ */
+const char* to_cstring(MscStepLimitAlgorithm value)
+{
+    CELER_EXPECT(value != MscStepLimitAlgorithm::size_);
+
+    static const char* const strings[] = {
+        "minimal",
+        "safety",
+        "safety_plus",
+        "distance_to_boundary",
+    };
+    static_assert(static_cast<unsigned int>(MscStepLimitAlgorithm::size_)
+                          * sizeof(const char*)
+                      == sizeof(strings),
+                  "Enum strings are incorrect");
+
+    return strings[static_cast<unsigned int>(value)];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -103,6 +103,28 @@ enum class ActionOrder
     size_
 };
 
+//---------------------------------------------------------------------------//
+//! Order in which queued track initializers fill vacant track slots
+enum class TrackInitPolicy
+{
+    lifo,          //!< Most recently created first (depth first)
+    fifo,          //!< Least recently created first (breadth first)
+    lowest_energy, //!< Lowest kinetic energy first
+    event,         //!< Lowest event ID first, then most recently created
+    size_
+};
+
+//---------------------------------------------------------------------------//
+//! Multiple scattering step limitation algorithm (see G4MscStepLimitType)
+enum class MscStepLimitAlgorithm
+{
+    minimal,              //!< Range-based limit only (no safety query)
+    safety,               //!< Range and safety-based limit
+    safety_plus,          //!< Safety-based limit with boundary skin
+    distance_to_boundary, //!< Limit using the distance to the next boundary
+    size_
+};
+
 //---------------------------------------------------------------------------//
 // HELPER STRUCTS
 //---------------------------------------------------------------------------//
@@ -132,5 +154,11 @@ struct NoData
 // Get a string corresponding to a surface type
 const char* to_cstring(ActionOrder);
 
+// Get a string corresponding to a track initializer policy
+const char* to_cstring(TrackInitPolicy);
+
+// Get a string corresponding to an MSC step limitation algorithm
+const char* to_cstring(MscStepLimitAlgorithm);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
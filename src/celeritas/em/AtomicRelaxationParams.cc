@@ -135,7 +135,7 @@ void AtomicRelaxationParams::append_element(const ImportAtomicRelaxation& inp,
             designators.insert(transition.initial_shell);
             designators.insert(transition.auger_shell);
         }
-        CELER_ASSERT(soft_equal(1., norm));
+        CELER_ASSERT(soft_equal(real_type(1), norm));
     }
 
     // Create a mapping of subshell designator to index in the shells array (it
@@ -0,0 +1,202 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/NativeEmTableBuilder.cc
+//---------------------------------------------------------------------------//
+#include "NativeEmTableBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "celeritas/em/xs/KleinNishinaMicroXsCalculator.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a log-spaced energy grid with Geant4's bin structure.
+ *
+ * The number of bins is the number per decade times the (rounded) number of
+ * decades, and the upper bound is exact.
+ */
+ImportPhysicsVector make_log_vector(double    emin,
+                                    double    emax,
+                                    size_type bins_per_decade)
+{
+    CELER_EXPECT(emin > 0 && emin < emax);
+    CELER_EXPECT(bins_per_decade > 0);
+
+    const size_type num_bins = std::max<size_type>(
+        bins_per_decade * std::lround(std::log10(emax / emin)), 1);
+    const double delta = std::log(emax / emin) / num_bins;
+
+    ImportPhysicsVector result;
+    result.vector_type = ImportPhysicsVectorType::log;
+    result.x.resize(num_bins + 1);
+    result.y.resize(num_bins + 1);
+    for (auto i : range(num_bins))
+    {
+        result.x[i] = emin * std::exp(i * delta);
+    }
+    result.x.back() = emax;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether tables for the process can be generated natively.
+ */
+bool NativeEmTableBuilder::is_supported(ImportProcessClass ipc)
+{
+    return ipc == ImportProcessClass::compton;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shared data.
+ */
+NativeEmTableBuilder::NativeEmTableBuilder(SPConstParticle particle,
+                                           SPConstMaterial material,
+                                           Options         options)
+    : particle_(std::move(particle))
+    , material_(std::move(material))
+    , options_(options)
+{
+    CELER_EXPECT(particle_);
+    CELER_EXPECT(material_);
+    CELER_VALIDATE(options_.min_energy > 0
+                       && options_.min_energy < options_.max_energy,
+                   << "invalid native table energy range ["
+                   << options_.min_energy << ", " << options_.max_energy
+                   << "] MeV");
+    CELER_VALIDATE(options_.bins_per_decade > 0,
+                   << "invalid number of bins per decade for native tables");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shared data with default options.
+ */
+NativeEmTableBuilder::NativeEmTableBuilder(SPConstParticle particle,
+                                           SPConstMaterial material)
+    : NativeEmTableBuilder(std::move(particle), std::move(material), Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate the tables for a process.
+ */
+ImportProcess NativeEmTableBuilder::operator()(ImportProcessClass ipc) const
+{
+    CELER_VALIDATE(is_supported(ipc),
+                   << "cannot generate native tables for EM process '"
+                   << to_cstring(ipc) << "'");
+
+    ImportProcess result = this->build_compton();
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the Compton scattering cross section tables.
+ *
+ * As in Geant4, the macroscopic cross section is tabulated directly below
+ * 1 MeV and scaled by the energy above it.
+ */
+ImportProcess NativeEmTableBuilder::build_compton() const
+{
+    constexpr double prim_energy = 1; // [MeV]
+    CELER_VALIDATE(options_.min_energy < prim_energy
+                       && prim_energy < options_.max_energy,
+                   << "native Compton tables require the energy range to "
+                      "span "
+                   << prim_energy << " MeV");
+
+    ParticleId electron_id = particle_->find(pdg::electron());
+    CELER_VALIDATE(electron_id,
+                   << "missing electron particle (required for Compton "
+                      "tables)");
+    const units::MevMass electron_mass = particle_->get(electron_id).mass();
+
+    ImportProcess result;
+    result.particle_pdg  = pdg::gamma().get();
+    result.secondary_pdg = pdg::electron().get();
+    result.process_type  = ImportProcessType::electromagnetic;
+    result.process_class = ImportProcessClass::compton;
+    result.models        = {ImportModelClass::klein_nishina};
+
+    ImportPhysicsTable lambda;
+    lambda.table_type = ImportTableType::lambda;
+    lambda.x_units    = ImportUnits::mev;
+    lambda.y_units    = ImportUnits::cm_inv;
+
+    ImportPhysicsTable lambda_prim;
+    lambda_prim.table_type = ImportTableType::lambda_prim;
+    lambda_prim.x_units    = ImportUnits::mev;
+    lambda_prim.y_units    = ImportUnits::cm_mev_inv;
+
+    const MaterialParams& mats = *material_;
+    lambda.physics_vectors.resize(mats.size());
+    lambda_prim.physics_vectors.resize(mats.size());
+
+#pragma omp parallel for
+    for (size_type i = 0; i < mats.size(); ++i)
+    {
+        const MaterialView mat = mats.get(MaterialId{i});
+
+        // Macroscopic cross section [1/cm]
+        auto calc_macro_xs = [&](double energy) {
+            KleinNishinaMicroXsCalculator calc_micro_xs(
+                electron_mass, units::MevEnergy{real_type(energy)});
+            double result = 0;
+            for (const MatElementComponent& el_comp : mat.elements())
+            {
+                result += el_comp.fraction
+                          * calc_micro_xs(mats.get(el_comp.element));
+            }
+            return result * KleinNishinaMicroXsCalculator::XsUnits::value()
+                   * mat.number_density();
+        };
+
+        ImportPhysicsVector lo = make_log_vector(
+            options_.min_energy, prim_energy, options_.bins_per_decade);
+        for (auto j : range(lo.x.size()))
+        {
+            lo.y[j] = calc_macro_xs(lo.x[j]);
+        }
+
+        ImportPhysicsVector hi = make_log_vector(
+            prim_energy, options_.max_energy, options_.bins_per_decade);
+        for (auto j : range(hi.x.size()))
+        {
+            hi.y[j] = calc_macro_xs(hi.x[j]) * hi.x[j];
+        }
+
+        lambda.physics_vectors[i]      = std::move(lo);
+        lambda_prim.physics_vectors[i] = std::move(hi);
+    }
+
+    result.tables.push_back(std::move(lambda));
+    result.tables.push_back(std::move(lambda_prim));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
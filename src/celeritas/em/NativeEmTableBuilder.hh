@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/NativeEmTableBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/Types.hh"
+#include "celeritas/io/ImportProcess.hh"
+
+namespace celeritas
+{
+class MaterialParams;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate EM physics tables without Geant4.
+ *
+ * The tables are constructed directly from the material definitions using
+ * the same cross section parameterizations, energy grids, and table layout
+ * as Geant4, so that the resulting \c ImportProcess can be consumed by the
+ * imported process adapters in place of one exported from Geant4. The
+ * per-material physics vectors are independent and are built in parallel.
+ *
+ * Only Compton scattering (Klein-Nishina) is currently implemented; the
+ * other processes still require tables exported from Geant4. The
+ * charged-particle energy loss and range tables in particular need mean
+ * excitation energies and density effect parameters that are not part of
+ * \c MaterialParams. The Compton tables agree with those exported from
+ * Geant4 to a relative tolerance of about 1e-6.
+ */
+class NativeEmTableBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticle = std::shared_ptr<const ParticleParams>;
+    using SPConstMaterial = std::shared_ptr<const MaterialParams>;
+    //!@}
+
+    //! Energy grid parameters [MeV], matching the Geant4 EM defaults
+    struct Options
+    {
+        double    min_energy{1e-4};
+        double    max_energy{1e8};
+        size_type bins_per_decade{7};
+    };
+
+  public:
+    // Whether tables for the process can be generated natively
+    static bool is_supported(ImportProcessClass ipc);
+
+    // Construct from shared data
+    NativeEmTableBuilder(SPConstParticle particle,
+                         SPConstMaterial material,
+                         Options         options);
+
+    // Construct from shared data with default options
+    NativeEmTableBuilder(SPConstParticle particle, SPConstMaterial material);
+
+    // Generate the tables for a process
+    ImportProcess operator()(ImportProcessClass ipc) const;
+
+  private:
+    SPConstParticle particle_;
+    SPConstMaterial material_;
+    Options         options_;
+
+    //// HELPER FUNCTIONS ////
+
+    ImportProcess build_compton() const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -22,7 +22,8 @@ namespace celeritas
  * \f$ \tau = t/\lambda \f$ where t is the true path length and \f$ \lambda \f$
  * is the mean free path of the multiple scattering. The range and safety
  * factors are used in step limitation algorithms and default values are
- * chosen to balance between simulation time and precision.
+ * chosen to balance between simulation time and precision. The step
+ * limitation algorithm can be chosen separately for electrons and positrons.
  */
 struct UrbanMscParameters
 {
@@ -39,6 +40,11 @@ struct UrbanMscParameters
     Energy    low_energy_limit{1e-5};               //!< 10 eV
     Energy    high_energy_limit{1e+2};              //!< 100 MeV
 
+    //! Step limitation algorithm for electrons
+    MscStepLimitAlgorithm electron_step_limit{MscStepLimitAlgorithm::safety};
+    //! Step limitation algorithm for positrons
+    MscStepLimitAlgorithm positron_step_limit{MscStepLimitAlgorithm::safety};
+
     //! A scale factor for the range
     static CELER_CONSTEXPR_FUNCTION real_type dtrl() { return 5e-2; }
 
@@ -133,6 +139,14 @@ struct UrbanMscData
         return ids && electron_mass > zero_quantity() && !msc_data.empty();
     }
 
+    //! Step limitation algorithm for an electron or positron
+    CELER_FUNCTION MscStepLimitAlgorithm
+    step_limit_algorithm(ParticleId particle) const
+    {
+        return particle == ids.positron ? params.positron_step_limit
+                                        : params.electron_step_limit;
+    }
+
     //! Assign from another set of data
     template<Ownership W2, MemSpace M2>
     UrbanMscData& operator=(const UrbanMscData<W2, M2>& other)
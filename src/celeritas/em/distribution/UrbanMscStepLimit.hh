@@ -30,6 +30,11 @@ namespace celeritas
 /*!
  * This is the step limitation algorithm of the Urban model for the e-/e+
  * multiple scattering.
+ *
+ * The \c safety algorithm (the default, \c fUseSafety in Geant4) limits the
+ * step using the range, mean free path, and distance to the nearest boundary.
+ * The \c minimal algorithm (\c fMinimal) uses only the range and mean free
+ * path, so the safety is not needed and may be zero.
 
  * \note This code performs the same method as in ComputeTruePathLengthLimit
  * of G4UrbanMscModel, as documented in section 8.1.6 of the Geant4 10.7
@@ -68,6 +73,8 @@ class UrbanMscStepLimit
     const real_type inc_energy_;
     // Incident particle flag for positron
     const bool is_positron_;
+    // Step limitation algorithm for the incident particle
+    const MscStepLimitAlgorithm algorithm_;
     // Incident particle safety
     const real_type safety_;
     // Urban MSC setable parameters
@@ -121,6 +128,7 @@ UrbanMscStepLimit::UrbanMscStepLimit(const UrbanMscRef&       shared,
     : shared_(shared)
     , inc_energy_(value_as<Energy>(particle.energy()))
     , is_positron_(particle.particle_id() == shared.ids.positron)
+    , algorithm_(shared.step_limit_algorithm(particle.particle_id()))
     , safety_(safety)
     , params_(shared.params)
     , msc_(shared_.msc_data[matid])
@@ -130,6 +138,8 @@ UrbanMscStepLimit::UrbanMscStepLimit(const UrbanMscRef&       shared,
 {
     CELER_EXPECT(particle.particle_id() == shared.ids.electron
                  || particle.particle_id() == shared.ids.positron);
+    CELER_EXPECT(algorithm_ == MscStepLimitAlgorithm::minimal
+                 || algorithm_ == MscStepLimitAlgorithm::safety);
     CELER_EXPECT(safety_ >= 0);
     CELER_EXPECT(phys_step > 0);
 
@@ -165,7 +175,8 @@ CELER_FUNCTION auto UrbanMscStepLimit::operator()(Engine& rng) -> MscStep
     // distance that e-/e+ can travel is far from the geometry boundary
     // NOTE: use d_over_r_mh for muons and charged hadrons
     if (result.true_path < shared_.params.limit_min_fix()
-        || range_ * msc_.d_over_r < safety_)
+        || (algorithm_ == MscStepLimitAlgorithm::safety
+            && range_ * msc_.d_over_r < safety_))
     {
         result.is_displaced = false;
         auto temp           = this->calc_geom_path(result.true_path);
@@ -173,9 +184,6 @@ CELER_FUNCTION auto UrbanMscStepLimit::operator()(Engine& rng) -> MscStep
         return result;
     }
 
-    // Step limitation algorithm: UseSafety (the default)
-    // TODO: add options for other algorithms (see G4MscStepLimitType.hh)
-
     // Initialisation at the first step or at the boundary
     real_type range_fact = params_.range_fact;
     real_type range_init = max<real_type>(range_, lambda_);
@@ -192,7 +200,12 @@ CELER_FUNCTION auto UrbanMscStepLimit::operator()(Engine& rng) -> MscStep
 
     // The step limit
     real_type limit = range_;
-    if (limit > safety_)
+    if (algorithm_ == MscStepLimitAlgorithm::minimal)
+    {
+        // Geant4 7.1-like limit from the range and mean free path only
+        limit = params_.range_fact * range_init;
+    }
+    else if (limit > safety_)
     {
         limit = max<real_type>(range_fact * range_init,
                                params_.safety_fact * safety_);
@@ -0,0 +1,198 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/generated/EmStandardInteractAction.cc
+//! \note Auto-generated by gen-pipeline.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#include "EmStandardInteractAction.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Device.hh"
+#include "celeritas/em/launcher/BetheHeitlerLauncher.hh"
+#include "celeritas/em/launcher/CombinedBremLauncher.hh"
+#include "celeritas/em/launcher/EPlusGGLauncher.hh"
+#include "celeritas/em/launcher/KleinNishinaLauncher.hh"
+#include "celeritas/em/launcher/LivermorePELauncher.hh"
+#include "celeritas/em/launcher/MollerBhabhaLauncher.hh"
+#include "celeritas/em/launcher/MuBremsstrahlungLauncher.hh"
+#include "celeritas/em/launcher/RayleighLauncher.hh"
+#include "celeritas/em/launcher/RelativisticBremLauncher.hh"
+#include "celeritas/em/launcher/SeltzerBergerLauncher.hh"
+#include "celeritas/em/model/BetheHeitlerModel.hh"
+#include "celeritas/em/model/CombinedBremModel.hh"
+#include "celeritas/em/model/EPlusGGModel.hh"
+#include "celeritas/em/model/KleinNishinaModel.hh"
+#include "celeritas/em/model/LivermorePEModel.hh"
+#include "celeritas/em/model/MollerBhabhaModel.hh"
+#include "celeritas/em/model/MuBremsstrahlungModel.hh"
+#include "celeritas/em/model/RayleighModel.hh"
+#include "celeritas/em/model/RelativisticBremModel.hh"
+#include "celeritas/em/model/SeltzerBergerModel.hh"
+#include "celeritas/phys/InteractionLauncher.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+EmStandardInteractAction::EmStandardInteractAction(ActionId id, const PhysicsParams& physics)
+    : ConcreteAction(id, "interact-em-standard", "interact with BetheHeitler, CombinedBrem, EPlusGG, KleinNishina, LivermorePE, MollerBhabha, MuBremsstrahlung, Rayleigh, RelativisticBrem, SeltzerBerger")
+{
+    for (auto model_id : range(ModelId{physics.num_models()}))
+    {
+        const Model* model = physics.model(model_id).get();
+        CELER_ASSERT(model);
+        if (auto* m = dynamic_cast<const BetheHeitlerModel*>(model))
+        {
+            host_ref_.bethe_heitler = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.bethe_heitler = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const CombinedBremModel*>(model))
+        {
+            host_ref_.combined_brem = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.combined_brem = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const EPlusGGModel*>(model))
+        {
+            host_ref_.eplusgg = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.eplusgg = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const KleinNishinaModel*>(model))
+        {
+            host_ref_.klein_nishina = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.klein_nishina = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const LivermorePEModel*>(model))
+        {
+            host_ref_.livermore_pe = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.livermore_pe = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const MollerBhabhaModel*>(model))
+        {
+            host_ref_.moller_bhabha = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.moller_bhabha = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const MuBremsstrahlungModel*>(model))
+        {
+            host_ref_.mu_bremsstrahlung = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.mu_bremsstrahlung = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const RayleighModel*>(model))
+        {
+            host_ref_.rayleigh = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.rayleigh = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const RelativisticBremModel*>(model))
+        {
+            host_ref_.relativistic_brem = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.relativistic_brem = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+        else if (auto* m = dynamic_cast<const SeltzerBergerModel*>(model))
+        {
+            host_ref_.seltzer_berger = m->host_ref();
+            if (celeritas::device())
+            {
+                device_ref_.seltzer_berger = m->device_ref();
+            }
+            fused_.push_back(m->action_id());
+        }
+    }
+    CELER_VALIDATE(!fused_.empty(),
+                   << "no models in the physics list can be executed by "
+                      "the 'interact-em-standard' action");
+}
+
+void EmStandardInteractAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+
+    auto launch_bethe_heitler = make_interaction_launcher(
+        data, host_ref_.bethe_heitler, bethe_heitler_interact_track);
+    auto launch_combined_brem = make_interaction_launcher(
+        data, host_ref_.combined_brem, combined_brem_interact_track);
+    auto launch_eplusgg = make_interaction_launcher(
+        data, host_ref_.eplusgg, eplusgg_interact_track);
+    auto launch_klein_nishina = make_interaction_launcher(
+        data, host_ref_.klein_nishina, klein_nishina_interact_track);
+    auto launch_livermore_pe = make_interaction_launcher(
+        data, host_ref_.livermore_pe, livermore_pe_interact_track);
+    auto launch_moller_bhabha = make_interaction_launcher(
+        data, host_ref_.moller_bhabha, moller_bhabha_interact_track);
+    auto launch_mu_bremsstrahlung = make_interaction_launcher(
+        data, host_ref_.mu_bremsstrahlung, mu_bremsstrahlung_interact_track);
+    auto launch_rayleigh = make_interaction_launcher(
+        data, host_ref_.rayleigh, rayleigh_interact_track);
+    auto launch_relativistic_brem = make_interaction_launcher(
+        data, host_ref_.relativistic_brem, relativistic_brem_interact_track);
+    auto launch_seltzer_berger = make_interaction_launcher(
+        data, host_ref_.seltzer_berger, seltzer_berger_interact_track);
+
+    #pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        ThreadId tid{i};
+        if (host_ref_.bethe_heitler.ids.action)
+            launch_bethe_heitler(tid);
+        if (host_ref_.combined_brem.ids.action)
+            launch_combined_brem(tid);
+        if (host_ref_.eplusgg.ids.action)
+            launch_eplusgg(tid);
+        if (host_ref_.klein_nishina.ids.action)
+            launch_klein_nishina(tid);
+        if (host_ref_.livermore_pe.ids.action)
+            launch_livermore_pe(tid);
+        if (host_ref_.moller_bhabha.ids.action)
+            launch_moller_bhabha(tid);
+        if (host_ref_.mu_bremsstrahlung.ids.action)
+            launch_mu_bremsstrahlung(tid);
+        if (host_ref_.rayleigh.ids.action)
+            launch_rayleigh(tid);
+        if (host_ref_.relativistic_brem.ids.action)
+            launch_relativistic_brem(tid);
+        if (host_ref_.seltzer_berger.ids.action)
+            launch_seltzer_berger(tid);
+    }
+}
+
+} // namespace generated
+} // namespace celeritas
@@ -0,0 +1,95 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/generated/EmStandardInteractAction.cu
+//! \note Auto-generated by gen-pipeline.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#include "EmStandardInteractAction.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "corecel/sys/Device.hh"
+#include "celeritas/em/launcher/BetheHeitlerLauncher.hh"
+#include "celeritas/em/launcher/CombinedBremLauncher.hh"
+#include "celeritas/em/launcher/EPlusGGLauncher.hh"
+#include "celeritas/em/launcher/KleinNishinaLauncher.hh"
+#include "celeritas/em/launcher/LivermorePELauncher.hh"
+#include "celeritas/em/launcher/MollerBhabhaLauncher.hh"
+#include "celeritas/em/launcher/MuBremsstrahlungLauncher.hh"
+#include "celeritas/em/launcher/RayleighLauncher.hh"
+#include "celeritas/em/launcher/RelativisticBremLauncher.hh"
+#include "celeritas/em/launcher/SeltzerBergerLauncher.hh"
+#include "celeritas/phys/InteractionLauncher.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+namespace
+{
+__global__ void em_standard_interact_kernel(
+    const EmStandardInteractModelRefs<MemSpace::device> model_data,
+    CoreDeviceRef const data)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    auto launch_bethe_heitler = make_interaction_launcher(
+        data, model_data.bethe_heitler, bethe_heitler_interact_track);
+    auto launch_combined_brem = make_interaction_launcher(
+        data, model_data.combined_brem, combined_brem_interact_track);
+    auto launch_eplusgg = make_interaction_launcher(
+        data, model_data.eplusgg, eplusgg_interact_track);
+    auto launch_klein_nishina = make_interaction_launcher(
+        data, model_data.klein_nishina, klein_nishina_interact_track);
+    auto launch_livermore_pe = make_interaction_launcher(
+        data, model_data.livermore_pe, livermore_pe_interact_track);
+    auto launch_moller_bhabha = make_interaction_launcher(
+        data, model_data.moller_bhabha, moller_bhabha_interact_track);
+    auto launch_mu_bremsstrahlung = make_interaction_launcher(
+        data, model_data.mu_bremsstrahlung, mu_bremsstrahlung_interact_track);
+    auto launch_rayleigh = make_interaction_launcher(
+        data, model_data.rayleigh, rayleigh_interact_track);
+    auto launch_relativistic_brem = make_interaction_launcher(
+        data, model_data.relativistic_brem, relativistic_brem_interact_track);
+    auto launch_seltzer_berger = make_interaction_launcher(
+        data, model_data.seltzer_berger, seltzer_berger_interact_track);
+    if (model_data.bethe_heitler.ids.action)
+        launch_bethe_heitler(tid);
+    if (model_data.combined_brem.ids.action)
+        launch_combined_brem(tid);
+    if (model_data.eplusgg.ids.action)
+        launch_eplusgg(tid);
+    if (model_data.klein_nishina.ids.action)
+        launch_klein_nishina(tid);
+    if (model_data.livermore_pe.ids.action)
+        launch_livermore_pe(tid);
+    if (model_data.moller_bhabha.ids.action)
+        launch_moller_bhabha(tid);
+    if (model_data.mu_bremsstrahlung.ids.action)
+        launch_mu_bremsstrahlung(tid);
+    if (model_data.rayleigh.ids.action)
+        launch_rayleigh(tid);
+    if (model_data.relativistic_brem.ids.action)
+        launch_relativistic_brem(tid);
+    if (model_data.seltzer_berger.ids.action)
+        launch_seltzer_berger(tid);
+}
+} // namespace
+
+void EmStandardInteractAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_LAUNCH_KERNEL(em_standard_interact,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        device_ref_, data);
+}
+
+} // namespace generated
+} // namespace celeritas
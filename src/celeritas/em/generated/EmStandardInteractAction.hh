@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/generated/EmStandardInteractAction.hh
+//! \note Auto-generated by gen-pipeline.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/em/data/BetheHeitlerData.hh"
+#include "celeritas/em/data/CombinedBremData.hh"
+#include "celeritas/em/data/EPlusGGData.hh"
+#include "celeritas/em/data/KleinNishinaData.hh"
+#include "celeritas/em/data/LivermorePEData.hh"
+#include "celeritas/em/data/MollerBhabhaData.hh"
+#include "celeritas/em/data/MuBremsstrahlungData.hh"
+#include "celeritas/em/data/RayleighData.hh"
+#include "celeritas/em/data/RelativisticBremData.hh"
+#include "celeritas/em/data/SeltzerBergerData.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+class PhysicsParams;
+
+namespace generated
+{
+//---------------------------------------------------------------------------//
+//! Data for all models executed by EmStandardInteractAction
+template<MemSpace M>
+struct EmStandardInteractModelRefs;
+
+template<>
+struct EmStandardInteractModelRefs<MemSpace::host>
+{
+    BetheHeitlerHostRef bethe_heitler;
+    CombinedBremHostRef combined_brem;
+    EPlusGGHostRef eplusgg;
+    KleinNishinaHostRef klein_nishina;
+    LivermorePEHostRef livermore_pe;
+    MollerBhabhaHostRef moller_bhabha;
+    MuBremsstrahlungHostRef mu_bremsstrahlung;
+    RayleighHostRef rayleigh;
+    RelativisticBremHostRef relativistic_brem;
+    SeltzerBergerHostRef seltzer_berger;
+};
+
+template<>
+struct EmStandardInteractModelRefs<MemSpace::device>
+{
+    BetheHeitlerDeviceRef bethe_heitler;
+    CombinedBremDeviceRef combined_brem;
+    EPlusGGDeviceRef eplusgg;
+    KleinNishinaDeviceRef klein_nishina;
+    LivermorePEDeviceRef livermore_pe;
+    MollerBhabhaDeviceRef moller_bhabha;
+    MuBremsstrahlungDeviceRef mu_bremsstrahlung;
+    RayleighDeviceRef rayleigh;
+    RelativisticBremDeviceRef relativistic_brem;
+    SeltzerBergerDeviceRef seltzer_berger;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interact with a statically composed set of models.
+ *
+ * Models: BetheHeitler, CombinedBrem, EPlusGG, KleinNishina, LivermorePE, MollerBhabha, MuBremsstrahlung, Rayleigh, RelativisticBrem, SeltzerBerger.
+ *
+ * Models in the physics list that are not in this set are still executed
+ * separately. The physics parameters must outlive this action.
+ */
+class EmStandardInteractAction final : public FusedActionInterface,
+                              public ConcreteAction
+{
+public:
+  // Construct with ID and the models from the physics
+  EmStandardInteractAction(ActionId id, const PhysicsParams& physics);
+
+  // Launch kernel with host data
+  void execute(CoreHostRef const&) const final;
+
+  // Launch kernel with device data
+  void execute(CoreDeviceRef const&) const final;
+
+  //! Dependency ordering of the action
+  ActionOrder order() const final { return ActionOrder::post; }
+
+  //! Model actions executed by this action
+  const VecActionId& fused_actions() const final { return fused_; }
+
+private:
+  EmStandardInteractModelRefs<MemSpace::host>   host_ref_;
+  EmStandardInteractModelRefs<MemSpace::device> device_ref_;
+  VecActionId fused_;
+};
+
+#if !CELER_USE_DEVICE
+inline void EmStandardInteractAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace generated
+} // namespace celeritas
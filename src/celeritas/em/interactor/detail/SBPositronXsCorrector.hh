@@ -10,6 +10,7 @@
 #include <cmath>
 
 #include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
 #include "celeritas/Constants.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/distribution/SBEnergyDistHelper.hh"
@@ -115,7 +116,10 @@ CELER_FUNCTION real_type SBPositronXsCorrector::operator()(Energy energy) const
 {
     CELER_EXPECT(energy > zero_quantity());
     CELER_EXPECT(energy.value() < inc_energy_);
-    real_type delta  = cutoff_invbeta_ - this->calc_invbeta(energy.value());
+    // The inverse speed grows as the positron energy decreases, but roundoff
+    // in single precision can make the difference slightly positive
+    real_type delta = celeritas::min(
+        cutoff_invbeta_ - this->calc_invbeta(energy.value()), real_type(0));
     real_type result = std::exp(alpha_z_ * delta);
     CELER_ENSURE(result <= 1);
     return result;
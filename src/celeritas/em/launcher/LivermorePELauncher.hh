@@ -33,12 +33,9 @@ inline CELER_FUNCTION Interaction livermore_pe_interact_track(
     {
         // Sample an element (calculating microscopic cross sections on the
         // fly) and store it
-        auto            material_track = track.make_material_view();
-        auto            material       = material_track.make_material_view();
-        ElementSelector select_el(
-            material,
-            LivermorePEMicroXsCalculator{model, particle.energy()},
-            material_track.element_scratch());
+        auto select_el = make_element_selector(
+            track.make_material_view().make_material_view(),
+            LivermorePEMicroXsCalculator{model, particle.energy()});
         elcomp_id = select_el(rng);
         CELER_ASSERT(elcomp_id);
         track.make_physics_step_view().element(elcomp_id);
@@ -57,6 +57,12 @@ class BetheHeitlerModel final : public Model
         return "Bethe-Heitler gamma conversion";
     }
 
+    //!@{
+    //! Access model data
+    const BetheHeitlerData& host_ref() const { return interface_; }
+    const BetheHeitlerData& device_ref() const { return interface_; }
+    //!@}
+
   private:
     BetheHeitlerData     interface_;
     ImportedModelAdapter imported_;
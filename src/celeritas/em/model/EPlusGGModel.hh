@@ -47,8 +47,11 @@ class EPlusGGModel final : public Model
         return "Positron annihilation yielding two gammas";
     }
 
-    // Access data on device
-    EPlusGGData device_ref() const { return interface_; }
+    //!@{
+    //! Access model data
+    const EPlusGGData& host_ref() const { return interface_; }
+    const EPlusGGData& device_ref() const { return interface_; }
+    //!@}
 
   private:
     EPlusGGData interface_;
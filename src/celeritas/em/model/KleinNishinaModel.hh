@@ -47,6 +47,12 @@ class KleinNishinaModel final : public Model
         return "Klein-Nishina Compton scattering";
     }
 
+    //!@{
+    //! Access model data
+    const KleinNishinaData& host_ref() const { return interface_; }
+    const KleinNishinaData& device_ref() const { return interface_; }
+    //!@}
+
   private:
     KleinNishinaData interface_;
 };
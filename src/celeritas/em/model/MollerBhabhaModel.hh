@@ -48,6 +48,12 @@ class MollerBhabhaModel final : public Model
         return "Moller+Bhabha scattering";
     }
 
+    //!@{
+    //! Access model data
+    const MollerBhabhaData& host_ref() const { return interface_; }
+    const MollerBhabhaData& device_ref() const { return interface_; }
+    //!@}
+
   private:
     MollerBhabhaData interface_;
 };
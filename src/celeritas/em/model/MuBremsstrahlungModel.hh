@@ -53,6 +53,12 @@ class MuBremsstrahlungModel final : public Model
     //! Name of the model, for user interaction
     std::string description() const final { return "Muon bremsstrahlung"; }
 
+    //!@{
+    //! Access model data
+    const MuBremsstrahlungData& host_ref() const { return interface_; }
+    const MuBremsstrahlungData& device_ref() const { return interface_; }
+    //!@}
+
   private:
     MuBremsstrahlungData interface_;
     ImportedModelAdapter imported_;
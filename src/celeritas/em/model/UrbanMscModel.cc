@@ -22,15 +22,38 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Whether the step limitation algorithm is implemented
+bool is_supported(MscStepLimitAlgorithm alg)
+{
+    return alg == MscStepLimitAlgorithm::minimal
+           || alg == MscStepLimitAlgorithm::safety;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
  */
 UrbanMscModel::UrbanMscModel(ActionId              id,
                              const ParticleParams& particles,
-                             const MaterialParams& materials)
+                             const MaterialParams& materials,
+                             Options               options)
 {
     CELER_EXPECT(id);
+    for (MscStepLimitAlgorithm alg :
+         {options.electron_step_limit, options.positron_step_limit})
+    {
+        CELER_VALIDATE(is_supported(alg),
+                       << "unsupported MSC step limitation algorithm '"
+                       << to_cstring(alg) << "' (required for "
+                       << this->description() << ")");
+    }
+
     HostValue host_ref;
 
     host_ref.ids.action   = id;
@@ -43,6 +66,10 @@ UrbanMscModel::UrbanMscModel(ActionId              id,
     // Save electron mass
     host_ref.electron_mass = particles.get(host_ref.ids.electron).mass();
 
+    // Save step limitation algorithms
+    host_ref.params.electron_step_limit = options.electron_step_limit;
+    host_ref.params.positron_step_limit = options.positron_step_limit;
+
     // Build UrbanMsc material data
     this->build_data(&host_ref, materials);
 
@@ -20,6 +20,16 @@ class MaterialView;
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch UrbanMsc model.
+ *
+ * The step limitation algorithm can be selected separately for electrons and
+ * positrons, analogous to \c G4MscStepLimitType. The \c minimal algorithm
+ * limits the step using only the range and mean free path, so the step
+ * limitation doesn't query the distance to the nearest boundary. This gives
+ * fewer and cheaper steps in calorimeters where the lateral shower shape at
+ * boundaries is less important. As in Geant4, the lateral displacement still
+ * needs the safety distance to stay inside the volume, so the safety is
+ * computed after a step that is long enough to be displaced. Only the
+ * \c minimal and \c safety (default) algorithms are implemented.
  */
 class UrbanMscModel final : public Model
 {
@@ -30,11 +40,21 @@ class UrbanMscModel final : public Model
     using DeviceRef = DeviceCRef<UrbanMscData>;
     //@}
 
+    //! Step limitation options
+    struct Options
+    {
+        MscStepLimitAlgorithm electron_step_limit{
+            MscStepLimitAlgorithm::safety};
+        MscStepLimitAlgorithm positron_step_limit{
+            MscStepLimitAlgorithm::safety};
+    };
+
   public:
     // Construct from model ID and other necessary data
     UrbanMscModel(ActionId              id,
                   const ParticleParams& particles,
-                  const MaterialParams& materials);
+                  const MaterialParams& materials,
+                  Options               options);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
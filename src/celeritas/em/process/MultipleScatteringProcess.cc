@@ -18,13 +18,15 @@ namespace celeritas
 MultipleScatteringProcess::MultipleScatteringProcess(
     SPConstParticles particles,
     SPConstMaterials materials,
-    SPConstImported  process_data)
+    SPConstImported  process_data,
+    Options          options)
     : particles_(std::move(particles))
     , materials_(std::move(materials))
     , imported_(process_data,
                 particles_,
                 ImportProcessClass::msc,
                 {pdg::electron(), pdg::positron()})
+    , options_(options)
 {
     CELER_EXPECT(particles_);
 }
@@ -37,7 +39,7 @@ auto MultipleScatteringProcess::build_models(ActionIdIter start_id) const
     -> VecModel
 {
     return {std::make_shared<UrbanMscModel>(
-        *start_id++, *particles_, *materials_)};
+        *start_id++, *particles_, *materials_, options_)};
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas/em/model/UrbanMscModel.hh"
 #include "celeritas/mat/MaterialParams.hh"
 #include "celeritas/phys/ImportedProcessAdapter.hh"
 #include "celeritas/phys/ParticleParams.hh"
@@ -26,13 +27,15 @@ class MultipleScatteringProcess : public Process
     using SPConstParticles = std::shared_ptr<const ParticleParams>;
     using SPConstMaterials = std::shared_ptr<const MaterialParams>;
     using SPConstImported  = std::shared_ptr<const ImportedProcesses>;
+    using Options          = UrbanMscModel::Options;
     //!@}
 
   public:
     // Construct with imported data
     MultipleScatteringProcess(SPConstParticles particles,
                               SPConstMaterials materials,
-                              SPConstImported  process_data);
+                              SPConstImported  process_data,
+                              Options          options);
 
     // Construct the models associated with this process
     VecModel build_models(ActionIdIter start_id) const final;
@@ -50,6 +53,7 @@ class MultipleScatteringProcess : public Process
     SPConstParticles       particles_;
     SPConstMaterials       materials_;
     ImportedProcessAdapter imported_;
+    Options                options_;
 };
 
 //---------------------------------------------------------------------------//
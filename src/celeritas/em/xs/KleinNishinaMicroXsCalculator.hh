@@ -0,0 +1,141 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/xs/KleinNishinaMicroXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/Quantity.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/mat/ElementView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the Compton scattering cross section per atom.
+ *
+ * This is the empirical parameterization of the Klein-Nishina cross section
+ * for bound electrons used by Geant4's \c G4KleinNishinaCompton (and \c
+ * G4KleinNishinaModel) to build the lambda tables. It reproduces the data
+ * with an accuracy of a few percent above 10 keV for Z in [1, 100]. Below a
+ * threshold energy \f$ T_0 \f$ the cross section is extrapolated with a
+ * smooth exponential suppression.
+ *
+ * \sa G4KleinNishinaCompton::ComputeCrossSectionPerAtom
+ */
+class KleinNishinaMicroXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using XsUnits = units::Barn;
+    using Energy  = units::MevEnergy;
+    using Mass    = units::MevMass;
+    //!@}
+
+  public:
+    // Construct with electron mass and incident energy
+    inline CELER_FUNCTION KleinNishinaMicroXsCalculator(Mass   electron_mass,
+                                                        Energy energy);
+
+    // Compute cross section [b]
+    inline CELER_FUNCTION real_type operator()(const ElementView& el) const;
+
+  private:
+    real_type inv_electron_mass_;
+    real_type inc_energy_;
+
+    //// HELPER FUNCTIONS ////
+
+    inline CELER_FUNCTION real_type calc_xs(real_type z, real_type energy) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with electron mass and incident energy.
+ */
+CELER_FUNCTION
+KleinNishinaMicroXsCalculator::KleinNishinaMicroXsCalculator(Mass   electron_mass,
+                                                             Energy energy)
+    : inv_electron_mass_(1 / electron_mass.value()), inc_energy_(energy.value())
+{
+    CELER_EXPECT(electron_mass > zero_quantity());
+    CELER_EXPECT(energy > zero_quantity());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute the cross section per atom [b].
+ */
+CELER_FUNCTION real_type
+KleinNishinaMicroXsCalculator::operator()(const ElementView& el) const
+{
+    const real_type z = el.atomic_number();
+    CELER_EXPECT(z >= 1);
+
+    // Below the threshold energy the parameterization is not valid
+    const real_type t0 = z < real_type(1.5) ? real_type(40e-3)
+                                             : real_type(15e-3);
+    real_type result = this->calc_xs(z, celeritas::max(inc_energy_, t0));
+
+    if (inc_energy_ < t0)
+    {
+        // Suppress the cross section exponentially, with the slope at the
+        // threshold energy estimated from a finite difference
+        constexpr real_type dt0 = 1e-3;
+        const real_type     c1  = -t0 * (this->calc_xs(z, t0 + dt0) - result)
+                             / (result * dt0);
+        const real_type c2 = z > real_type(1.5)
+                                 ? real_type(0.375)
+                                       - real_type(0.0556) * el.log_z()
+                                 : real_type(0.150);
+        const real_type y = std::log(inc_energy_ / t0);
+        result *= std::exp(-y * (c1 + c2 * y));
+    }
+
+    CELER_ENSURE(result >= 0);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate the parameterized cross section [b] above the threshold energy.
+ */
+CELER_FUNCTION real_type KleinNishinaMicroXsCalculator::calc_xs(
+    real_type z, real_type energy) const
+{
+    constexpr real_type a = 20.0;
+    constexpr real_type b = 230.0;
+    constexpr real_type c = 440.0;
+
+    constexpr real_type d1 = 2.7965e-1, d2 = -1.8300e-1, d3 = 6.7527,
+                        d4 = -1.9798e+1;
+    constexpr real_type e1 = 1.9756e-5, e2 = -1.0205e-2, e3 = -7.3913e-2,
+                        e4 = 2.7079e-2;
+    constexpr real_type f1 = -3.9178e-7, f2 = 6.8241e-5, f3 = 6.0480e-5,
+                        f4 = 3.0274e-4;
+
+    const real_type p1 = z * (d1 + e1 * z + f1 * ipow<2>(z));
+    const real_type p2 = z * (d2 + e2 * z + f2 * ipow<2>(z));
+    const real_type p3 = z * (d3 + e3 * z + f3 * ipow<2>(z));
+    const real_type p4 = z * (d4 + e4 * z + f4 * ipow<2>(z));
+
+    const real_type x = energy * inv_electron_mass_;
+    return p1 * std::log(1 + 2 * x) / x
+           + (p2 + p3 * x + p4 * ipow<2>(x))
+                 / (1 + a * x + b * ipow<2>(x) + c * ipow<3>(x));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "celeritas/Quantities.hh"
 
 namespace celeritas
@@ -31,6 +34,33 @@ enum class MscModelSelection
     size_
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Production cuts for a group of volumes.
+ *
+ * This creates a Geant4 region whose root logical volumes are the named
+ * volumes (daughters are included unless they belong to another region).
+ * Volume names are matched without the pointer extension that GDML may add.
+ * The range cut applies to gammas, electrons, positrons, and protons.
+ *
+ * Geant4 builds a separate material-cuts couple, and physics tables, for
+ * each combination of material and cuts in use. These are imported as
+ * separate materials, so a volume in this region gets the same composition
+ * as a volume of the same material elsewhere but different cutoffs.
+ */
+struct GeantRegionCuts
+{
+    std::string              name;             //!< Region name
+    std::vector<std::string> volumes;          //!< Logical volume names
+    real_type                production_cut{}; //!< Range cut [cm]
+
+    //! Whether the region is defined
+    explicit operator bool() const
+    {
+        return !name.empty() && !volumes.empty() && production_cut > 0;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Construction options for geant physics.
@@ -48,6 +78,7 @@ enum class MscModelSelection
  * - \c min_energy: lowest energy of any EM physics process
  * - \c max_energy: highest energy of any EM physics process
  * - \c linear_loss_limit: see \c PhysicsParamsOptions::linear_loss_limit
+ * - \c region_cuts: production cuts for volumes outside the default region
  */
 struct GeantPhysicsOptions
 {
@@ -64,6 +95,8 @@ struct GeantPhysicsOptions
     units::MevEnergy min_energy{0.1 * 1e-3}; // 0.1 keV
     units::MevEnergy max_energy{100 * 1e6};  // 100 TeV
     real_type        linear_loss_limit{0.01};
+
+    std::vector<GeantRegionCuts> region_cuts;
 };
 
 //---------------------------------------------------------------------------//
@@ -91,6 +91,31 @@ void to_json(nlohmann::json& j, const BremsModelSelection& value)
     j = std::string{to_cstring(value)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Read region cuts from JSON.
+ */
+void from_json(const nlohmann::json& j, GeantRegionCuts& cuts)
+{
+    j.at("name").get_to(cuts.name);
+    j.at("volumes").get_to(cuts.volumes);
+    j.at("production_cut").get_to(cuts.production_cut);
+    CELER_VALIDATE(cuts,
+                   << "invalid production cuts for region '" << cuts.name
+                   << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write region cuts to JSON.
+ */
+void to_json(nlohmann::json& j, const GeantRegionCuts& cuts)
+{
+    j = nlohmann::json{{"name", cuts.name},
+                       {"volumes", cuts.volumes},
+                       {"production_cut", cuts.production_cut}};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Read options from JSON.
@@ -115,6 +140,7 @@ void from_json(const nlohmann::json& j, GeantPhysicsOptions& options)
     GPO_LOAD_OPTION(min_energy);
     GPO_LOAD_OPTION(max_energy);
     GPO_LOAD_OPTION(linear_loss_limit);
+    GPO_LOAD_OPTION(region_cuts);
 #undef GPO_LOAD_OPTION
 }
 
@@ -137,6 +163,7 @@ void to_json(nlohmann::json& j, const GeantPhysicsOptions& options)
     GPO_SAVE_OPTION(min_energy);
     GPO_SAVE_OPTION(max_energy);
     GPO_SAVE_OPTION(linear_loss_limit);
+    GPO_SAVE_OPTION(region_cuts);
 #undef GPO_SAVE_OPTION
 }
 
@@ -15,6 +15,12 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 
+// Read region cuts from JSON
+void from_json(const nlohmann::json& j, GeantRegionCuts& cuts);
+
+// Write region cuts to JSON
+void to_json(nlohmann::json& j, const GeantRegionCuts& cuts);
+
 // Read options from JSON
 void from_json(const nlohmann::json& j, GeantPhysicsOptions& opts);
 
@@ -8,9 +8,14 @@
 #include "GeantSetup.hh"
 
 #include <memory>
+#include <vector>
 #include <G4Event.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
 #include <G4ParticleGun.hh>
 #include <G4ParticleTable.hh>
+#include <G4ProductionCuts.hh>
+#include <G4Region.hh>
 #include <G4SystemOfUnits.hh>
 #include <G4VUserActionInitialization.hh>
 #include <G4VUserDetectorConstruction.hh>
@@ -23,6 +28,8 @@
 #    include <G4RunManagerFactory.hh>
 #endif
 
+#include "corecel/cont/Label.hh"
+#include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeAndRedirect.hh"
 
 #include "LoadGdml.hh"
@@ -34,6 +41,47 @@ namespace celeritas
 {
 namespace
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Create a region with its own production cuts.
+ *
+ * The region and cuts are owned by the Geant4 region store.
+ */
+void build_region(const GeantRegionCuts& region_cuts)
+{
+    CELER_VALIDATE(region_cuts,
+                   << "invalid production cuts for region '"
+                   << region_cuts.name << "'");
+
+    auto* cuts = new G4ProductionCuts;
+    cuts->SetProductionCut(region_cuts.production_cut * cm);
+    auto* region = new G4Region(region_cuts.name);
+    region->SetProductionCuts(cuts);
+
+    // Match logical volumes by name, ignoring any pointer extension
+    const auto& all_volumes = *G4LogicalVolumeStore::GetInstance();
+    for (const std::string& name : region_cuts.volumes)
+    {
+        int num_found = 0;
+        for (G4LogicalVolume* lv : all_volumes)
+        {
+            CELER_ASSERT(lv);
+            if (Label::from_geant(lv->GetName()).name != name)
+                continue;
+
+            lv->SetRegion(region);
+            region->AddRootLogicalVolume(lv);
+            ++num_found;
+        }
+        CELER_VALIDATE(num_found > 0,
+                       << "no logical volume named '" << name
+                       << "' for region '" << region_cuts.name << "'");
+    }
+
+    CELER_LOG(debug) << "Created region '" << region_cuts.name << "' with "
+                     << region_cuts.production_cut << " cm production cut";
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Load the detector geometry from a GDML input file.
@@ -41,8 +89,11 @@ namespace
 class DetectorConstruction : public G4VUserDetectorConstruction
 {
   public:
-    // Construct from a GDML filename
-    explicit DetectorConstruction(const std::string& filename)
+    using VecRegionCuts = std::vector<GeantRegionCuts>;
+
+    // Construct from a GDML filename and regions to create
+    DetectorConstruction(const std::string& filename, VecRegionCuts regions)
+        : regions_(std::move(regions))
     {
         phys_vol_world_ = load_gdml(filename);
         CELER_ENSURE(phys_vol_world_);
@@ -51,6 +102,10 @@ class DetectorConstruction : public G4VUserDetectorConstruction
     G4VPhysicalVolume* Construct() override
     {
         CELER_EXPECT(phys_vol_world_);
+        for (const GeantRegionCuts& region_cuts : regions_)
+        {
+            build_region(region_cuts);
+        }
         return phys_vol_world_.release();
     }
 
@@ -62,6 +117,7 @@ class DetectorConstruction : public G4VUserDetectorConstruction
 
   private:
     UPG4PhysicalVolume phys_vol_world_;
+    VecRegionCuts      regions_;
 };
 
 //---------------------------------------------------------------------------//
@@ -160,7 +216,8 @@ GeantSetup::GeantSetup(const std::string& gdml_filename, Options options)
 
     // Initialize geometry
     {
-        auto detector = std::make_unique<DetectorConstruction>(gdml_filename);
+        auto detector = std::make_unique<DetectorConstruction>(
+            gdml_filename, options.region_cuts);
 
         // Get world_volume for store_geometry() before releasing detector ptr
         world_ = detector->world_volume();
@@ -7,10 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "celeritas/Types.hh"
 
@@ -79,6 +81,12 @@ struct VecgeomStateData
     Items<Real3>     dir;
     Items<real_type> next_step;
 
+#if CELERITAS_DEBUG
+    // Distance-to-boundary requests and those satisfied by the saved distance
+    Items<size_type> find_step_count;
+    Items<size_type> cached_step_count;
+#endif
+
     // Wrapper for NavStatePool, vector, or void*
     detail::VecgeomNavCollection<W, M> vgstate;
     detail::VecgeomNavCollection<W, M> vgnext;
@@ -89,7 +97,12 @@ struct VecgeomStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return this->size() > 0 && dir.size() == this->size()
-               && next_step.size() == this->size() && vgstate && vgnext;
+               && next_step.size() == this->size()
+#if CELERITAS_DEBUG
+               && find_step_count.size() == this->size()
+               && cached_step_count.size() == this->size()
+#endif
+               && vgstate && vgnext;
     }
 
     //! State size
@@ -106,8 +119,12 @@ struct VecgeomStateData
         pos       = other.pos;
         dir       = other.dir;
         next_step = other.next_step;
-        vgstate   = other.vgstate;
-        vgnext    = other.vgnext;
+#if CELERITAS_DEBUG
+        find_step_count   = other.find_step_count;
+        cached_step_count = other.cached_step_count;
+#endif
+        vgstate = other.vgstate;
+        vgnext  = other.vgnext;
         return *this;
     }
 };
@@ -128,6 +145,13 @@ void resize(VecgeomStateData<Ownership::value, M>* data,
     resize(&data->pos, size);
     resize(&data->dir, size);
     resize(&data->next_step, size);
+    fill(real_type{0}, &data->next_step);
+#if CELERITAS_DEBUG
+    resize(&data->find_step_count, size);
+    fill(size_type{0}, &data->find_step_count);
+    resize(&data->cached_step_count, size);
+    fill(size_type{0}, &data->cached_step_count);
+#endif
     data->vgstate.resize(params.max_depth, size);
     data->vgnext.resize(params.max_depth, size);
 
@@ -32,7 +32,8 @@ namespace celeritas
 /*!
  * Navigate through a VecGeom geometry on a single thread.
  *
- * For a description of ordering requirements, see:
+ * For a description of ordering requirements and the reuse of the
+ * distance to the next boundary, see:
  * \sa OrangeTrackView
  *
  * \code
@@ -141,6 +142,10 @@ class VecgeomTrackView
     Real3&     pos_;
     Real3&     dir_;
     real_type& next_step_;
+#if CELERITAS_DEBUG
+    size_type& find_step_count_;
+    size_type& cached_step_count_;
+#endif
     //!@}
 
     //// HELPER FUNCTIONS ////
@@ -150,6 +155,9 @@ class VecgeomTrackView
 
     //! Get a reference to the current volume
     inline CELER_FUNCTION const Volume& volume() const;
+
+    // Tally a distance-to-boundary request in debug mode
+    CELER_FORCEINLINE_FUNCTION void tally_next_step(bool cached);
 };
 
 //---------------------------------------------------------------------------//
@@ -168,6 +176,10 @@ VecgeomTrackView::VecgeomTrackView(const ParamsRef& params,
     , pos_(states.pos[thread])
     , dir_(states.dir[thread])
     , next_step_(states.next_step[thread])
+#if CELERITAS_DEBUG
+    , find_step_count_(states.find_step_count[thread])
+    , cached_step_count_(states.cached_step_count[thread])
+#endif
 {
 }
 
@@ -286,6 +298,7 @@ CELER_FUNCTION Propagation VecgeomTrackView::find_next_step(real_type max_step)
     if (next_step_ > max_step)
     {
         // Cached next step is beyond the given step
+        this->tally_next_step(true);
         Propagation result;
         result.distance = max_step;
         result.boundary = false;
@@ -297,6 +310,7 @@ CELER_FUNCTION Propagation VecgeomTrackView::find_next_step(real_type max_step)
         next_step_ = 0;
     }
 
+    this->tally_next_step(this->has_next_step());
     if (this->has_next_step())
     {
         // Already cached
@@ -487,5 +501,21 @@ CELER_FUNCTION const vecgeom::LogicalVolume& VecgeomTrackView::volume() const
     return *physvol_ptr->GetLogicalVolume();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tally a distance-to-boundary request in debug mode.
+ */
+CELER_FUNCTION void
+VecgeomTrackView::tally_next_step(CELER_MAYBE_UNUSED bool cached)
+{
+#if CELERITAS_DEBUG
+    ++find_step_count_;
+    if (cached)
+    {
+        ++cached_step_count_;
+    }
+#endif
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
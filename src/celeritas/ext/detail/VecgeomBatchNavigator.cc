@@ -0,0 +1,218 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/detail/VecgeomBatchNavigator.cc
+//---------------------------------------------------------------------------//
+#include "VecgeomBatchNavigator.hh"
+
+#include <vector>
+#include <VecGeom/base/SOA3D.h>
+#include <VecGeom/base/Transformation3D.h>
+#include <VecGeom/navigation/NavigationState.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedVolume.h>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/SoftEqual.hh"
+
+#include "../VecgeomTrackView.hh"
+#include "BVHNavigator.hh"
+#include "VecgeomCompatibility.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with geometry data.
+ */
+VecgeomBatchNavigator::VecgeomBatchNavigator(const ParamsRef& params,
+                                             const StateRef&  states)
+    : params_(params), states_(states)
+{
+    CELER_EXPECT(params_);
+    CELER_EXPECT(states_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the next step for tracks in the same volume.
+ *
+ * The state update after the distance calculation follows
+ * \c BVHNavigator::ComputeStepAndNextVolume so that the batched and scalar
+ * navigation give the same next volume. When relocating out of the mother,
+ * the point is pushed past the boundary by \c kBoundaryPush only once: the
+ * local point of a track that started on a boundary is already pushed.
+ */
+void VecgeomBatchNavigator::operator()(SpanConstThread tracks,
+                                       SpanConstReal   max_steps) const
+{
+    CELER_EXPECT(tracks.size() == max_steps.size());
+
+    using Precision     = vecgeom::Precision;
+    using Vector3D      = vecgeom::Vector3D<Precision>;
+    using NavState      = vecgeom::NavigationState;
+    using PlacedVolume  = vecgeom::VPlacedVolume;
+    using LogicalVolume = vecgeom::LogicalVolume;
+
+    //// Transform uncached tracks into the local frame ////
+
+    std::vector<size_type>    lanes;
+    std::vector<Precision>    push;
+    std::vector<Precision>    limit;
+    vecgeom::SOA3D<Precision> points;
+    vecgeom::SOA3D<Precision> dirs;
+    const LogicalVolume*      lvol = nullptr;
+    lanes.reserve(tracks.size());
+    push.reserve(tracks.size());
+    limit.reserve(tracks.size());
+    points.reserve(tracks.size());
+    dirs.reserve(tracks.size());
+
+    for (auto i : range(tracks.size()))
+    {
+        const ThreadId  tid   = tracks[i];
+        const NavState& state = states_.vgstate.at(params_.max_depth, tid);
+        CELER_ASSERT(!state.IsOutside());
+
+        Precision lane_push = state.IsOnBoundary() ? BVHNavigator::kBoundaryPush
+                                                   : 0;
+        if (states_.next_step[tid] != 0 || max_steps[i] < lane_push)
+        {
+            // Distance is cached or too close for the step to leave the
+            // boundary: use the scalar navigator
+            continue;
+        }
+
+        const LogicalVolume* cur_lvol = state.Top()->GetLogicalVolume();
+        CELER_ASSERT(!lvol || cur_lvol == lvol);
+        lvol = cur_lvol;
+
+        vecgeom::Transformation3D m;
+        state.TopMatrix(m);
+        Vector3D localdir = m.TransformDirection(to_vector(states_.dir[tid]));
+        Vector3D localpoint = m.Transform(to_vector(states_.pos[tid]))
+                              + lane_push * localdir;
+
+        lanes.push_back(i);
+        push.push_back(lane_push);
+        limit.push_back(max_steps[i] - lane_push);
+        points.push_back(localpoint);
+        dirs.push_back(localdir);
+    }
+
+    const size_type num_lanes = lanes.size();
+    if (num_lanes == 0)
+    {
+        return;
+    }
+
+    //// Calculate the distances over all lanes ////
+
+    // Distance to exit the current volume
+    std::vector<Precision> step(num_lanes);
+    lvol->GetUnplacedVolume()->DistanceToOut(
+        points, dirs, limit.data(), step.data());
+    for (Precision& s : step)
+    {
+        s = max<Precision>(s, 0);
+    }
+
+    // Distance to enter each daughter, limited by the closest so far
+    std::vector<const PlacedVolume*> hit(num_lanes, nullptr);
+    std::vector<Precision>           dist(num_lanes);
+    for (const PlacedVolume* daughter : lvol->GetDaughters())
+    {
+        daughter->DistanceToIn(points, dirs, step.data(), dist.data());
+        for (auto j : range(num_lanes))
+        {
+            if (dist[j] >= 0 && dist[j] < step[j])
+            {
+                step[j] = dist[j];
+                hit[j]  = daughter;
+            }
+        }
+    }
+
+    //// Update the next state of each track ////
+
+    for (auto j : range(num_lanes))
+    {
+        const size_type i     = lanes[j];
+        const ThreadId  tid   = tracks[i];
+        const NavState& state = states_.vgstate.at(params_.max_depth, tid);
+        NavState&       next  = states_.vgnext.at(params_.max_depth, tid);
+
+        state.CopyTo(&next);
+        Precision s = step[j];
+        if (s == vecgeom::kInfLength && limit[j] > 0)
+        {
+            // Missed the volume's own surface: leave it
+            next.SetBoundaryState(true);
+            do
+            {
+                next.Pop();
+            } while (next.Top()->IsAssembly());
+            s = vecgeom::kTolerance;
+        }
+        else if (s > limit[j])
+        {
+            // Step is limited by physics
+            next.SetBoundaryState(false);
+            s = limit[j];
+        }
+        else
+        {
+            next.SetBoundaryState(true);
+        }
+
+        if (next.IsOnBoundary())
+        {
+            if (!hit[j])
+            {
+                // Pop out of the mothers that don't contain the pushed point.
+                // The local point already includes the push off the starting
+                // boundary, so the step is measured from it.
+                const PlacedVolume* mother      = next.Top();
+                Vector3D            transformed = points[j];
+                transformed += (s + BVHNavigator::kBoundaryPush) * dirs[j];
+                do
+                {
+                    next.SetLastExited();
+                    next.Pop();
+                    transformed
+                        = mother->GetTransformation()->InverseTransform(
+                            transformed);
+                    mother = next.Top();
+                } while (mother
+                         && (mother->IsAssembly()
+                             || !mother->UnplacedContains(transformed)));
+            }
+            else
+            {
+                next.Push(hit[j]);
+            }
+        }
+
+        // Save the distance from the unpushed position as
+        // VecgeomTrackView::find_next_step does
+        real_type& next_step = states_.next_step[tid];
+        next_step            = s + push[j];
+        if (!next.IsOnBoundary())
+        {
+            CELER_ASSERT(soft_equal(next_step, max_steps[i]));
+            next_step = max_steps[i];
+        }
+        next_step = max(next_step, VecgeomTrackView::extra_push());
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/ext/detail/VecgeomBatchNavigator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+#include "../VecgeomData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the next boundary for a batch of host tracks in the same volume.
+ *
+ * \c VecgeomTrackView navigates each track separately through the BVH of its
+ * current volume. On host, VecGeom solids also provide distance functions
+ * that take a structure-of-arrays of points and directions, which are
+ * evaluated over SIMD lanes when VecGeom is built with a vector backend. This
+ * class transforms a batch of tracks in one logical volume into the local
+ * frame and calls the vector \c DistanceToOut of that volume and
+ * \c DistanceToIn of each of its daughters.
+ *
+ * The distance and next navigation state are stored in the track's geometry
+ * state just as \c VecgeomTrackView::find_next_step would store them, so that
+ * a following call to that function with the same or a shorter step reuses
+ * them. Tracks that already have a cached distance, or whose step is shorter
+ * than the push off a boundary, are left to the scalar navigator.
+ *
+ * \code
+   VecgeomBatchNavigator navigate(params, states);
+   navigate(make_span(track_ids), make_span(step_limits));
+   \endcode
+ */
+class VecgeomBatchNavigator
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ParamsRef       = HostCRef<VecgeomParamsData>;
+    using StateRef        = HostRef<VecgeomStateData>;
+    using SpanConstThread = Span<const ThreadId>;
+    using SpanConstReal   = Span<const real_type>;
+    //!@}
+
+  public:
+    // Construct with geometry data
+    VecgeomBatchNavigator(const ParamsRef& params, const StateRef& states);
+
+    // Find the next step for tracks in the same volume
+    void operator()(SpanConstThread tracks, SpanConstReal max_steps) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
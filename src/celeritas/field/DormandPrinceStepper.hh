@@ -56,6 +56,10 @@ namespace celeritas
      y_{n+1/2}   = y_n + (h/2) \Sigma_{n=1}^{7} c^{*}_i k_i
    \f]
  * with the coefficients \f$c^{*}\f$ taken from L. F. Shampine (1986).
+ *
+ * The method has the "first same as last" (FSAL) property: the seventh
+ * evaluation is the derivative at the end state, which is returned so that the
+ * next step starting from that state can skip its first evaluation.
  */
 template<class EquationT>
 class DormandPrinceStepper
@@ -77,6 +81,17 @@ class DormandPrinceStepper
     CELER_FUNCTION result_type operator()(real_type       step,
                                           const OdeState& beg_state) const;
 
+    // Adaptive step size control with a known starting derivative
+    CELER_FUNCTION result_type operator()(real_type       step,
+                                          const OdeState& beg_state,
+                                          const OdeState& beg_deriv) const;
+
+    //! Evaluate the derivative of the state (right hand side of the ODE)
+    CELER_FUNCTION OdeState calc_deriv(const OdeState& state) const
+    {
+        return calc_rhs_(state);
+    }
+
   private:
     // Functor to calculate the force applied to a particle
     EquationT calc_rhs_;
@@ -93,6 +108,23 @@ CELER_FUNCTION auto
 DormandPrinceStepper<E>::operator()(real_type       step,
                                     const OdeState& beg_state) const
     -> result_type
+{
+    return (*this)(step, beg_state, calc_rhs_(beg_state));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate using the derivative at the beginning of the step.
+ *
+ * The derivative \c beg_deriv is usually the \c end_deriv of the previous
+ * step result.
+ */
+template<class E>
+CELER_FUNCTION auto
+DormandPrinceStepper<E>::operator()(real_type       step,
+                                    const OdeState& beg_state,
+                                    const OdeState& beg_deriv) const
+    -> result_type
 {
     using celeritas::axpy;
     using R = real_type;
@@ -142,8 +174,8 @@ DormandPrinceStepper<E>::operator()(real_type       step,
     result_type result;
 
     // First step
-    OdeState k1    = calc_rhs_(beg_state);
-    OdeState state = beg_state;
+    const OdeState& k1    = beg_deriv;
+    OdeState        state = beg_state;
     axpy(a11 * step, k1, &state);
 
     // Second step
@@ -185,8 +217,9 @@ DormandPrinceStepper<E>::operator()(real_type       step,
     axpy(a65 * step, k5, &result.end_state);
     axpy(a66 * step, k6, &result.end_state);
 
-    // Seventh step: the final step
-    OdeState k7 = calc_rhs_(result.end_state);
+    // Seventh step: the final step, which is the first of the next step
+    result.end_deriv   = calc_rhs_(result.end_state);
+    const OdeState& k7 = result.end_deriv;
 
     // The error estimate
     result.err_state = {{0, 0, 0}, {0, 0, 0}};
@@ -23,6 +23,13 @@ namespace celeritas
 /*!
  * Integrate with and control the quality of the field integration stepper.
  *
+ * The derivative at the start of each accepted substep is carried over from
+ * the end of the previous one, so steppers with the "first same as last"
+ * property do not re-evaluate it. The driver also keeps an estimate of the
+ * largest step that satisfies the chord tolerance, which is used as the first
+ * trial step of the next chord search. The estimate can be saved and restored
+ * to warm-start the integration of a track on its next step.
+ *
  * \note This class is based on G4ChordFinder and G4MagIntegratorDriver.
  */
 template<class StepperT>
@@ -35,13 +42,20 @@ class FieldDriver
 
     // For a given trial step, advance by a sub_step within a tolerance error
     inline CELER_FUNCTION DriverResult advance(real_type       step,
-                                               const OdeState& state) const;
+                                               const OdeState& state);
 
     // An adaptive step size control from G4MagIntegratorDriver
     // Move this to private after all tests with non-uniform field are done
     inline CELER_FUNCTION DriverResult accurate_advance(
         real_type step, const OdeState& state, real_type hinitial) const;
 
+    //! Warm-start the chord search with a previous step estimate (zero: none)
+    CELER_FUNCTION void step_estimate(real_type step)
+    {
+        CELER_EXPECT(step >= 0);
+        step_estimate_ = step;
+    }
+
     //// ACCESSORS ////
 
     CELER_FUNCTION real_type minimum_step() const
@@ -55,6 +69,9 @@ class FieldDriver
         return options_.delta_intersection;
     }
 
+    //! Step satisfying the chord tolerance from the last chord search
+    CELER_FUNCTION real_type step_estimate() const { return step_estimate_; }
+
   private:
     //// DATA ////
 
@@ -64,6 +81,9 @@ class FieldDriver
     // Stepper for this field driver
     StepperT apply_step_;
 
+    // Estimated step length for the next chord search
+    real_type step_estimate_{0};
+
     //// TYPES ////
 
     //! A helper output for private member functions
@@ -76,22 +96,31 @@ class FieldDriver
     struct Integration
     {
         DriverResult end;           //!< Step taken and post-step state
+        OdeState     end_deriv;     //!< Derivative at the post-step state
         real_type    proposed_step; //!< Proposed next step size
     };
 
     //// HEPER FUNCTIONS ////
 
     // Find the next acceptable chord of with the miss-distance
-    inline CELER_FUNCTION ChordSearch
-    find_next_chord(real_type step, const OdeState& state) const;
+    inline CELER_FUNCTION ChordSearch find_next_chord(real_type       step,
+                                                      const OdeState& state,
+                                                      const OdeState& deriv);
+
+    // Advance accurately starting with a known derivative
+    inline CELER_FUNCTION DriverResult
+    accurate_advance(real_type       step,
+                     const OdeState& state,
+                     const OdeState& deriv,
+                     real_type       hinitial) const;
 
     // Advance for a given step and  evaluate the next predicted step.
-    inline CELER_FUNCTION Integration
-    integrate_step(real_type step, const OdeState& state) const;
+    inline CELER_FUNCTION Integration integrate_step(
+        real_type step, const OdeState& state, const OdeState& deriv) const;
 
     // Advance within the truncated error and estimate a good next step size
-    inline CELER_FUNCTION Integration one_good_step(real_type       step,
-                                                    const OdeState& state) const;
+    inline CELER_FUNCTION Integration one_good_step(
+        real_type step, const OdeState& state, const OdeState& deriv) const;
 
     // Propose a next step size from a given step size and associated error
     inline CELER_FUNCTION real_type new_step_size(real_type step,
@@ -135,10 +164,13 @@ FieldDriver<StepperT>::FieldDriver(const FieldDriverOptions& options,
  */
 template<class StepperT>
 CELER_FUNCTION DriverResult
-FieldDriver<StepperT>::advance(real_type step, const OdeState& state) const
+FieldDriver<StepperT>::advance(real_type step, const OdeState& state)
 {
+    // Derivative at the starting state, shared by all trial steps
+    OdeState deriv = apply_step_.calc_deriv(state);
+
     // Output with a step control error
-    ChordSearch output = this->find_next_chord(step, state);
+    ChordSearch output = this->find_next_chord(step, state, deriv);
 
     // Evaluate the relative error
     real_type rel_error = output.error
@@ -149,7 +181,8 @@ FieldDriver<StepperT>::advance(real_type step, const OdeState& state) const
         // Discard the original end state and advance more accurately with the
         // newly proposed step
         real_type next_step = this->new_step_size(step, rel_error);
-        output.end = this->accurate_advance(output.end.step, state, next_step);
+        output.end = this->accurate_advance(
+            output.end.step, state, deriv, next_step);
     }
 
     return output.end;
@@ -159,27 +192,36 @@ FieldDriver<StepperT>::advance(real_type step, const OdeState& state) const
 /*!
  * Find the next acceptable chord of which the miss-distance is smaller than
  * a given reference (delta_chord) and evaluate the associated error.
+ *
+ * The first trial is limited by the step estimate from the previous search,
+ * and the estimate is updated from the miss-distance of the accepted chord.
  */
 template<class StepperT>
 CELER_FUNCTION auto
 FieldDriver<StepperT>::find_next_chord(real_type       step,
-                                       const OdeState& state) const
-    -> ChordSearch
+                                       const OdeState& state,
+                                       const OdeState& deriv) -> ChordSearch
 {
     // Output with a step control error
     ChordSearch output;
 
+    if (step_estimate_ > 0)
+    {
+        step = min(step, step_estimate_);
+    }
+
     bool               succeeded       = false;
     auto               remaining_steps = options_.max_nsteps;
     FieldStepperResult result;
+    real_type          dchord;
 
     do
     {
         // Try with the proposed step
-        result = apply_step_(step, state);
+        result = apply_step_(step, state, deriv);
 
         // Check whether the distance to the chord is smaller than the reference
-        real_type dchord = detail::distance_chord(
+        dchord = detail::distance_chord(
             state, result.mid_state, result.end_state);
 
         if (dchord > options_.delta_chord + options_.dchord_tol)
@@ -196,6 +238,12 @@ FieldDriver<StepperT>::find_next_chord(real_type       step,
     // TODO: loop check and handle rare cases if happen
     CELER_ASSERT(succeeded);
 
+    // Extrapolate to the step whose miss-distance equals the chord tolerance
+    // (the miss-distance is quadratic in the step length), which may be
+    // longer than the step requested. A straight trajectory has no limit.
+    step_estimate_ = dchord > 0 ? step * std::sqrt(options_.delta_chord / dchord)
+                                : 0;
+
     // Update step, position and momentum
     output.end.step  = step;
     output.end.state = result.end_state;
@@ -216,6 +264,24 @@ FieldDriver<StepperT>::find_next_chord(real_type       step,
 template<class StepperT>
 CELER_FUNCTION DriverResult FieldDriver<StepperT>::accurate_advance(
     real_type step, const OdeState& state, real_type hinitial) const
+{
+    return this->accurate_advance(
+        step, state, apply_step_.calc_deriv(state), hinitial);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accurate advance starting with the derivative at the given state.
+ *
+ * The derivative at the end of each substep is reused at the start of the
+ * next.
+ */
+template<class StepperT>
+CELER_FUNCTION DriverResult
+FieldDriver<StepperT>::accurate_advance(real_type       step,
+                                        const OdeState& state,
+                                        const OdeState& deriv,
+                                        real_type       hinitial) const
 {
     CELER_ASSERT(step > 0);
 
@@ -235,6 +301,7 @@ CELER_FUNCTION DriverResult FieldDriver<StepperT>::accurate_advance(
     // Output with the next good step
     Integration output;
     output.end.state = state;
+    output.end_deriv = deriv;
 
     // Perform integration
     bool      succeeded       = false;
@@ -243,7 +310,7 @@ CELER_FUNCTION DriverResult FieldDriver<StepperT>::accurate_advance(
 
     do
     {
-        output = this->integrate_step(h, output.end.state);
+        output = this->integrate_step(h, output.end.state, output.end_deriv);
 
         curve_length += output.end.step;
 
@@ -275,7 +342,8 @@ CELER_FUNCTION DriverResult FieldDriver<StepperT>::accurate_advance(
 template<class StepperT>
 CELER_FUNCTION auto
 FieldDriver<StepperT>::integrate_step(real_type       step,
-                                      const OdeState& state) const
+                                      const OdeState& state,
+                                      const OdeState& deriv) const
     -> Integration
 {
     // Output with a next proposed step
@@ -283,15 +351,16 @@ FieldDriver<StepperT>::integrate_step(real_type       step,
 
     if (step > options_.minimum_step)
     {
-        output = this->one_good_step(step, state);
+        output = this->one_good_step(step, state, deriv);
     }
     else
     {
         // Do an integration step for a small step (a.k.a quick advance)
-        FieldStepperResult result = apply_step_(step, state);
+        FieldStepperResult result = apply_step_(step, state, deriv);
 
         // Update position and momentum
         output.end.state = result.end_state;
+        output.end_deriv = result.end_deriv;
 
         real_type dyerr = detail::truncation_error(
             step, options_.epsilon_rel_max, state, result.err_state);
@@ -313,7 +382,9 @@ FieldDriver<StepperT>::integrate_step(real_type       step,
  */
 template<class StepperT>
 CELER_FUNCTION auto
-FieldDriver<StepperT>::one_good_step(real_type step, const OdeState& state) const
+FieldDriver<StepperT>::one_good_step(real_type       step,
+                                     const OdeState& state,
+                                     const OdeState& deriv) const
     -> Integration
 {
     // Output with a proposed next step
@@ -327,7 +398,7 @@ FieldDriver<StepperT>::one_good_step(real_type step, const OdeState& state) cons
 
     do
     {
-        result  = apply_step_(step, state);
+        result  = apply_step_(step, state, deriv);
         errmax2 = detail::truncation_error(
             step, options_.epsilon_rel_max, state, result.err_state);
 
@@ -353,6 +424,7 @@ FieldDriver<StepperT>::one_good_step(real_type step, const OdeState& state) cons
     // Update state, step taken by this trial and the next predicted step
     output.end.state = result.end_state;
     output.end.step  = step;
+    output.end_deriv = result.end_deriv;
     output.proposed_step = (errmax2 > ipow<2>(options_.errcon))
                                ? options_.safety * step
                                      * fastpow(errmax2, half() * options_.pgrow)
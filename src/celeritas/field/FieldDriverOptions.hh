@@ -16,17 +16,25 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Configuration options for the field driver.
+ *
+ * The length tolerances are coarser when \c real_type is single precision,
+ * since positions in a detector-sized geometry are only resolved to a few
+ * microns.
  */
 struct FieldDriverOptions
 {
     //! The minimum length of the field step
-    real_type minimum_step = 1.0e-5 * units::millimeter;
+    real_type minimum_step
+        = (CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1.0e-5 : 1.0e-3)
+          * units::millimeter;
 
     //! The closest miss distance
     real_type delta_chord = 0.25 * units::millimeter;
 
     //! Accuracy of intersection of the boundary crossing
-    real_type delta_intersection = 1.0e-4 * units::millimeter;
+    real_type delta_intersection
+        = (CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1.0e-4 : 1.0e-2)
+          * units::millimeter;
 
     //! Relative error scale on the step length
     real_type epsilon_step = 1.0e-5;
@@ -56,10 +64,13 @@ struct FieldDriverOptions
     short int max_nsteps = 100;
 
     //! Initial step tolerance
-    static constexpr real_type initial_step_tol = 1e-6;
+    static constexpr real_type initial_step_tol
+        = CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-6 : 1e-4;
 
     //! Chord distance fudge factor
-    static constexpr real_type dchord_tol = 1e-5 * units::millimeter;
+    static constexpr real_type dchord_tol
+        = (CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-5 : 1e-3)
+          * units::millimeter;
 
     //! Whether all data are assigned and valid
     explicit CELER_FUNCTION operator bool() const
@@ -65,6 +65,18 @@ class FieldPropagator
     // Distance to bump or to consider a "zero" movement
     inline CELER_FUNCTION real_type bump_distance() const;
 
+    //! Restore the driver's step estimate from a previous propagation
+    CELER_FUNCTION void step_estimate(real_type step)
+    {
+        driver_.step_estimate(step);
+    }
+
+    //! Driver's step estimate to save for the next propagation
+    CELER_FUNCTION real_type step_estimate() const
+    {
+        return driver_.step_estimate();
+    }
+
   private:
     //// DATA ////
 
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/FieldRegionData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/data/Collection.hh"
+#include "orange/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Volumes in which the magnetic field is neglected.
+ *
+ * The flag is stored as a \c char because \c bool collections can't be
+ * copied between host and device.
+ */
+template<Ownership W, MemSpace M>
+struct FieldRegionParamsData
+{
+    template<class T>
+    using VolumeItems = celeritas::Collection<T, W, M, VolumeId>;
+
+    VolumeItems<char> field_free;
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !field_free.empty();
+    }
+
+    //! Whether charged tracks in the volume move in straight lines
+    CELER_FUNCTION bool is_field_free(VolumeId vol) const
+    {
+        CELER_EXPECT(vol < field_free.size());
+        return field_free[vol];
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    FieldRegionParamsData& operator=(const FieldRegionParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        field_free = other.field_free;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
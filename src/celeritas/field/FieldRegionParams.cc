@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/FieldRegionParams.cc
+//---------------------------------------------------------------------------//
+#include "FieldRegionParams.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Join.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Flag the volumes with the given names.
+ *
+ * All volumes that share a name (e.g., the placements of a logical volume
+ * with different extensions) are flagged.
+ */
+auto FieldRegionParams::field_free_volumes(const GeoParams& geo,
+                                           const VecString& names) -> VecBool
+{
+    VecBool   result(geo.num_volumes(), false);
+    VecString missing;
+    for (const std::string& name : names)
+    {
+        auto vols = geo.find_volumes(name);
+        if (vols.empty())
+        {
+            missing.push_back(name);
+        }
+        for (VolumeId vol : vols)
+        {
+            result[vol.unchecked_get()] = true;
+        }
+    }
+    CELER_VALIDATE(missing.empty(),
+                   << "field-free volumes are not in the geometry: \""
+                   << join(missing.begin(), missing.end(), "\", \"") << '"');
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a flag for each volume.
+ */
+FieldRegionParams::FieldRegionParams(const VecBool& field_free)
+{
+    CELER_EXPECT(!field_free.empty());
+
+    HostVal<FieldRegionParamsData> host_data;
+    auto                           flags = make_builder(&host_data.field_free);
+    flags.reserve(field_free.size());
+    for (bool f : field_free)
+    {
+        flags.push_back(static_cast<char>(f));
+    }
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<FieldRegionParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of volumes without a field.
+ */
+VolumeId::size_type FieldRegionParams::num_field_free() const
+{
+    auto flags
+        = this->host_ref().field_free[AllItems<char, MemSpace::host>{}];
+    return std::count_if(
+        flags.begin(), flags.end(), [](char f) { return f != 0; });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/FieldRegionParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/BoundingBox.hh"
+#include "celeritas/geo/GeoParamsFwd.hh"
+
+#include "FieldRegionData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Volumes in which charged particles are propagated without a field.
+ *
+ * Detectors often have large regions (e.g., outside the solenoid, or in
+ * passive material far from the tracker) where the field is negligible but
+ * the along-step action still integrates the equation of motion for every
+ * charged step. Flagging those volumes lets the along-step action use a
+ * linear propagator in them instead.
+ *
+ * The volumes can be selected by name, or by evaluating the field over each
+ * volume's bounding box and flagging those where the field magnitude stays
+ * below a threshold. Since the geometry doesn't expose per-volume bounding
+ * boxes, they must be provided by the caller. The field is sampled only at
+ * the corners and center of the box, so the threshold is a heuristic for
+ * smoothly varying fields.
+ */
+class FieldRegionParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using HostRef       = HostCRef<FieldRegionParamsData>;
+    using DeviceRef     = DeviceCRef<FieldRegionParamsData>;
+    using VecBool       = std::vector<bool>;
+    using VecString     = std::vector<std::string>;
+    using SpanConstBBox = Span<const BoundingBox>;
+    //!@}
+
+  public:
+    // Flag the volumes with the given names
+    static VecBool
+    field_free_volumes(const GeoParams& geo, const VecString& names);
+
+    // Flag the volumes whose field is below a threshold
+    template<class FieldT>
+    static inline VecBool field_free_volumes(SpanConstBBox bboxes,
+                                             const FieldT& calc_field,
+                                             real_type     threshold);
+
+    // Construct with a flag for each volume
+    explicit FieldRegionParams(const VecBool& field_free);
+
+    //! Number of volumes
+    VolumeId::size_type num_volumes() const
+    {
+        return this->host_ref().field_free.size();
+    }
+
+    // Number of volumes without a field
+    VolumeId::size_type num_field_free() const;
+
+    //! Access field regions on the host
+    const HostRef& host_ref() const { return data_.host(); }
+
+    //! Access field regions on the device
+    const DeviceRef& device_ref() const { return data_.device(); }
+
+  private:
+    CollectionMirror<FieldRegionParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Flag the volumes whose field is below a threshold.
+ *
+ * The field magnitude (in native units) is evaluated at the eight corners and
+ * the center of each bounding box. Volumes with an unassigned or infinite
+ * bounding box always have the field applied.
+ */
+template<class FieldT>
+auto FieldRegionParams::field_free_volumes(SpanConstBBox bboxes,
+                                           const FieldT& calc_field,
+                                           real_type     threshold) -> VecBool
+{
+    CELER_EXPECT(threshold > 0);
+
+    VecBool result(bboxes.size(), false);
+    for (auto i : range(bboxes.size()))
+    {
+        const BoundingBox& bbox = bboxes[i];
+        if (!bbox)
+        {
+            continue;
+        }
+        const Real3& lower = bbox.lower();
+        const Real3& upper = bbox.upper();
+        bool         finite = true;
+        for (auto ax : range(3))
+        {
+            finite = finite && std::isfinite(lower[ax])
+                     && std::isfinite(upper[ax]);
+        }
+        if (!finite)
+        {
+            continue;
+        }
+
+        real_type max_field = 0;
+        for (auto corner : range(8))
+        {
+            Real3 pos;
+            for (auto ax : range(3))
+            {
+                pos[ax] = (corner & (1 << ax)) ? upper[ax] : lower[ax];
+            }
+            max_field = max(max_field, norm(calc_field(pos)));
+        }
+        Real3 center;
+        for (auto ax : range(3))
+        {
+            center[ax] = real_type(0.5) * (lower[ax] + upper[ax]);
+        }
+        max_field = max(max_field, norm(calc_field(center)));
+
+        result[i] = max_field < threshold;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
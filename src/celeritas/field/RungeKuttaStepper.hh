@@ -44,6 +44,17 @@ class RungeKuttaStepper
     CELER_FUNCTION result_type operator()(real_type       step,
                                           const OdeState& beg_state) const;
 
+    // Advance the ODE state with a known starting derivative
+    CELER_FUNCTION result_type operator()(real_type       step,
+                                          const OdeState& beg_state,
+                                          const OdeState& beg_deriv) const;
+
+    //! Evaluate the derivative of the state (right hand side of the ODE)
+    CELER_FUNCTION OdeState calc_deriv(const OdeState& state) const
+    {
+        return calc_rhs_(state);
+    }
+
   private:
     // Return the final state by the 4th order Runge-Kutta method
     CELER_FUNCTION auto do_step(real_type       step,
@@ -83,13 +94,30 @@ template<class E>
 CELER_FUNCTION auto
 RungeKuttaStepper<E>::operator()(real_type step, const OdeState& beg_state) const
     -> result_type
+{
+    return (*this)(step, beg_state, calc_rhs_(beg_state));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the ODE state with a known starting derivative.
+ *
+ * Unlike the Dormand-Prince method, the classical method does not evaluate
+ * the derivative at the end state, so it costs one extra evaluation.
+ */
+template<class E>
+CELER_FUNCTION auto
+RungeKuttaStepper<E>::operator()(real_type       step,
+                                 const OdeState& beg_state,
+                                 const OdeState& beg_deriv) const
+    -> result_type
 {
     using celeritas::axpy;
     real_type           half_step               = step / real_type(2);
     constexpr real_type fourth_order_correction = 1 / real_type(15);
 
-    result_type result;
-    OdeState    beg_slope = calc_rhs_(beg_state);
+    result_type     result;
+    const OdeState& beg_slope = beg_deriv;
 
     // Do two half steps
     result.mid_state = this->do_step(half_step, beg_state, beg_slope);
@@ -105,6 +133,7 @@ RungeKuttaStepper<E>::operator()(real_type step, const OdeState& beg_state) cons
 
     // Output correction with the 4th order coefficient (1/15)
     axpy(fourth_order_correction, result.err_state, &result.end_state);
+    result.end_deriv = calc_rhs_(result.end_state);
 
     return result;
 }
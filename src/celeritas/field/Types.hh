@@ -38,6 +38,7 @@ struct FieldStepperResult
     OdeState mid_state; //!< OdeState at the middle
     OdeState end_state; //!< OdeState at the end
     OdeState err_state; //!< Delta between one full step and two half steps
+    OdeState end_deriv; //!< Derivative of the OdeState at the end
 };
 
 //---------------------------------------------------------------------------//
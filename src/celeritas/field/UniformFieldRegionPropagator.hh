@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/UniformFieldRegionPropagator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "orange/Types.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+
+#include "DormandPrinceStepper.hh"
+#include "FieldRegionData.hh"
+#include "LinearPropagator.hh"
+#include "MakeMagFieldPropagator.hh"
+#include "UniformField.hh"
+#include "UniformFieldData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate in a uniform field, or in a straight line in field-free volumes.
+ *
+ * The volume is checked when the propagator is constructed, so a track that
+ * starts the step in a field-free volume moves in a straight line for the
+ * whole step. Both propagators stop at the next boundary. The field
+ * propagator is only constructed for tracks in a field, and the field
+ * driver's step estimate is left unchanged for straight steps.
+ */
+class UniformFieldRegionPropagator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type   = Propagation;
+    using RegionDataRef = NativeCRef<FieldRegionParamsData>;
+    //!@}
+
+  public:
+    // Construct with field data and track views
+    inline CELER_FUNCTION
+    UniformFieldRegionPropagator(const UniformFieldParams& field,
+                                 const RegionDataRef&      region,
+                                 const ParticleTrackView&  particle,
+                                 GeoTrackView*             geo);
+
+    // Move the track, updating the field driver's step estimate
+    inline CELER_FUNCTION result_type operator()(real_type  dist,
+                                                 real_type* step_estimate);
+
+    //! Whether the track is propagated without a field
+    CELER_FUNCTION bool field_free() const { return field_free_; }
+
+  private:
+    const UniformFieldParams& field_;
+    ParticleTrackView         particle_;
+    GeoTrackView*             geo_;
+    bool                      field_free_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with field data and track views.
+ *
+ * The region data may be unassigned, in which case the field applies
+ * everywhere.
+ */
+CELER_FUNCTION UniformFieldRegionPropagator::UniformFieldRegionPropagator(
+    const UniformFieldParams& field,
+    const RegionDataRef&      region,
+    const ParticleTrackView&  particle,
+    GeoTrackView*             geo)
+    : field_(field)
+    , particle_(particle)
+    , geo_(geo)
+    , field_free_(region && region.is_field_free(geo->volume_id()))
+{
+    CELER_EXPECT(geo_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the track up to a distance or the next boundary.
+ */
+CELER_FUNCTION auto
+UniformFieldRegionPropagator::operator()(real_type  dist,
+                                         real_type* step_estimate)
+    -> result_type
+{
+    CELER_EXPECT(step_estimate);
+
+    if (field_free_)
+    {
+        return LinearPropagator(geo_)(dist);
+    }
+
+    auto propagate = make_mag_field_propagator<DormandPrinceStepper>(
+        UniformField(field_.field), field_.options, particle_, geo_);
+    propagate.step_estimate(*step_estimate);
+    result_type result = propagate(dist);
+    *step_estimate     = propagate.step_estimate();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -48,6 +48,18 @@ class ZHelixStepper
     CELER_FUNCTION auto
     operator()(real_type step, const OdeState& beg_state) const -> result_type;
 
+    // Step with a known starting derivative
+    CELER_FUNCTION auto operator()(real_type       step,
+                                   const OdeState& beg_state,
+                                   const OdeState& beg_deriv) const
+        -> result_type;
+
+    //! Evaluate the derivative of the state (right hand side of the ODE)
+    CELER_FUNCTION OdeState calc_deriv(const OdeState& state) const
+    {
+        return calc_rhs_(state);
+    }
+
   private:
     //// DATA ////
 
@@ -94,10 +106,21 @@ CELER_FUNCTION auto
 ZHelixStepper<E>::operator()(real_type step, const OdeState& beg_state) const
     -> result_type
 {
-    result_type result;
+    return (*this)(step, beg_state, calc_rhs_(beg_state));
+}
 
-    // Evaluate the right hand side of the equation
-    OdeState rhs = calc_rhs_(beg_state);
+//---------------------------------------------------------------------------//
+/*!
+ * Step along the helix using the derivative at the beginning of the step.
+ */
+template<class E>
+CELER_FUNCTION auto ZHelixStepper<E>::operator()(real_type       step,
+                                                 const OdeState& beg_state,
+                                                 const OdeState& beg_deriv) const
+    -> result_type
+{
+    result_type     result;
+    const OdeState& rhs = beg_deriv;
 
     // Calculate the radius of the helix
     real_type radius = std::sqrt(dot_product(beg_state.mom, beg_state.mom)
@@ -121,6 +144,9 @@ ZHelixStepper<E>::operator()(real_type step, const OdeState& beg_state) const
         result.err_state.mom[i] = ZHelixStepper::tolerance();
     }
 
+    // Derivative at the end of the step
+    result.end_deriv = calc_rhs_(result.end_state);
+
     return result;
 }
 
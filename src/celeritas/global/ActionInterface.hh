@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "celeritas/Types.hh"
 
@@ -65,6 +66,11 @@ class ImplicitActionInterface : public virtual ActionInterface
 //---------------------------------------------------------------------------//
 /*!
  * Interface for an action that launches a kernel or performs an action.
+ *
+ * An action is \em concurrent if it modifies only the states of tracks whose
+ * post-step action is itself (plus thread-safe allocations such as
+ * secondaries) and reads only shared params. Consecutive concurrent actions
+ * of the same order can then be executed simultaneously on host.
  */
 class ExplicitActionInterface : public virtual ActionInterface
 {
@@ -85,11 +91,58 @@ class ExplicitActionInterface : public virtual ActionInterface
     //! Dependency ordering of the action
     virtual ActionOrder order() const = 0;
 
+    //! Whether the action is independent of others of the same order
+    virtual bool concurrent() const { return false; }
+
   protected:
     // Protected destructor prevents deletion of pointer-to-interface
     ~ExplicitActionInterface() = default;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interface for an explicit action that also performs other actions.
+ *
+ * A fused action replaces the execution of several explicit actions (e.g. the
+ * interactions of a fixed set of models) with a single kernel. The fused
+ * actions remain in the registry for selecting the post-step action but are
+ * omitted from the action sequence.
+ */
+class FusedActionInterface : public ExplicitActionInterface
+{
+  public:
+    //! Type aliases
+    using VecActionId = std::vector<ActionId>;
+
+  public:
+    //! IDs of the explicit actions performed by this action
+    virtual const VecActionId& fused_actions() const = 0;
+
+  protected:
+    // Protected destructor prevents deletion of pointer-to-interface
+    ~FusedActionInterface() = default;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interface for an explicit action that stores data for each track slot.
+ *
+ * A stepper with a track slot policy can reallocate its states at the end of
+ * a step, moving the alive tracks to different slots. Actions whose state is
+ * indexed by track slot must implement this interface so that the stepper can
+ * resize that state to match.
+ */
+class TrackSlotActionInterface : public ExplicitActionInterface
+{
+  public:
+    //! Reallocate the per-slot state for a new number of track slots
+    virtual void resize_track_slots(size_type num_slots) const = 0;
+
+  protected:
+    // Protected destructor prevents deletion of pointer-to-interface
+    ~TrackSlotActionInterface() = default;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Concrete mixin utility class for managing an action.
@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/BatchNavigationAction.cc
+//---------------------------------------------------------------------------//
+#include "BatchNavigationAction.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/ext/detail/VecgeomBatchNavigator.hh"
+
+#include "CoreTrackView.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Alive track and its physics step limit
+struct BatchTrack
+{
+    VolumeId  volume;
+    ThreadId  thread;
+    real_type step;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID and maximum number of tracks per batch.
+ */
+BatchNavigationAction::BatchNavigationAction(ActionId id, size_type batch_size)
+    : ConcreteAction(id,
+                     "geo-batch-navigate",
+                     "find next boundary for tracks grouped by volume")
+    , batch_size_(batch_size)
+{
+    CELER_VALIDATE(batch_size_ > 0,
+                   << "invalid navigation batch size (must be positive)");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the next step for neutral host tracks.
+ *
+ * The tracks are sorted serially by volume (and thread ID within a volume),
+ * and the batches are navigated in parallel.
+ */
+void BatchNavigationAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+
+    // Gather alive neutral tracks inside the geometry
+    std::vector<BatchTrack> alive;
+    alive.reserve(data.states.size());
+    for (auto tid : range(ThreadId{data.states.size()}))
+    {
+        CoreTrackView track(data.params, data.states, tid);
+        auto          sim = track.make_sim_view();
+        if (sim.status() != TrackStatus::alive || !(sim.step_limit().step > 0))
+        {
+            continue;
+        }
+        if (track.make_particle_view().charge() != zero_quantity())
+        {
+            continue;
+        }
+        auto geo = track.make_geo_view();
+        if (geo.is_outside())
+        {
+            continue;
+        }
+        alive.push_back({geo.volume_id(), tid, sim.step_limit().step});
+    }
+    std::sort(alive.begin(),
+              alive.end(),
+              [](const BatchTrack& a, const BatchTrack& b) {
+                  return a.volume != b.volume ? a.volume < b.volume
+                                              : a.thread < b.thread;
+              });
+
+    // Split into batches that share a volume
+    std::vector<ThreadId>  threads(alive.size());
+    std::vector<real_type> steps(alive.size());
+    std::vector<size_type> offsets;
+    for (auto i : range(alive.size()))
+    {
+        threads[i] = alive[i].thread;
+        steps[i]   = alive[i].step;
+        if (offsets.empty() || alive[i].volume != alive[i - 1].volume
+            || i - offsets.back() == batch_size_)
+        {
+            offsets.push_back(i);
+        }
+    }
+    offsets.push_back(alive.size());
+
+    // Navigate each batch with the vectorized solid distance functions
+    const detail::VecgeomBatchNavigator navigate(data.params.geometry,
+                                                 data.states.geometry);
+    const size_type num_batches = offsets.size() - 1;
+#pragma omp parallel for
+    for (size_type b = 0; b < num_batches; ++b)
+    {
+        const size_type start = offsets[b];
+        const size_type count = offsets[b + 1] - start;
+        navigate(make_span(threads).subspan(start, count),
+                 make_span(steps).subspan(start, count));
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
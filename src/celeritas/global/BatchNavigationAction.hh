@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/BatchNavigationAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the distance to the next boundary for host tracks grouped by volume.
+ *
+ * The along-step action asks the geometry for the next boundary one track at
+ * a time, in track slot order, so consecutive queries usually touch unrelated
+ * volumes. This pre-step action instead sorts the alive neutral tracks by
+ * their current volume and navigates them in batches of up to \c batch_size
+ * tracks that share a volume, using the physics step limit as the maximum
+ * distance. Each batch is evaluated with the vectorized VecGeom solid distance
+ * functions (see \c detail::VecgeomBatchNavigator).
+ *
+ * The result is saved in the geometry state's next-step cache, so the
+ * subsequent query by the propagator (with the same or a shorter step) reuses
+ * it and the transport results are unchanged. Only neutral tracks move in a
+ * straight line over the full physics step: charged tracks are skipped
+ * because the field propagator queries shorter chords and multiple scattering
+ * shortens the geometric step, so a pre-computed distance would rarely be
+ * reused.
+ *
+ * This action is only available with VecGeom, and device tracks are not
+ * batched.
+ */
+class BatchNavigationAction final : public ExplicitActionInterface,
+                                    public ConcreteAction
+{
+  public:
+    // Construct with ID and maximum number of tracks per batch
+    BatchNavigationAction(ActionId id, size_type batch_size);
+
+    // Find the next step for host tracks
+    void execute(CoreHostRef const&) const final;
+
+    //! Device tracks are navigated individually by the along-step action
+    void execute(CoreDeviceRef const&) const final {}
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::pre; }
+
+    //! Maximum number of tracks per batch
+    size_type batch_size() const { return batch_size_; }
+
+  private:
+    size_type batch_size_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+#if !CELERITAS_USE_VECGEOM
+inline BatchNavigationAction::BatchNavigationAction(ActionId  id,
+                                                    size_type batch_size)
+    : ConcreteAction(id, "geo-batch-navigate"), batch_size_(batch_size)
+{
+    CELER_NOT_CONFIGURED("VecGeom");
+}
+
+inline void BatchNavigationAction::execute(CoreHostRef const&) const
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
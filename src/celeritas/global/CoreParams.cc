@@ -21,6 +21,7 @@
 
 #include "ActionInterface.hh"
 #include "ActionRegistry.hh"
+#include "BatchNavigationAction.hh"
 
 namespace celeritas
 {
@@ -96,6 +97,24 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
         "geo-propagation-limit",
         "Propagation substep/range limit"));
 
+    if (input_.transparent_boundaries)
+    {
+        // Construct implicit action for steps ending in a new volume
+        scalars_.crossed_boundary_action = input_.action_reg->next_id();
+        input_.action_reg->insert(std::make_shared<ImplicitGeometryAction>(
+            scalars_.crossed_boundary_action,
+            "geo-crossed-boundary",
+            "Boundary crossed during propagation"));
+    }
+
+    if (input_.navigation_batch_size > 0)
+    {
+        // Construct pre-step action to find host boundary distances; it must
+        // be created after the physics pre-step action that limits the step
+        input_.action_reg->insert(std::make_shared<BatchNavigationAction>(
+            input_.action_reg->next_id(), input_.navigation_batch_size));
+    }
+
     // Save host reference
     host_ref_ = build_params_refs<MemSpace::host>(input_, scalars_);
     if (celeritas::device())
@@ -64,6 +64,12 @@ class CoreParams
         SPConstAction   along_step;
         SPActionRegistry action_reg;
 
+        // Let neutral particles pass through same-material boundaries
+        bool transparent_boundaries{false};
+        // Navigate neutral host tracks in batches of this size with VecGeom
+        // (zero to disable)
+        size_type navigation_batch_size{0};
+
         //! True if all params are assigned
         explicit operator bool() const
         {
@@ -21,11 +21,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Memspace-independent core variables.
+ *
+ * The crossed-boundary action is only assigned if neutral particles are
+ * allowed to pass through boundaries between volumes of the same material.
  */
 struct CoreScalars
 {
     ActionId boundary_action;
     ActionId propagation_limit_action;
+    ActionId crossed_boundary_action;
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
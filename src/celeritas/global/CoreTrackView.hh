@@ -76,6 +76,9 @@ class CoreTrackView
     // Action ID for some other propagation limit (e.g. field stepping)
     inline CELER_FUNCTION ActionId propagation_limit_action() const;
 
+    // Action ID for a boundary already crossed during propagation
+    inline CELER_FUNCTION ActionId crossed_boundary_action() const;
+
   private:
     const StateRef&  states_;
     const ParamsRef& params_;
@@ -212,5 +215,20 @@ CELER_FUNCTION ActionId CoreTrackView::propagation_limit_action() const
     return params_.scalars.propagation_limit_action;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the action ID for a step that ends in a new volume.
+ *
+ * This is only valid if neutral particles pass through boundaries between
+ * volumes of the same material. When such a track enters a volume with a
+ * different material (or leaves the world), the boundary crossing and
+ * material update have already been performed by the along-step action, so
+ * there is nothing left for a post-step action to do.
+ */
+CELER_FUNCTION ActionId CoreTrackView::crossed_boundary_action() const
+{
+    return params_.scalars.crossed_boundary_action;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,235 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EnergyMonitorAction.cc
+//---------------------------------------------------------------------------//
+#include "EnergyMonitorAction.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "ActionRegistry.hh"
+#include "CoreTrackView.hh"
+#include "detail/EnergyMonitorImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add the pre- and post-step actions to the registry.
+ */
+std::shared_ptr<EnergyMonitorAction>
+EnergyMonitorAction::from_params(const ParticleParams& particles,
+                                 const Input&          input,
+                                 ActionRegistry*       actions)
+{
+    CELER_EXPECT(actions);
+    ActionId pre_id = actions->next_id();
+    auto     result = std::make_shared<EnergyMonitorAction>(
+        pre_id, ActionId{pre_id.get() + 1}, particles, input);
+    actions->insert(result->pre_action());
+    actions->insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the pre-step and post-step action IDs.
+ */
+EnergyMonitorAction::EnergyMonitorAction(ActionId              pre_id,
+                                         ActionId              id,
+                                         const ParticleParams& particles,
+                                         const Input&          input)
+    : ConcreteAction(id, "energy-monitor", "check energy conservation")
+    , tolerance_(input.tolerance)
+    , states_(std::make_shared<States>())
+{
+    CELER_EXPECT(pre_id && pre_id != id);
+    CELER_VALIDATE(input,
+                   << "invalid energy monitor input (num_track_slots="
+                   << input.num_track_slots
+                   << ", num_events=" << input.num_events
+                   << ", tolerance=" << input.tolerance << ")");
+
+    EnergyMonitorScalars scalars;
+    scalars.positron = particles.find(pdg::positron());
+    if (auto electron = particles.find(pdg::electron()))
+    {
+        scalars.pair_mass = 2 * particles.get(electron).mass().value();
+    }
+
+    if (input.memspace == MemSpace::host)
+    {
+        resize(&states_->host,
+               scalars,
+               input.num_track_slots,
+               input.num_events);
+        states_->host_ref = states_->host;
+    }
+    else
+    {
+        resize(&states_->device,
+               scalars,
+               input.num_track_slots,
+               input.num_events);
+        states_->device_ref = states_->device;
+    }
+
+    pre_action_ = std::make_shared<PreStepAction>(pre_id, states_);
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+EnergyMonitorAction::~EnergyMonitorAction() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check the step with host data.
+ */
+void EnergyMonitorAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    const auto& state = states_->host_ref;
+    CELER_VALIDATE(state, << "energy monitor was not built for host data");
+    CELER_VALIDATE(state.size() == data.states.size(),
+                   << "energy monitor has " << state.size()
+                   << " track slots but the stepper has "
+                   << data.states.size());
+
+#pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        CoreTrackView track(data.params, data.states, ThreadId{i});
+        detail::energy_monitor_post_track(state, track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Flush the slot sums and reallocate for a new number of track slots.
+ *
+ * The event tallies are kept. Since the tracks are moved to other slots, the
+ * slot sums are added to their events and the slots are cleared: the next
+ * pre-step action assigns each slot to its new track's event.
+ */
+void EnergyMonitorAction::resize_track_slots(size_type num_slots) const
+{
+    CELER_EXPECT(num_slots > 0);
+
+    VecTally tallies = this->tallies();
+
+    HostVal<EnergyMonitorStateData> host_data;
+    resize(&host_data,
+           states_->host ? states_->host.scalars : states_->device.scalars,
+           num_slots,
+           tallies.size());
+    auto event_tally
+        = host_data.event_tally[AllItems<EnergyTally, MemSpace::host>{}];
+    std::copy(tallies.begin(), tallies.end(), event_tally.begin());
+
+    if (states_->host)
+    {
+        states_->host     = host_data;
+        states_->host_ref = states_->host;
+    }
+    else
+    {
+        states_->device     = host_data;
+        states_->device_ref = states_->device;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the tallies accumulated so far for each event.
+ *
+ * Sums that are still privatized in the track slots are added to the copy.
+ */
+auto EnergyMonitorAction::tallies() const -> VecTally
+{
+    HostVal<EnergyMonitorStateData> host_copy;
+    if (states_->host)
+    {
+        host_copy = states_->host;
+    }
+    else
+    {
+        CELER_ASSERT(states_->device);
+        host_copy = states_->device;
+    }
+    HostRef<EnergyMonitorStateData> ref;
+    ref = host_copy;
+    for (auto tid : range(ThreadId{ref.size()}))
+    {
+        detail::flush_energy_tally(ref, tid);
+    }
+
+    auto tallies = ref.event_tally[AllItems<EnergyTally>{}];
+    return {tallies.begin(), tallies.end()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Events whose energy imbalance exceeds the tolerance.
+ *
+ * The tolerance is relative to the kinetic energy of the event's primaries.
+ */
+auto EnergyMonitorAction::nonconserving_events() const -> VecEvent
+{
+    VecEvent result;
+    VecTally tallies = this->tallies();
+    for (auto event : range(EventId{tallies.size()}))
+    {
+        const EnergyTally& t = tallies[event.get()];
+        if (std::fabs(t.imbalance) > tolerance_ * t.primary)
+        {
+            result.push_back(event);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRE-STEP ACTION
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID and shared states.
+ */
+EnergyMonitorAction::PreStepAction::PreStepAction(ActionId                id,
+                                                  std::shared_ptr<States> states)
+    : ConcreteAction(id, "energy-monitor-pre", "save pre-step energy")
+    , states_(std::move(states))
+{
+    CELER_EXPECT(states_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the energy with host data.
+ */
+void EnergyMonitorAction::PreStepAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    const auto& state = states_->host_ref;
+    CELER_VALIDATE(state, << "energy monitor was not built for host data");
+    CELER_VALIDATE(state.size() == data.states.size(),
+                   << "energy monitor has " << state.size()
+                   << " track slots but the stepper has "
+                   << data.states.size());
+
+#pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        CoreTrackView track(data.params, data.states, ThreadId{i});
+        detail::energy_monitor_pre_track(state, track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
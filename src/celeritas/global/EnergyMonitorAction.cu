@@ -0,0 +1,92 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EnergyMonitorAction.cu
+//---------------------------------------------------------------------------//
+#include "EnergyMonitorAction.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "CoreTrackView.hh"
+#include "detail/EnergyMonitorImpl.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+__global__ void
+energy_monitor_pre_kernel(CoreDeviceRef const                   data,
+                          DeviceRef<EnergyMonitorStateData> const state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    CoreTrackView track(data.params, data.states, tid);
+    detail::energy_monitor_pre_track(state, track);
+}
+
+//---------------------------------------------------------------------------//
+__global__ void
+energy_monitor_post_kernel(CoreDeviceRef const                   data,
+                           DeviceRef<EnergyMonitorStateData> const state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    CoreTrackView track(data.params, data.states, tid);
+    detail::energy_monitor_post_track(state, track);
+}
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check the step with device data.
+ */
+void EnergyMonitorAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_VALIDATE(states_->device_ref,
+                   << "energy monitor was not built for device data");
+    CELER_VALIDATE(states_->device_ref.size() == data.states.size(),
+                   << "energy monitor has " << states_->device_ref.size()
+                   << " track slots but the stepper has "
+                   << data.states.size());
+    CELER_LAUNCH_KERNEL(energy_monitor_post,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        states_->device_ref);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the energy with device data.
+ */
+void EnergyMonitorAction::PreStepAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_VALIDATE(states_->device_ref,
+                   << "energy monitor was not built for device data");
+    CELER_VALIDATE(states_->device_ref.size() == data.states.size(),
+                   << "energy monitor has " << states_->device_ref.size()
+                   << " track slots but the stepper has "
+                   << data.states.size());
+    CELER_LAUNCH_KERNEL(energy_monitor_pre,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        states_->device_ref);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,180 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EnergyMonitorAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "EnergyMonitorData.hh"
+
+namespace celeritas
+{
+class ActionRegistry;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check energy conservation of every step and accumulate it by event.
+ *
+ * This optional diagnostic saves the kinetic energy of each track before the
+ * along-step action (with a companion \c pre action) and, after all
+ * interactions, compares it to the post-step energy, the local energy
+ * deposition, and the energy given to secondaries. The results are tallied
+ * per event so that tuned physics (coarser tables, reduced precision) can be
+ * validated during production runs.
+ *
+ * The state is allocated for a number of track slots in the memory space of
+ * the stepper that executes it, and events must be numbered contiguously from
+ * zero. If the stepper changes the number of track slots, the per-slot sums
+ * are flushed to the event tallies and the slot state is reallocated.
+ */
+class EnergyMonitorAction final : public TrackSlotActionInterface,
+                                  public ConcreteAction
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecTally = std::vector<EnergyTally>;
+    using VecEvent = std::vector<EventId>;
+    //!@}
+
+    struct Input
+    {
+        size_type num_track_slots{};
+        size_type num_events{};
+        MemSpace  memspace{MemSpace::host};
+        real_type tolerance{1e-6}; //!< Allowed imbalance / primary energy
+
+        //! Whether the input is valid
+        explicit operator bool() const
+        {
+            return num_track_slots > 0 && num_events > 0
+                   && (memspace == MemSpace::host
+                       || memspace == MemSpace::device)
+                   && tolerance >= 0;
+        }
+    };
+
+  public:
+    // Construct and add the pre- and post-step actions to the registry
+    static std::shared_ptr<EnergyMonitorAction>
+    from_params(const ParticleParams& particles,
+                const Input&          input,
+                ActionRegistry*       actions);
+
+    // Construct with the pre-step and post-step action IDs
+    EnergyMonitorAction(ActionId              pre_id,
+                        ActionId              id,
+                        const ParticleParams& particles,
+                        const Input&          input);
+
+    // Default destructor
+    ~EnergyMonitorAction();
+
+    // Check the step with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Check the step with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    // Flush the slot sums and reallocate for a new number of track slots
+    void resize_track_slots(size_type num_slots) const final;
+
+    //// ACCESSORS ////
+
+    //! Action that saves the pre-step energy
+    const std::shared_ptr<ExplicitActionInterface>& pre_action() const
+    {
+        return pre_action_;
+    }
+
+    //! Relative tolerance for energy conservation
+    real_type tolerance() const { return tolerance_; }
+
+    // Copy the tallies accumulated so far for each event
+    VecTally tallies() const;
+
+    // Events whose energy imbalance exceeds the tolerance
+    VecEvent nonconserving_events() const;
+
+  private:
+    //// TYPES ////
+
+    class PreStepAction;
+
+    struct States
+    {
+        template<MemSpace M>
+        using Value = EnergyMonitorStateData<Ownership::value, M>;
+
+        Value<MemSpace::host>             host;
+        Value<MemSpace::device>           device;
+        HostRef<EnergyMonitorStateData>   host_ref;
+        DeviceRef<EnergyMonitorStateData> device_ref;
+    };
+
+    //// DATA ////
+
+    real_type                                tolerance_;
+    std::shared_ptr<States>                  states_;
+    std::shared_ptr<ExplicitActionInterface> pre_action_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the kinetic energy of each track before it moves.
+ */
+class EnergyMonitorAction::PreStepAction final
+    : public ExplicitActionInterface,
+      public ConcreteAction
+{
+  public:
+    // Construct with ID and shared states
+    PreStepAction(ActionId id, std::shared_ptr<States> states);
+
+    // Save the energy with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Save the energy with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::pre; }
+
+  private:
+    std::shared_ptr<States> states_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#if !CELER_USE_DEVICE
+inline void EnergyMonitorAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+
+inline void
+EnergyMonitorAction::PreStepAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EnergyMonitorData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated energy flow for one event [MeV].
+ *
+ * The imbalance is the kinetic energy unaccounted for by summing, over every
+ * step, the pre-step energy minus the post-step energy, local deposition,
+ * secondary energy, and rest mass created. It should be zero to within
+ * round-off.
+ */
+struct EnergyTally
+{
+    real_type primary{0};   //!< Kinetic energy of primaries
+    real_type deposited{0}; //!< Local energy deposition
+    real_type escaped{0};   //!< Energy of killed tracks (e.g. leaving world)
+    real_type secondary{0}; //!< Kinetic energy of produced secondaries
+    real_type imbalance{0}; //!< Energy not conserved
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Constant data for checking energy conservation.
+ */
+struct EnergyMonitorScalars
+{
+    ParticleId positron;     //!< Positron ID, if present
+    real_type  pair_mass{0}; //!< Rest mass energy of an e+e- pair [MeV]
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const { return pair_mass >= 0; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy accumulated per track slot and per event.
+ *
+ * Sums are privatized per track slot and flushed to the event tally only when
+ * the slot starts transporting a track from another event, so that the
+ * per-step cost has no atomic operations.
+ */
+template<Ownership W, MemSpace M>
+struct EnergyMonitorStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using StateItems = celeritas::StateCollection<T, W, M>;
+    template<class T>
+    using EventItems = celeritas::Collection<T, W, M, EventId>;
+
+    //// DATA ////
+
+    EnergyMonitorScalars scalars;
+
+    StateItems<real_type>   pre_step_energy;
+    StateItems<EventId>     slot_event;
+    StateItems<EnergyTally> slot_tally;
+    EventItems<EnergyTally> event_tally;
+
+    //// METHODS ////
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return scalars && !pre_step_energy.empty()
+               && slot_event.size() == pre_step_energy.size()
+               && slot_tally.size() == pre_step_energy.size()
+               && !event_tally.empty();
+    }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return pre_step_energy.size(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    EnergyMonitorStateData& operator=(EnergyMonitorStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        scalars         = other.scalars;
+        pre_step_energy = other.pre_step_energy;
+        slot_event      = other.slot_event;
+        slot_tally      = other.slot_tally;
+        event_tally     = other.event_tally;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize energy monitor states and clear the tallies.
+ */
+template<MemSpace M>
+void resize(EnergyMonitorStateData<Ownership::value, M>* data,
+            const EnergyMonitorScalars&                  scalars,
+            size_type                                    num_track_slots,
+            size_type                                    num_events)
+{
+    CELER_EXPECT(scalars);
+    CELER_EXPECT(num_track_slots > 0);
+    CELER_EXPECT(num_events > 0);
+
+    EnergyMonitorStateData<Ownership::value, MemSpace::host> host_data;
+    host_data.scalars = scalars;
+    {
+        std::vector<real_type> energy(num_track_slots, 0);
+        make_builder(&host_data.pre_step_energy)
+            .insert_back(energy.begin(), energy.end());
+    }
+    {
+        std::vector<EventId> events(num_track_slots);
+        make_builder(&host_data.slot_event)
+            .insert_back(events.begin(), events.end());
+    }
+    {
+        std::vector<EnergyTally> tallies(num_track_slots);
+        make_builder(&host_data.slot_tally)
+            .insert_back(tallies.begin(), tallies.end());
+        tallies.resize(num_events);
+        make_builder(&host_data.event_tally)
+            .insert_back(tallies.begin(), tallies.end());
+    }
+    *data = host_data;
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EventTallyAction.cc
+//---------------------------------------------------------------------------//
+#include "EventTallyAction.hh"
+
+#include "corecel/cont/Range.hh"
+
+#include "CoreTrackView.hh"
+#include "detail/EventTallyImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID and the memory space of the stepper.
+ */
+EventTallyAction::EventTallyAction(ActionId id, MemSpace memspace)
+    : ConcreteAction(id, "event-tally", "accumulate results by event")
+    , memspace_(memspace)
+{
+    CELER_EXPECT(memspace_ == MemSpace::host
+                 || memspace_ == MemSpace::device);
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+EventTallyAction::~EventTallyAction() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate and clear the tallies for a new set of events.
+ */
+void EventTallyAction::reset(size_type num_events)
+{
+    CELER_VALIDATE(num_events > 0,
+                   << "invalid number of events for tallies (" << num_events
+                   << ")");
+    if (memspace_ == MemSpace::host)
+    {
+        resize(&states_.host, num_events);
+        states_.host_ref = states_.host;
+    }
+    else
+    {
+        resize(&states_.device, num_events);
+        states_.device_ref = states_.device;
+    }
+    completed_.assign(num_events, false);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the step with host data.
+ */
+void EventTallyAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    const auto& state = states_.host_ref;
+    CELER_VALIDATE(state,
+                   << "event tallies were not allocated for host data");
+
+#pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        CoreTrackView track(data.params, data.states, ThreadId{i});
+        detail::event_tally_track(state, track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the tallies accumulated so far for each event.
+ */
+auto EventTallyAction::tallies() const -> VecTally
+{
+    HostVal<EventTallyStateData> host_copy;
+    if (states_.host)
+    {
+        host_copy.tally = states_.host.tally;
+    }
+    else
+    {
+        CELER_VALIDATE(states_.device,
+                       << "event tallies have not been allocated");
+        host_copy.tally = states_.device.tally;
+    }
+
+    auto tallies = host_copy.tally[AllItems<EventTally>{}];
+    return {tallies.begin(), tallies.end()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get newly completed events given the number of tracks created in each.
+ *
+ * The number of created tracks per event is the stepper's track counter
+ * state. Each completed event is returned only once.
+ */
+auto EventTallyAction::pop_completed(const VecCount& num_created)
+    -> VecEventResult
+{
+    CELER_EXPECT(num_created.size() <= completed_.size());
+
+    VecEventResult result;
+    VecTally       tallies = this->tallies();
+    for (auto i : range(num_created.size()))
+    {
+        if (completed_[i] || num_created[i] == 0)
+            continue;
+
+        CELER_ASSERT(tallies[i].num_tracks <= num_created[i]);
+        if (tallies[i].num_tracks == num_created[i])
+        {
+            completed_[i] = true;
+            result.push_back({EventId{i}, tallies[i]});
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
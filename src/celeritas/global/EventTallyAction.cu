@@ -0,0 +1,54 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EventTallyAction.cu
+//---------------------------------------------------------------------------//
+#include "EventTallyAction.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "CoreTrackView.hh"
+#include "detail/EventTallyImpl.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+__global__ void event_tally_kernel(CoreDeviceRef const                data,
+                                   DeviceRef<EventTallyStateData> const state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    CoreTrackView track(data.params, data.states, tid);
+    detail::event_tally_track(state, track);
+}
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the step with device data.
+ */
+void EventTallyAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_VALIDATE(states_.device_ref,
+                   << "event tallies were not allocated for device data");
+    CELER_LAUNCH_KERNEL(event_tally,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        states_.device_ref);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,110 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EventTallyAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "EventTallyData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate results for each event and detect when events finish.
+ *
+ * After every step, each active track adds its energy deposition and step to
+ * its event, and tracks that were killed are counted. An event is complete
+ * once the number of killed tracks equals the number of tracks created for it
+ * (the track counters of the stepper's initializer state): at that point no
+ * track or initializer of the event remains, and its results can be handed
+ * off while other events are still being transported.
+ *
+ * The tallies must be allocated with \c reset before the first step, since the
+ * number of events is only known once the primaries are available.
+ */
+class EventTallyAction final : public ExplicitActionInterface,
+                               public ConcreteAction
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecTally       = std::vector<EventTally>;
+    using VecCount       = std::vector<size_type>;
+    using EventResult    = std::pair<EventId, EventTally>;
+    using VecEventResult = std::vector<EventResult>;
+    //!@}
+
+  public:
+    // Construct with ID and the memory space of the stepper
+    EventTallyAction(ActionId id, MemSpace memspace);
+
+    // Default destructor
+    ~EventTallyAction();
+
+    // Allocate and clear the tallies for a new set of events
+    void reset(size_type num_events);
+
+    // Tally the step with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Tally the step with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    //// ACCESSORS ////
+
+    // Copy the tallies accumulated so far for each event
+    VecTally tallies() const;
+
+    // Get newly completed events given the number of tracks created in each
+    VecEventResult pop_completed(const VecCount& num_created);
+
+  private:
+    //// TYPES ////
+
+    struct States
+    {
+        template<MemSpace M>
+        using Value = EventTallyStateData<Ownership::value, M>;
+
+        Value<MemSpace::host>          host;
+        Value<MemSpace::device>        device;
+        HostRef<EventTallyStateData>   host_ref;
+        DeviceRef<EventTallyStateData> device_ref;
+    };
+
+    //// DATA ////
+
+    MemSpace          memspace_;
+    States            states_;
+    std::vector<bool> completed_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#if !CELER_USE_DEVICE
+inline void EventTallyAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EventTallyData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Results accumulated for a single event.
+ *
+ * The number of completed tracks is compared against the number of tracks
+ * created for the event to determine when it has finished transporting.
+ */
+struct EventTally
+{
+    real_type energy_deposition{0}; //!< Local energy deposition [MeV]
+    size_type num_steps{0};         //!< Steps taken by all tracks
+    size_type num_tracks{0};        //!< Tracks that were killed
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Results accumulated per event.
+ */
+template<Ownership W, MemSpace M>
+struct EventTallyStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using EventItems = celeritas::Collection<T, W, M, EventId>;
+
+    //// DATA ////
+
+    EventItems<EventTally> tally;
+
+    //// METHODS ////
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const { return !tally.empty(); }
+
+    //! Number of events
+    CELER_FUNCTION size_type size() const { return tally.size(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    EventTallyStateData& operator=(EventTallyStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        tally = other.tally;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize event tallies and clear them.
+ */
+template<MemSpace M>
+void resize(EventTallyStateData<Ownership::value, M>* data,
+            size_type                                 num_events)
+{
+    CELER_EXPECT(num_events > 0);
+
+    EventTallyStateData<Ownership::value, MemSpace::host> host_data;
+    std::vector<EventTally> tallies(num_events);
+    make_builder(&host_data.tally).insert_back(tallies.begin(), tallies.end());
+    *data = host_data;
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,19 +7,57 @@
 //---------------------------------------------------------------------------//
 #include "Stepper.hh"
 
+#include <algorithm>
+
 #include "corecel/Assert.hh"
+#include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/random/RngParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
 #include "celeritas/track/TrackInitUtils.hh"
+#include "celeritas/track/generated/MoveTracks.hh"
 
 #include "ActionRegistry.hh"
 #include "CoreParams.hh"
+#include "TrackSlotPolicy.hh"
 #include "detail/ActionSequence.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Get the per-track RNG states
+template<MemSpace M>
+decltype(auto) rng_items(const RngStateData<Ownership::reference, M>& rng)
+{
+#if CELERITAS_RNG == CELERITAS_RNG_XORWOW
+    return (rng.state);
+#else
+    return (rng.rng);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Copy the leading elements of one state collection to another
+template<class T, MemSpace M>
+void copy_leading(const StateCollection<T, Ownership::reference, M>& src,
+                  const StateCollection<T, Ownership::reference, M>& dst,
+                  size_type                                          count)
+{
+    CELER_EXPECT(count <= src.size() && count <= dst.size());
+    Copier<T, M> copy{src[AllItems<T, M>{}].first(count)};
+    copy(M, dst[AllItems<T, M>{}].first(count));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 /*!
  * Construct with problem parameters and setup options.
@@ -28,6 +66,9 @@ template<MemSpace M>
 Stepper<M>::Stepper(Input input)
     : params_(std::move(input.params))
     , num_initializers_(input.num_initializers)
+    , init_policy_(input.init_policy)
+    , count_secondaries_(input.count_secondaries)
+    , slot_policy_(std::move(input.slot_policy))
 {
     CELER_EXPECT(params_);
     CELER_VALIDATE(input.num_track_slots > 0,
@@ -40,7 +81,8 @@ Stepper<M>::Stepper(Input input)
     // Create action sequence
     {
         ActionSequence::Options opts;
-        opts.sync = input.sync;
+        opts.sync       = input.sync;
+        opts.concurrent = input.concurrent_actions;
         actions_
             = std::make_shared<ActionSequence>(*params_->action_reg(), opts);
     }
@@ -79,6 +121,15 @@ auto Stepper<M>::operator()() -> result_type
 
     actions_->execute(core_ref_);
 
+    if (count_secondaries_)
+    {
+        // Get the number of secondaries allocated by the interactions
+        Copier<size_type, M> copy_secondary_count{
+            core_ref_.states.physics.secondaries
+                .size[AllItems<size_type, M>{}]};
+        copy_secondary_count(MemSpace::host, {&result.secondaries, 1});
+    }
+
     // Create track initializers from surviving secondaries
     extend_from_secondaries(core_ref_, &inits_);
 
@@ -86,6 +137,20 @@ auto Stepper<M>::operator()() -> result_type
     result.alive  = states_.size() - inits_.vacancies.size();
     result.queued = inits_.initializers.size();
 
+    if (slot_policy_)
+    {
+        // Change the number of track slots for the next step, keeping room
+        // for all the alive tracks
+        size_type num_slots = std::max(
+            (*slot_policy_)(states_.size(), result), result.alive);
+        if (num_slots != states_.size())
+        {
+            bool resized = this->resize_states(num_slots);
+            CELER_ASSERT(resized);
+        }
+    }
+    result.slots = states_.size();
+
     return result;
 }
 
@@ -112,6 +177,7 @@ auto Stepper<M>::operator()(VecPrimary primaries) -> result_type
     TrackInitParams::Input inp;
     inp.primaries = std::move(primaries);
     inp.capacity  = num_initializers_;
+    inp.policy    = init_policy_;
     TrackInitParams init_params{std::move(inp)};
 
     // Create track initializers
@@ -127,6 +193,101 @@ auto Stepper<M>::operator()(VecPrimary primaries) -> result_type
     return (*this)();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the number of tracks created so far for each event.
+ *
+ * This includes primaries and all secondaries that were turned into track
+ * initializers.
+ */
+template<MemSpace M>
+auto Stepper<M>::track_counters() const -> VecCount
+{
+    CELER_EXPECT(inits_);
+
+    Collection<TrackId::size_type, Ownership::value, MemSpace::host, EventId>
+        host_counters;
+    host_counters = inits_.track_counters;
+    auto counters = host_counters[AllItems<TrackId::size_type>{}];
+    return {counters.begin(), counters.end()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reallocate the track states with a new number of slots.
+ *
+ * This must be called at the end of a step, after the vacancies have been
+ * located. The alive tracks are moved to the leading slots of the new states,
+ * so the states are only resized if all of them fit.
+ *
+ * Actions that store per-slot state (\c TrackSlotActionInterface) are
+ * resized to match.
+ *
+ * Random number states belong to the track slots rather than the tracks.
+ * They are saved in a reserve that grows with the largest number of slots, so
+ * that a slot that is removed and later reallocated continues its original
+ * stream rather than restarting it.
+ */
+template<MemSpace M>
+bool Stepper<M>::resize_states(size_type num_slots)
+{
+    CELER_EXPECT(num_slots > 0);
+
+    const size_type num_alive = states_.size() - inits_.vacancies.size();
+    if (num_alive > num_slots)
+    {
+        return false;
+    }
+
+    // Grow the RNG reserve, keeping the existing streams
+    const size_type reserve_size = std::max(num_slots, states_.size());
+    if (!rng_reserve_ || rng_reserve_.size() < reserve_size)
+    {
+        CollectionStateStore<RngStateData, M> reserve(
+            params_->rng()->host_ref(), reserve_size);
+        if (rng_reserve_)
+        {
+            copy_leading(rng_items(rng_reserve_.ref()),
+                         rng_items(reserve.ref()),
+                         rng_reserve_.size());
+        }
+        rng_reserve_ = std::move(reserve);
+    }
+
+    // Save the RNG states of the current slots
+    copy_leading(rng_items(states_.ref().rng),
+                 rng_items(rng_reserve_.ref()),
+                 states_.size());
+
+    // Move the alive tracks into new states
+    CollectionStateStore<CoreStateData, M> states(params_->host_ref(),
+                                                  num_slots);
+    if (num_alive > 0)
+    {
+        generated::move_tracks(core_ref_, states.ref(), make_ref(inits_));
+    }
+    states_ = std::move(states);
+    core_ref_.states = states_.ref();
+
+    // Restore the RNG states and mark the remaining slots as empty
+    copy_leading(rng_items(rng_reserve_.ref()),
+                 rng_items(states_.ref().rng),
+                 num_slots);
+    resize_track_slots(&inits_, num_slots, num_alive);
+
+    // Resize the per-slot state of actions
+    for (const auto& action : actions_->actions())
+    {
+        if (auto* slot_action
+            = dynamic_cast<const TrackSlotActionInterface*>(action.get()))
+        {
+            slot_action->resize_track_slots(num_slots);
+        }
+    }
+
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
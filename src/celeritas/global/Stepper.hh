@@ -23,6 +23,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 class CoreParams;
 struct Primary;
+class TrackSlotPolicyInterface;
 
 namespace detail
 {
@@ -36,6 +37,10 @@ class ActionSequence;
  * - \c params : Problem definition
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  * - \c num_initializers : Maximum number of secondaries + primaries allowable
+ * - \c init_policy : Order in which initializers fill empty track slots
+ * - \c slot_policy : Optionally resize the state vector between steps
+ * - \c count_secondaries : Copy the secondary stack usage to the host after
+ *   every step
  */
 struct StepperInput
 {
@@ -43,6 +48,10 @@ struct StepperInput
     size_type                         num_track_slots{};
     size_type                         num_initializers{};
     bool                              sync{false};
+    bool                              concurrent_actions{false};
+    TrackInitPolicy                   init_policy{TrackInitPolicy::lifo};
+    std::shared_ptr<const TrackSlotPolicyInterface> slot_policy;
+    bool                              count_secondaries{false};
 
     //! True if defined
     explicit operator bool() const
@@ -57,9 +66,11 @@ struct StepperInput
  */
 struct StepperResult
 {
-    size_type queued{}; //!< Pending track initializers at end of step
-    size_type active{}; //!< Active tracks at start of step
-    size_type alive{};  //!< Active and alive at end of step
+    size_type queued{};      //!< Pending track initializers at end of step
+    size_type active{};      //!< Active tracks at start of step
+    size_type alive{};       //!< Active and alive at end of step
+    size_type secondaries{}; //!< Secondary stack entries used (if counted)
+    size_type slots{};       //!< Track slots available for the next step
 
     //! True if more steps need to be run
     explicit operator bool() const { return queued > 0 || alive > 0; }
@@ -111,6 +122,12 @@ class StepperInterface
        alive_tracks = step();
    }
    \endcode
+ *
+ * If a track slot policy is given, the number of track slots can change at
+ * the end of each step. The alive tracks are moved in order to the leading
+ * slots of the new state vector, keeping their geometry state and sampled
+ * interaction lengths; other physics state is recalculated on the next step.
+ * The random number streams of the slots are preserved across reallocations.
  */
 template<MemSpace M>
 class Stepper final : public StepperInterface
@@ -120,6 +137,7 @@ class Stepper final : public StepperInterface
     //! \name Type aliases
     using Input       = StepperInput;
     using VecPrimary  = std::vector<Primary>;
+    using VecCount    = std::vector<size_type>;
     using result_type = StepperResult;
     //!@}
 
@@ -151,6 +169,12 @@ class Stepper final : public StepperInterface
     //! Get action sequence for timing diagnostics
     const ActionSequence& actions() const final { return *actions_; }
 
+    // Copy the number of tracks created so far for each event
+    VecCount track_counters() const;
+
+    //! Number of track slots
+    size_type num_track_slots() const { return states_.size(); }
+
   private:
     // Params and call sequence
     std::shared_ptr<const CoreParams> params_;
@@ -158,11 +182,21 @@ class Stepper final : public StepperInterface
 
     // State data
     size_type                               num_initializers_;
+    TrackInitPolicy                         init_policy_;
+    bool                                    count_secondaries_;
     CollectionStateStore<CoreStateData, M>  states_;
     TrackInitStateData<Ownership::value, M> inits_;
 
+    // Dynamic track slots
+    std::shared_ptr<const TrackSlotPolicyInterface> slot_policy_;
+    CollectionStateStore<RngStateData, M>           rng_reserve_;
+
     // Combined param/state for action calls
     CoreRef<M> core_ref_;
+
+    //// HELPER FUNCTIONS ////
+
+    bool resize_states(size_type num_slots);
 };
 
 //---------------------------------------------------------------------------//
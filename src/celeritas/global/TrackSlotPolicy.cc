@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TrackSlotPolicy.cc
+//---------------------------------------------------------------------------//
+#include "TrackSlotPolicy.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with options.
+ */
+ScaledTrackSlotPolicy::ScaledTrackSlotPolicy(const Input& input)
+    : input_(input)
+{
+    CELER_VALIDATE(input_,
+                   << "invalid track slot policy (min_slots="
+                   << input_.min_slots << ", max_slots=" << input_.max_slots
+                   << ", growth=" << input_.growth
+                   << ", min_occupancy=" << input_.min_occupancy << ")");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of track slots for the next step.
+ */
+size_type ScaledTrackSlotPolicy::operator()(size_type            num_slots,
+                                            const StepperResult& counts) const
+{
+    CELER_EXPECT(num_slots > 0);
+
+    const size_type outstanding = counts.alive + counts.queued;
+    size_type       result      = num_slots;
+    if (outstanding > num_slots)
+    {
+        // Grow to accommodate the queued tracks
+        result = static_cast<size_type>(std::ceil(num_slots * input_.growth));
+    }
+    else if (outstanding < num_slots * input_.min_occupancy)
+    {
+        // Shrink since most of the slots are empty
+        result = std::max(
+            static_cast<size_type>(std::ceil(num_slots / input_.growth)),
+            outstanding);
+    }
+    return std::min(std::max(result, input_.min_slots), input_.max_slots);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TrackSlotPolicy.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+
+#include "Stepper.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Choose the number of track slots to use for the next step.
+ *
+ * This is called by the stepper at the end of each step with the current
+ * number of slots and the track counts for the step. If the result differs
+ * from the current number of slots, the state vector is reallocated.
+ */
+class TrackSlotPolicyInterface
+{
+  public:
+    // Get the number of track slots for the next step
+    virtual size_type
+    operator()(size_type num_slots, const StepperResult& counts) const = 0;
+
+  protected:
+    // Protected destructor prevents deletion of pointer-to-interface
+    ~TrackSlotPolicyInterface() = default;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Grow or shrink the track slots geometrically with the outstanding tracks.
+ *
+ * The outstanding tracks are the alive tracks plus the queued initializers.
+ * If there are more of them than track slots, the number of slots is
+ * multiplied by the growth factor (up to the maximum). If they would occupy
+ * less than the given fraction of the slots, the number of slots is divided
+ * by the growth factor (down to the minimum, and never below the number of
+ * outstanding tracks). The gap between the two thresholds prevents the
+ * capacity from oscillating between steps.
+ *
+ * - \c min_slots : Smallest number of track slots
+ * - \c max_slots : Largest number of track slots
+ * - \c growth : Factor by which the capacity changes
+ * - \c min_occupancy : Fraction of occupied slots below which to shrink
+ */
+class ScaledTrackSlotPolicy final : public TrackSlotPolicyInterface
+{
+  public:
+    struct Input
+    {
+        size_type min_slots{};
+        size_type max_slots{};
+        real_type growth{2};
+        real_type min_occupancy{0.25};
+
+        //! True if the options are valid
+        explicit operator bool() const
+        {
+            return min_slots > 0 && min_slots <= max_slots && growth > 1
+                   && min_occupancy > 0 && min_occupancy * growth < 1;
+        }
+    };
+
+  public:
+    // Construct with options
+    explicit ScaledTrackSlotPolicy(const Input& input);
+
+    // Get the number of track slots for the next step
+    size_type
+    operator()(size_type num_slots, const StepperResult& counts) const final;
+
+  private:
+    Input input_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerAction.cc
+//---------------------------------------------------------------------------//
+#include "VolumeProfilerAction.hh"
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+#include "ActionRegistry.hh"
+#include "CoreTrackView.hh"
+#include "detail/VolumeProfilerImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add the pre- and post-step actions to the registry.
+ */
+std::shared_ptr<VolumeProfilerAction>
+VolumeProfilerAction::from_params(const GeoParams& geo,
+                                  const Input&     input,
+                                  ActionRegistry*  actions)
+{
+    CELER_EXPECT(actions);
+    ActionId pre_id = actions->next_id();
+    auto     result = std::make_shared<VolumeProfilerAction>(
+        pre_id, ActionId{pre_id.get() + 1}, geo, input);
+    actions->insert(result->pre_action());
+    actions->insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the pre-step and post-step action IDs.
+ */
+VolumeProfilerAction::VolumeProfilerAction(ActionId         pre_id,
+                                           ActionId         id,
+                                           const GeoParams& geo,
+                                           const Input&     input)
+    : ConcreteAction(id, "volume-profiler", "tally steps per volume")
+    , states_(std::make_shared<States>())
+{
+    CELER_EXPECT(pre_id && pre_id != id);
+    CELER_VALIDATE(input,
+                   << "invalid volume profiler input (num_copies="
+                   << input.num_copies << ")");
+
+    if (input.memspace == MemSpace::host)
+    {
+        resize(&states_->host, geo.num_volumes(), input.num_copies);
+        states_->host_ref = states_->host;
+    }
+    else
+    {
+        resize(&states_->device, geo.num_volumes(), input.num_copies);
+        states_->device_ref = states_->device;
+    }
+
+    pre_action_ = std::make_shared<PreStepAction>(pre_id, states_);
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+VolumeProfilerAction::~VolumeProfilerAction() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the step with host data.
+ */
+void VolumeProfilerAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    const auto& state = states_->host_ref;
+    CELER_VALIDATE(state, << "volume profiler was not built for host data");
+
+#pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        CoreTrackView track(data.params, data.states, ThreadId{i});
+        detail::volume_profiler_post_track(state, track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the tallies accumulated so far for each volume.
+ *
+ * The privatized copies are summed into a single tally per volume.
+ */
+auto VolumeProfilerAction::tallies() const -> VecTally
+{
+    HostVal<VolumeProfilerStateData> host_copy;
+    if (states_->host)
+    {
+        host_copy = states_->host;
+    }
+    else
+    {
+        CELER_ASSERT(states_->device);
+        host_copy = states_->device;
+    }
+
+    VecTally result(host_copy.num_volumes);
+    for (auto i : range(host_copy.tally.size()))
+    {
+        const VolumeTally& src  = host_copy.tally[ItemId<VolumeTally>{i}];
+        VolumeTally&       dest = result[i % host_copy.num_volumes];
+        dest.steps += src.steps;
+        dest.crossings += src.crossings;
+        dest.zero_safety += src.zero_safety;
+        dest.length += src.length;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRE-STEP ACTION
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID and shared states.
+ */
+VolumeProfilerAction::PreStepAction::PreStepAction(
+    ActionId id, std::shared_ptr<States> states)
+    : ConcreteAction(id, "volume-profiler-pre", "count steps per volume")
+    , states_(std::move(states))
+{
+    CELER_EXPECT(states_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the steps with host data.
+ */
+void VolumeProfilerAction::PreStepAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    const auto& state = states_->host_ref;
+    CELER_VALIDATE(state, << "volume profiler was not built for host data");
+
+#pragma omp parallel for
+    for (size_type i = 0; i < data.states.size(); ++i)
+    {
+        CoreTrackView track(data.params, data.states, ThreadId{i});
+        detail::volume_profiler_pre_track(state, track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,84 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerAction.cu
+//---------------------------------------------------------------------------//
+#include "VolumeProfilerAction.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "CoreTrackView.hh"
+#include "detail/VolumeProfilerImpl.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+__global__ void
+volume_profiler_pre_kernel(CoreDeviceRef const                    data,
+                           DeviceRef<VolumeProfilerStateData> const state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    CoreTrackView track(data.params, data.states, tid);
+    detail::volume_profiler_pre_track(state, track);
+}
+
+//---------------------------------------------------------------------------//
+__global__ void
+volume_profiler_post_kernel(CoreDeviceRef const                    data,
+                            DeviceRef<VolumeProfilerStateData> const state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    CoreTrackView track(data.params, data.states, tid);
+    detail::volume_profiler_post_track(state, track);
+}
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the step with device data.
+ */
+void VolumeProfilerAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_VALIDATE(states_->device_ref,
+                   << "volume profiler was not built for device data");
+    CELER_LAUNCH_KERNEL(volume_profiler_post,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        states_->device_ref);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the steps with device data.
+ */
+void VolumeProfilerAction::PreStepAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    CELER_VALIDATE(states_->device_ref,
+                   << "volume profiler was not built for device data");
+    CELER_LAUNCH_KERNEL(volume_profiler_pre,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        states_->device_ref);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/geo/GeoParamsFwd.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "VolumeProfilerData.hh"
+
+namespace celeritas
+{
+class ActionRegistry;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the number of steps, crossings, and track length in each volume.
+ *
+ * This optional diagnostic helps identify the geometry regions that dominate
+ * the transport cost: thin layers that cause many boundary crossings, or
+ * volumes where most steps start on a boundary and therefore have zero
+ * safety. The steps are counted by a companion \c pre action, and the step
+ * length and crossings are tallied after the along-step action but before the
+ * track moves into the next volume.
+ *
+ * The tallies are accumulated with atomics in the memory space of the stepper
+ * that executes it, privatized over a number of copies to reduce contention.
+ */
+class VolumeProfilerAction final : public ExplicitActionInterface,
+                                   public ConcreteAction
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecTally = std::vector<VolumeTally>;
+    //!@}
+
+    struct Input
+    {
+        size_type num_copies{32}; //!< Privatized copies of the tallies
+        MemSpace  memspace{MemSpace::host};
+
+        //! Whether the input is valid
+        explicit operator bool() const
+        {
+            return num_copies > 0
+                   && (memspace == MemSpace::host
+                       || memspace == MemSpace::device);
+        }
+    };
+
+  public:
+    // Construct and add the pre- and post-step actions to the registry
+    static std::shared_ptr<VolumeProfilerAction>
+    from_params(const GeoParams& geo,
+                const Input&     input,
+                ActionRegistry*  actions);
+
+    // Construct with the pre-step and post-step action IDs
+    VolumeProfilerAction(ActionId         pre_id,
+                         ActionId         id,
+                         const GeoParams& geo,
+                         const Input&     input);
+
+    // Default destructor
+    ~VolumeProfilerAction();
+
+    // Tally the step with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Tally the step with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::pre_post; }
+
+    //// ACCESSORS ////
+
+    //! Action that counts the steps
+    const std::shared_ptr<ExplicitActionInterface>& pre_action() const
+    {
+        return pre_action_;
+    }
+
+    // Copy the tallies accumulated so far for each volume
+    VecTally tallies() const;
+
+  private:
+    //// TYPES ////
+
+    class PreStepAction;
+
+    struct States
+    {
+        template<MemSpace M>
+        using Value = VolumeProfilerStateData<Ownership::value, M>;
+
+        Value<MemSpace::host>              host;
+        Value<MemSpace::device>            device;
+        HostRef<VolumeProfilerStateData>   host_ref;
+        DeviceRef<VolumeProfilerStateData> device_ref;
+    };
+
+    //// DATA ////
+
+    std::shared_ptr<States>                  states_;
+    std::shared_ptr<ExplicitActionInterface> pre_action_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the steps starting in each volume.
+ */
+class VolumeProfilerAction::PreStepAction final
+    : public ExplicitActionInterface,
+      public ConcreteAction
+{
+  public:
+    // Construct with ID and shared states
+    PreStepAction(ActionId id, std::shared_ptr<States> states);
+
+    // Count the steps with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Count the steps with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::pre; }
+
+  private:
+    std::shared_ptr<States> states_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#if !CELER_USE_DEVICE
+inline void VolumeProfilerAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+
+inline void
+VolumeProfilerAction::PreStepAction::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport cost accumulated in a single volume.
+ *
+ * A zero-safety step is one that begins on a boundary, where the safety
+ * distance is zero and the step limiters (e.g. multiple scattering) must
+ * fall back to their most conservative behavior.
+ */
+struct VolumeTally
+{
+    ull_int   steps{0};       //!< Steps taken
+    ull_int   crossings{0};   //!< Steps ending on an outgoing boundary
+    ull_int   zero_safety{0}; //!< Steps starting on a boundary
+    real_type length{0};      //!< Total track length [cm]
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-volume tallies privatized over several copies.
+ *
+ * Each track slot accumulates into the copy given by its thread ID modulo the
+ * number of copies, which reduces the contention on the atomic updates when
+ * many tracks are in the same volume.
+ */
+template<Ownership W, MemSpace M>
+struct VolumeProfilerStateData
+{
+    //// TYPES ////
+
+    using TallyItems = celeritas::Collection<VolumeTally, W, M>;
+
+    //// DATA ////
+
+    size_type  num_volumes{0};
+    TallyItems tally; //!< [copy][volume]
+
+    //// METHODS ////
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_volumes > 0 && !tally.empty()
+               && tally.size() % num_volumes == 0;
+    }
+
+    //! Number of privatized copies of the tallies
+    CELER_FUNCTION size_type num_copies() const
+    {
+        return tally.size() / num_volumes;
+    }
+
+    //! Tally for a volume in the copy used by the given track slot
+    CELER_FUNCTION ItemId<VolumeTally> tally_id(ThreadId tid,
+                                                VolumeId vol) const
+    {
+        CELER_EXPECT(vol < num_volumes);
+        return ItemId<VolumeTally>{(tid.get() % this->num_copies())
+                                       * num_volumes
+                                   + vol.get()};
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VolumeProfilerStateData& operator=(VolumeProfilerStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        num_volumes = other.num_volumes;
+        tally       = other.tally;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize volume profiler states and clear the tallies.
+ */
+template<MemSpace M>
+void resize(VolumeProfilerStateData<Ownership::value, M>* data,
+            size_type                                     num_volumes,
+            size_type                                     num_copies)
+{
+    CELER_EXPECT(num_volumes > 0);
+    CELER_EXPECT(num_copies > 0);
+
+    VolumeProfilerStateData<Ownership::value, MemSpace::host> host_data;
+    host_data.num_volumes = num_volumes;
+    std::vector<VolumeTally> tallies(num_volumes * num_copies);
+    make_builder(&host_data.tally).insert_back(tallies.begin(), tallies.end());
+    *data = host_data;
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
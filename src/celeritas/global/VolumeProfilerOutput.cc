@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerOutput.cc
+//---------------------------------------------------------------------------//
+#include "VolumeProfilerOutput.hh"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+#include "VolumeProfilerAction.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+
+#    include "corecel/cont/Label.json.hh"
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the profiler and geometry.
+ */
+VolumeProfilerOutput::VolumeProfilerOutput(SPConstProfiler profiler,
+                                           SPConstGeo      geo,
+                                           size_type       num_hotspots)
+    : profiler_(std::move(profiler))
+    , geo_(std::move(geo))
+    , num_hotspots_(num_hotspots)
+{
+    CELER_EXPECT(profiler_);
+    CELER_EXPECT(geo_);
+    CELER_EXPECT(num_hotspots_ > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void VolumeProfilerOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    auto tallies = profiler_->tallies();
+    CELER_ASSERT(tallies.size() == geo_->num_volumes());
+
+    // Sort volumes by decreasing number of steps
+    std::vector<VolumeId> volumes(range(VolumeId{tallies.size()}).begin(),
+                                  range(VolumeId{tallies.size()}).end());
+    std::stable_sort(
+        volumes.begin(), volumes.end(), [&tallies](VolumeId a, VolumeId b) {
+            return tallies[a.get()].steps > tallies[b.get()].steps;
+        });
+
+    VolumeTally total;
+    for (const VolumeTally& t : tallies)
+    {
+        total.steps += t.steps;
+        total.crossings += t.crossings;
+        total.zero_safety += t.zero_safety;
+        total.length += t.length;
+    }
+
+    auto hotspots = nlohmann::json::array();
+    for (VolumeId vol : volumes)
+    {
+        const VolumeTally& t = tallies[vol.get()];
+        if (hotspots.size() == num_hotspots_ || t.steps == 0)
+            break;
+
+        hotspots.push_back({
+            {"volume", vol.get()},
+            {"label", geo_->id_to_label(vol)},
+            {"steps", t.steps},
+            {"crossings", t.crossings},
+            {"zero_safety", t.zero_safety},
+            {"length", t.length},
+        });
+    }
+
+    j->obj = {
+        {"total",
+         {{"steps", total.steps},
+          {"crossings", total.crossings},
+          {"zero_safety", total.zero_safety},
+          {"length", total.length}}},
+        {"hotspots", std::move(hotspots)},
+    };
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfilerOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/Types.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/geo/GeoParamsFwd.hh"
+
+namespace celeritas
+{
+class VolumeProfilerAction;
+//---------------------------------------------------------------------------//
+/*!
+ * Save the volumes with the most steps tallied by the volume profiler.
+ *
+ * The volumes are sorted by decreasing number of steps, and only the first
+ * \c num_hotspots are written.
+ */
+class VolumeProfilerOutput final : public OutputInterface
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SPConstProfiler = std::shared_ptr<const VolumeProfilerAction>;
+    using SPConstGeo      = std::shared_ptr<const GeoParams>;
+    //!@}
+
+  public:
+    // Construct from the profiler and geometry
+    VolumeProfilerOutput(SPConstProfiler profiler,
+                         SPConstGeo      geo,
+                         size_type       num_hotspots);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return "volume-hotspots"; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    SPConstProfiler profiler_;
+    SPConstGeo      geo_;
+    size_type       num_hotspots_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
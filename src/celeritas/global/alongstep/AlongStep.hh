@@ -14,6 +14,8 @@
 #include "corecel/Types.hh"
 #include "orange/Types.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/field/LinearPropagator.hh"
+#include "celeritas/global/CoreTrackView.hh"
 
 namespace celeritas
 {
@@ -27,6 +29,62 @@ struct AlongStepLocalState
     real_type geo_step{};
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Continue a neutral track through boundaries into the same material.
+ *
+ * The track has stopped on a boundary after moving \c p.distance of the
+ * geometry step \c max_step. Each boundary is crossed in place, and the track
+ * keeps moving in a straight line while the new volume has the same material,
+ * since the cross sections and remaining interaction length are unchanged. A
+ * boundary at the end of the geometry step is crossed without continuing.
+ *
+ * The result's boundary flag is set if the track enters a volume with a
+ * different material: the material state is updated (or the track is killed
+ * if it left the world) and the step ends there.
+ */
+inline CELER_FUNCTION Propagation cross_same_material(CoreTrackView const& track,
+                                                      GeoTrackView*        geo,
+                                                      real_type   max_step,
+                                                      Propagation p)
+{
+    CELER_EXPECT(p.boundary && p.distance <= max_step);
+
+    auto             geo_mat = track.make_geo_material_view();
+    const MaterialId matid   = track.make_material_view().material_id();
+
+    LinearPropagator propagate(geo);
+    while (p.boundary)
+    {
+        geo->cross_boundary();
+        if (geo->is_outside())
+        {
+            track.make_sim_view().status(TrackStatus::killed);
+            break;
+        }
+        MaterialId next_matid = geo_mat.material_id(geo->volume_id());
+        CELER_ASSERT(next_matid);
+        if (next_matid != matid)
+        {
+            auto mat = track.make_material_view();
+            mat      = {next_matid};
+            break;
+        }
+        if (!(p.distance < max_step))
+        {
+            // Boundary coincides with the end of the step
+            p.boundary = false;
+            break;
+        }
+
+        Propagation next = propagate(max_step - p.distance);
+        p.distance += next.distance;
+        p.boundary = next.boundary;
+    }
+    CELER_ENSURE(p.distance <= max_step);
+    return p;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Perform the along-step action using helper functions.
@@ -76,7 +134,21 @@ inline CELER_FUNCTION void along_step(MH&&                 msc,
         auto geo       = track.make_geo_view();
         auto propagate = make_propagator(track.make_particle_view(), &geo);
         Propagation p  = propagate(local.geo_step);
-        if (p.boundary)
+        if (p.boundary && track.crossed_boundary_action()
+            && track.make_particle_view().charge() == zero_quantity())
+        {
+            // Neutral particles don't stop at boundaries between volumes of
+            // the same material
+            CELER_ASSERT(!use_msc);
+            p = cross_same_material(track, &geo, local.geo_step, p);
+            if (p.boundary)
+            {
+                // Stopped after entering a new material
+                local.geo_step          = p.distance;
+                local.step_limit.action = track.crossed_boundary_action();
+            }
+        }
+        else if (p.boundary)
         {
             // Stopped at a geometry boundary: this is the new step action.
             CELER_ASSERT(p.distance <= local.geo_step);
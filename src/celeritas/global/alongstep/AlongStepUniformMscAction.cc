@@ -12,6 +12,7 @@
 #include "corecel/data/Ref.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/em/model/UrbanMscModel.hh"
+#include "celeritas/field/FieldRegionParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/alongstep/detail/AlongStepLauncherImpl.hh"
@@ -29,7 +30,8 @@ namespace celeritas
 std::shared_ptr<AlongStepUniformMscAction>
 AlongStepUniformMscAction::from_params(const PhysicsParams&      physics,
                                        const UniformFieldParams& field_params,
-                                       ActionRegistry*           actions)
+                                       ActionRegistry*           actions,
+                                       SPConstFieldRegion        field_region)
 {
     CELER_EXPECT(actions);
     // Super hacky!! This will be cleaned up later.
@@ -46,22 +48,30 @@ AlongStepUniformMscAction::from_params(const PhysicsParams&      physics,
     }
 
     auto result = std::make_shared<AlongStepUniformMscAction>(
-        actions->next_id(), field_params, std::move(msc));
+        actions->next_id(),
+        field_params,
+        std::move(msc),
+        std::move(field_region));
     actions->insert(result);
     return result;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct with next action ID and optional energy loss parameters.
+ * Construct with next action ID, optional MSC, and optional field-free
+ * volumes.
  */
 AlongStepUniformMscAction::AlongStepUniformMscAction(
-    ActionId id, const UniformFieldParams& field_params, SPConstMsc msc)
+    ActionId                  id,
+    const UniformFieldParams& field_params,
+    SPConstMsc                msc,
+    SPConstFieldRegion        field_region)
     : id_(id)
     , msc_(std::move(msc))
+    , field_region_(std::move(field_region))
     , field_params_(field_params)
-    , host_data_(msc_)
-    , device_data_(msc_)
+    , host_data_(msc_, field_region_)
+    , device_data_(msc_, field_region_)
 {
     CELER_EXPECT(id_);
 }
@@ -78,11 +88,12 @@ void AlongStepUniformMscAction::execute(CoreHostRef const& data) const
 {
     CELER_EXPECT(data);
 
-    auto launch = make_along_step_launcher(data,
-                                           host_data_.msc,
-                                           field_params_,
-                                           NoData{},
-                                           detail::along_step_uniform_msc);
+    auto launch = make_along_step_launcher(
+        data,
+        host_data_.msc,
+        detail::UniformFieldRegion{field_params_, host_data_.field_region},
+        NoData{},
+        detail::along_step_uniform_msc);
 
 #pragma omp parallel for
     for (size_type i = 0; i < data.states.size(); ++i)
@@ -97,7 +108,7 @@ void AlongStepUniformMscAction::execute(CoreHostRef const& data) const
  */
 template<MemSpace M>
 AlongStepUniformMscAction::ExternalRefs<M>::ExternalRefs(
-    const SPConstMsc& msc_params)
+    const SPConstMsc& msc_params, const SPConstFieldRegion& field_region_params)
 {
     if (M == MemSpace::device && !celeritas::device())
     {
@@ -109,6 +120,10 @@ AlongStepUniformMscAction::ExternalRefs<M>::ExternalRefs(
     {
         msc = get_ref<M>(*msc_params);
     }
+    if (field_region_params)
+    {
+        field_region = get_ref<M>(*field_region_params);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -22,19 +22,22 @@ namespace
 {
 //---------------------------------------------------------------------------//
 __global__ void
-along_step_uniform_msc_kernel(CoreRef<MemSpace::device> const track_data,
-                              DeviceCRef<UrbanMscData> const  msc_data,
-                              UniformFieldParams const        field_params)
+along_step_uniform_msc_kernel(
+    CoreRef<MemSpace::device> const         track_data,
+    DeviceCRef<UrbanMscData> const          msc_data,
+    UniformFieldParams const                field_params,
+    DeviceCRef<FieldRegionParamsData> const field_region)
 {
     auto tid = KernelParamCalculator::thread_id();
     if (!(tid < track_data.states.size()))
         return;
 
-    auto launch = make_along_step_launcher(track_data,
-                                           msc_data,
-                                           field_params,
-                                           NoData{},
-                                           detail::along_step_uniform_msc);
+    auto launch = make_along_step_launcher(
+        track_data,
+        msc_data,
+        detail::UniformFieldRegion{field_params, field_region},
+        NoData{},
+        detail::along_step_uniform_msc);
     launch(tid);
 }
 //---------------------------------------------------------------------------//
@@ -52,7 +55,8 @@ void AlongStepUniformMscAction::execute(const CoreDeviceRef& data) const
                         data.states.size(),
                         data,
                         device_data_.msc,
-                        field_params_);
+                        field_params_,
+                        device_data_.field_region);
 }
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/field/FieldRegionData.hh"
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/CoreTrackData.hh"
@@ -19,6 +20,7 @@
 namespace celeritas
 {
 class UrbanMscModel;
+class FieldRegionParams;
 
 class PhysicsParams;
 class MaterialParams;
@@ -28,25 +30,33 @@ class ActionRegistry;
 //---------------------------------------------------------------------------//
 /*!
  * Along-step kernel with optional MSC and uniform magnetic field.
+ *
+ * Charged tracks in the optional field-free volumes are propagated in a
+ * straight line. Since both propagators stop at volume boundaries, a track
+ * entering or leaving a field-free volume switches propagators at the start
+ * of its next step.
  */
 class AlongStepUniformMscAction final : public ExplicitActionInterface
 {
   public:
     //!@{
     //! \name Type aliases
-    using SPConstMsc = std::shared_ptr<const UrbanMscModel>;
+    using SPConstMsc         = std::shared_ptr<const UrbanMscModel>;
+    using SPConstFieldRegion = std::shared_ptr<const FieldRegionParams>;
     //!@}
 
   public:
     static std::shared_ptr<AlongStepUniformMscAction>
     from_params(const PhysicsParams&      physics,
                 const UniformFieldParams& field_params,
-                ActionRegistry*           actions);
+                ActionRegistry*           actions,
+                SPConstFieldRegion        field_region = nullptr);
 
     // Construct with next action ID, optional MSC, magnetic field
     AlongStepUniformMscAction(ActionId                  id,
                               const UniformFieldParams& field_params,
-                              SPConstMsc                msc);
+                              SPConstMsc                msc,
+                              SPConstFieldRegion        field_region = nullptr);
 
     // Default destructor
     ~AlongStepUniformMscAction();
@@ -80,9 +90,13 @@ class AlongStepUniformMscAction final : public ExplicitActionInterface
     //! Field strength
     const Real3& field() const { return field_params_.field; }
 
+    //! Whether some volumes are field-free
+    bool has_field_region() const { return static_cast<bool>(field_region_); }
+
   private:
     ActionId           id_;
     SPConstMsc         msc_;
+    SPConstFieldRegion field_region_;
     UniformFieldParams field_params_;
 
     // TODO: kind of hacky way to support msc being optional
@@ -90,9 +104,11 @@ class AlongStepUniformMscAction final : public ExplicitActionInterface
     template<MemSpace M>
     struct ExternalRefs
     {
-        UrbanMscData<Ownership::const_reference, M> msc;
+        UrbanMscData<Ownership::const_reference, M>          msc;
+        FieldRegionParamsData<Ownership::const_reference, M> field_region;
 
-        ExternalRefs(const SPConstMsc& msc_params);
+        ExternalRefs(const SPConstMsc&         msc_params,
+                     const SPConstFieldRegion& field_region_params);
     };
 
     ExternalRefs<MemSpace::host>   host_data_;
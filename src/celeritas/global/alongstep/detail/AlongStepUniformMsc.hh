@@ -10,10 +10,9 @@
 #include "corecel/Types.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
-#include "celeritas/field/DormandPrinceStepper.hh"
-#include "celeritas/field/FieldDriverOptions.hh"
-#include "celeritas/field/MakeMagFieldPropagator.hh"
-#include "celeritas/field/UniformField.hh"
+#include "celeritas/field/FieldRegionData.hh"
+#include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/field/UniformFieldRegionPropagator.hh"
 
 #include "AlongStepNeutral.hh"
 #include "EnergyLossApplier.hh"
@@ -23,22 +22,44 @@ namespace celeritas
 {
 namespace detail
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Uniform field parameters and the optional volumes without a field.
+ */
+struct UniformFieldRegion
+{
+    const UniformFieldParams&                params;
+    const NativeCRef<FieldRegionParamsData>& region;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Implementation of the "along step" action with Urban MSC and a uniform
  * magnetic field.
+ *
+ * The field driver's step estimate is saved in the track state so that the
+ * integration of the next step starts from the last good substep length.
+ * Tracks that start the step in a field-free volume move in a straight line
+ * and leave the step estimate unchanged.
  */
 inline CELER_FUNCTION void
 along_step_uniform_msc(const NativeCRef<UrbanMscData>& msc,
-                       const UniformFieldParams&       field,
+                       const UniformFieldRegion&       field,
                        NoData,
                        CoreTrackView const& track)
 {
     return along_step(
         UrbanMsc{msc},
-        [&field](const ParticleTrackView& particle, GeoTrackView* geo) {
-            return make_mag_field_propagator<DormandPrinceStepper>(
-                UniformField(field.field), field.options, particle, geo);
+        [&field, &track](const ParticleTrackView& particle, GeoTrackView* geo) {
+            UniformFieldRegionPropagator propagate(
+                field.params, field.region, particle, geo);
+            return [propagate, &track](real_type step) mutable {
+                auto      sim        = track.make_sim_view();
+                real_type field_step = sim.field_step();
+                Propagation result   = propagate(step, &field_step);
+                sim.field_step(field_step);
+                return result;
+            };
         },
         EnergyLossApplier{},
         track);
@@ -102,12 +102,21 @@ CELER_FUNCTION void UrbanMsc::calc_step(CoreTrackView const& track,
     auto geo      = track.make_geo_view();
     auto phys     = track.make_physics_view();
 
+    // The minimal step limitation algorithm doesn't use the safety distance
+    // (the lateral displacement in the scattering may still calculate it)
+    real_type safety = 0;
+    if (msc_params_.step_limit_algorithm(particle.particle_id())
+        != MscStepLimitAlgorithm::minimal)
+    {
+        safety = geo.find_safety();
+    }
+
     // Sample multiple scattering step length
     UrbanMscStepLimit msc_step_limit(msc_params_,
                                      particle,
                                      phys,
                                      track.make_material_view().material_id(),
-                                     geo.find_safety(),
+                                     safety,
                                      local->step_limit.step);
 
     auto rng             = track.make_rng_engine();
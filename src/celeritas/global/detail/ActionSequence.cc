@@ -11,6 +11,7 @@
 #include <tuple>
 
 #include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/sys/Stopwatch.hh"
 
@@ -41,18 +42,70 @@ ActionSequence::ActionSequence(const ActionRegistry& reg, Options options)
         }
     }
 
+    // Omit actions that are performed by a fused action, and execute the
+    // fused action in place of the first action it replaces
+    std::vector<bool>     is_fused(reg.num_actions(), false);
+    std::vector<ActionId> sort_id(reg.num_actions());
+    for (auto aidx : range(reg.num_actions()))
+    {
+        sort_id[aidx] = ActionId{aidx};
+    }
+    for (const SPConstExplicit& action : actions_)
+    {
+        if (auto* fused = dynamic_cast<const FusedActionInterface*>(
+                action.get()))
+        {
+            ActionId& fused_sort_id = sort_id[action->action_id().get()];
+            for (ActionId fused_id : fused->fused_actions())
+            {
+                CELER_ASSERT(fused_id < is_fused.size());
+                CELER_VALIDATE(!is_fused[fused_id.get()],
+                               << "action '" << reg.id_to_label(fused_id)
+                               << "' is fused into more than one action");
+                is_fused[fused_id.get()] = true;
+                fused_sort_id            = std::min(fused_sort_id, fused_id);
+            }
+        }
+    }
+    actions_.erase(std::remove_if(actions_.begin(),
+                                  actions_.end(),
+                                  [&is_fused](const SPConstExplicit& a) {
+                                      return is_fused[a->action_id().get()];
+                                  }),
+                   actions_.end());
+
     // Sort actions by increasing order (and secondarily, increasing IDs)
     std::sort(actions_.begin(),
               actions_.end(),
-              [](const SPConstExplicit& a, const SPConstExplicit& b) {
-                  return std::make_tuple(a->order(), a->action_id())
-                         < std::make_tuple(b->order(), b->action_id());
+              [&sort_id](const SPConstExplicit& a, const SPConstExplicit& b) {
+                  return std::make_tuple(a->order(),
+                                         sort_id[a->action_id().get()])
+                         < std::make_tuple(b->order(),
+                                           sort_id[b->action_id().get()]);
               });
 
+    // Group consecutive concurrent actions of the same order
+    concurrent_end_.resize(actions_.size());
+    for (size_type i = actions_.size(); i-- > 0;)
+    {
+        const auto& action = *actions_[i];
+        if (i + 1 < actions_.size() && action.concurrent()
+            && actions_[i + 1]->concurrent()
+            && action.order() == actions_[i + 1]->order())
+        {
+            concurrent_end_[i] = concurrent_end_[i + 1];
+        }
+        else
+        {
+            concurrent_end_[i] = i + 1;
+        }
+    }
+
     // Initialize timing
     accum_time_.resize(actions_.size());
 
     CELER_ENSURE(actions_.size() == accum_time_.size());
+    CELER_ENSURE(actions_.size() == concurrent_end_.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -64,7 +117,11 @@ ActionSequence::ActionSequence(const ActionRegistry& reg, Options options)
 template<MemSpace M>
 void ActionSequence::execute(const CoreRef<M>& data)
 {
-    if (M == MemSpace::host || options_.sync)
+    if (M == MemSpace::host && options_.concurrent)
+    {
+        this->execute_concurrent(data);
+    }
+    else if (M == MemSpace::host || options_.sync)
     {
         // Execute all actions and record the time elapsed
         for (auto i : range(actions_.size()))
@@ -88,6 +145,51 @@ void ActionSequence::execute(const CoreRef<M>& data)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute groups of independent actions as host tasks.
+ *
+ * The parallel loops inside each action are nested in the task's thread and
+ * (unless nested parallelism is enabled) run serially. The time for each
+ * action is measured inside its task, so the times of a group overlap.
+ */
+void ActionSequence::execute_concurrent(const CoreRef<MemSpace::host>& data)
+{
+    for (size_type begin = 0; begin < actions_.size();
+         begin           = concurrent_end_[begin])
+    {
+        const size_type end = concurrent_end_[begin];
+        if (end - begin == 1)
+        {
+            Stopwatch get_time;
+            actions_[begin]->execute(data);
+            accum_time_[begin] += get_time();
+            continue;
+        }
+
+#pragma omp parallel
+#pragma omp single
+        for (size_type i = begin; i < end; ++i)
+        {
+#pragma omp task
+            {
+                Stopwatch get_time;
+                actions_[i]->execute(data);
+                accum_time_[i] += get_time();
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Concurrent execution is only implemented on host.
+ */
+void ActionSequence::execute_concurrent(const CoreRef<MemSpace::device>&)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 // Explicit template instantiation
 //---------------------------------------------------------------------------//
@@ -27,6 +27,15 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Sequence of explicit actions to invoke as part of a single step.
+ *
+ * Actions performed by a registered \c FusedActionInterface are not invoked
+ * separately: the fused action takes the place of the first of them.
+ *
+ * With the \c concurrent option, consecutive actions of the same order that
+ * are all marked as concurrent (e.g. the interactions of different models)
+ * are run as simultaneous OpenMP tasks on host. Each task executes its
+ * action's kernel on a single thread, so this helps when many actions each
+ * apply to few tracks, as in the tail of a shower.
  */
 class ActionSequence
 {
@@ -41,7 +50,8 @@ class ActionSequence
     //! Construction/execution options
     struct Options
     {
-        bool sync{false}; //!< Call DeviceSynchronize and add timer
+        bool sync{false};       //!< Call DeviceSynchronize and add timer
+        bool concurrent{false}; //!< Run independent host actions as tasks
     };
 
   public:
@@ -71,10 +81,21 @@ class ActionSequence
     //! Get the corresponding accumulated time, if 'sync' or host called
     const VecDouble& accum_time() const { return accum_time_; }
 
+    //! Index past the last action that can run concurrently with each action
+    const std::vector<size_type>& concurrent_end() const
+    {
+        return concurrent_end_;
+    }
+
   private:
-    Options   options_;
-    VecAction actions_;
-    VecDouble accum_time_;
+    Options                options_;
+    VecAction              actions_;
+    VecDouble              accum_time_;
+    std::vector<size_type> concurrent_end_;
+
+    // Execute groups of independent actions as host tasks
+    void execute_concurrent(const CoreRef<MemSpace::host>& data);
+    void execute_concurrent(const CoreRef<MemSpace::device>& data);
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/EnergyMonitorImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../EnergyMonitorData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add the privatized tally of a track slot to its event and clear it.
+ */
+inline CELER_FUNCTION void
+flush_energy_tally(NativeRef<EnergyMonitorStateData> const& state,
+                   ThreadId                                 tid)
+{
+    EventId event = state.slot_event[tid];
+    if (!event)
+        return;
+
+    CELER_ASSERT(event < state.event_tally.size());
+    EnergyTally& src  = state.slot_tally[tid];
+    EnergyTally& dest = state.event_tally[event];
+    atomic_add(&dest.primary, src.primary);
+    atomic_add(&dest.deposited, src.deposited);
+    atomic_add(&dest.escaped, src.escaped);
+    atomic_add(&dest.secondary, src.secondary);
+    atomic_add(&dest.imbalance, src.imbalance);
+    src = {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the kinetic energy at the beginning of the step.
+ */
+inline CELER_FUNCTION void
+energy_monitor_pre_track(NativeRef<EnergyMonitorStateData> const& state,
+                         CoreTrackView const&                     track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+        return;
+
+    ThreadId tid = track.thread_id();
+    if (state.slot_event[tid] != sim.event_id())
+    {
+        // Track slot now belongs to a different event
+        flush_energy_tally(state, tid);
+        state.slot_event[tid] = sim.event_id();
+    }
+
+    real_type energy = value_as<units::MevEnergy>(
+        track.make_particle_view().energy());
+    state.pre_step_energy[tid] = energy;
+    if (sim.num_steps() == 0 && !sim.parent_id())
+    {
+        state.slot_tally[tid].primary += energy;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the energy flow over the step and check its conservation.
+ *
+ * Positron production by pair conversion consumes the rest mass of an e+e-
+ * pair, and the disappearance of a positron at zero energy (annihilation)
+ * releases it.
+ */
+inline CELER_FUNCTION void
+energy_monitor_post_track(NativeRef<EnergyMonitorStateData> const& state,
+                          CoreTrackView const&                     track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+        return;
+
+    const EnergyMonitorScalars& scalars  = state.scalars;
+    auto                        particle = track.make_particle_view();
+    auto                        step     = track.make_physics_step_view();
+
+    real_type post_energy = value_as<units::MevEnergy>(particle.energy());
+    real_type deposited = value_as<units::MevEnergy>(step.energy_deposition());
+    real_type secondary = 0;
+    real_type mass      = 0;
+    for (const Secondary& s : step.secondaries())
+    {
+        if (!s)
+            continue;
+        secondary += value_as<units::MevEnergy>(s.energy);
+        if (s.particle_id == scalars.positron)
+        {
+            mass += scalars.pair_mass;
+        }
+    }
+
+    ThreadId     tid   = track.thread_id();
+    EnergyTally& tally = state.slot_tally[tid];
+    if (sim.status() == TrackStatus::killed)
+    {
+        tally.escaped += post_energy;
+        if (particle.particle_id() == scalars.positron && post_energy == 0)
+        {
+            mass -= scalars.pair_mass;
+        }
+    }
+    tally.deposited += deposited;
+    tally.secondary += secondary;
+    tally.imbalance += state.pre_step_energy[tid] - post_energy - deposited
+                       - secondary - mass;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/EventTallyImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../EventTallyData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add the results of the step to the track's event.
+ */
+inline CELER_FUNCTION void
+event_tally_track(NativeRef<EventTallyStateData> const& state,
+                  CoreTrackView const&                  track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+        return;
+
+    CELER_ASSERT(sim.event_id() < state.size());
+    EventTally& tally = state.tally[sim.event_id()];
+
+    atomic_add(&tally.num_steps, size_type{1});
+    real_type edep = value_as<units::MevEnergy>(
+        track.make_physics_step_view().energy_deposition());
+    if (edep > 0)
+    {
+        atomic_add(&tally.energy_deposition, edep);
+    }
+    if (sim.status() == TrackStatus::killed)
+    {
+        atomic_add(&tally.num_tracks, size_type{1});
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
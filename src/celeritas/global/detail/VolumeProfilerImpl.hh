@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/VolumeProfilerImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../VolumeProfilerData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Count the step and whether it starts on a boundary.
+ */
+inline CELER_FUNCTION void
+volume_profiler_pre_track(NativeRef<VolumeProfilerStateData> const& state,
+                          CoreTrackView const&                      track)
+{
+    if (track.make_sim_view().status() == TrackStatus::inactive)
+        return;
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+        return;
+
+    VolumeTally& tally
+        = state.tally[state.tally_id(track.thread_id(), geo.volume_id())];
+    atomic_add(&tally.steps, ull_int{1});
+    if (geo.is_on_boundary())
+    {
+        atomic_add(&tally.zero_safety, ull_int{1});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the step length and whether the step leaves the volume.
+ *
+ * This must be called after the along-step action (so that the step limit is
+ * the actual step length) but before the boundary is crossed (so that the
+ * geometry state is still in the pre-step volume).
+ */
+inline CELER_FUNCTION void
+volume_profiler_post_track(NativeRef<VolumeProfilerStateData> const& state,
+                           CoreTrackView const&                      track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+        return;
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+        return;
+
+    VolumeTally& tally
+        = state.tally[state.tally_id(track.thread_id(), geo.volume_id())];
+    const StepLimit& limit = sim.step_limit();
+    atomic_add(&tally.length, limit.step);
+    if (limit.action == track.boundary_action())
+    {
+        atomic_add(&tally.crossings, ull_int{1});
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -38,6 +38,10 @@ namespace celeritas
  * \f]
  * This scaling is the inverse of the off-the-end energy scaling in the
  * RangeCalculator.
+ *
+ * If an \c InverseRangeGridData lookup table is provided, the range bin is
+ * located with a uniform grid lookup in log(range) rather than a binary
+ * search. The result is identical either way.
  */
 class InverseRangeCalculator
 {
@@ -47,6 +51,8 @@ class InverseRangeCalculator
     using Energy = Quantity<XsGridData::EnergyUnits>;
     using Values
         = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Indices
+        = Collection<size_type, Ownership::const_reference, MemSpace::native>;
     //!@}
 
   public:
@@ -54,12 +60,27 @@ class InverseRangeCalculator
     inline CELER_FUNCTION
     InverseRangeCalculator(const XsGridData& grid, const Values& values);
 
+    // Construct with a precomputed lookup table
+    inline CELER_FUNCTION
+    InverseRangeCalculator(const XsGridData&           grid,
+                           const Values&               values,
+                           const InverseRangeGridData& inverse,
+                           const Indices&              indices);
+
     // Find and interpolate from the energy
     inline CELER_FUNCTION Energy operator()(real_type range) const;
 
   private:
     UniformGrid               log_energy_;
     NonuniformGrid<real_type> range_;
+
+    // Optional uniform lookup
+    real_type             log_range_front_{};
+    real_type             log_range_delta_{};
+    Span<const size_type> range_bins_;
+
+    // Find the range bin
+    inline CELER_FUNCTION size_type find(real_type range) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -79,6 +100,24 @@ InverseRangeCalculator::InverseRangeCalculator(const XsGridData& grid,
     CELER_EXPECT(range_.size() == log_energy_.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from range data with a precomputed lookup table.
+ */
+CELER_FUNCTION
+InverseRangeCalculator::InverseRangeCalculator(
+    const XsGridData&           grid,
+    const Values&               values,
+    const InverseRangeGridData& inverse,
+    const Indices&              indices)
+    : InverseRangeCalculator(grid, values)
+{
+    CELER_EXPECT(inverse);
+    log_range_front_ = inverse.log_range.front;
+    log_range_delta_ = inverse.log_range.delta;
+    range_bins_      = indices[inverse.bin];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the energy of a particle that has the given range.
@@ -104,7 +143,7 @@ CELER_FUNCTION auto InverseRangeCalculator::operator()(real_type range) const
     }
 
     // Search for lower bin index
-    auto idx = range_.find(range);
+    auto idx = this->find(range);
     CELER_ASSERT(idx + 1 < log_energy_.size());
 
     // Interpolate: 'x' = range, y = log energy
@@ -115,5 +154,34 @@ CELER_FUNCTION auto InverseRangeCalculator::operator()(real_type range) const
     return Energy{loge};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the range bin: range must be in [front, back).
+ */
+CELER_FUNCTION size_type InverseRangeCalculator::find(real_type range) const
+{
+    if (range_bins_.empty())
+    {
+        return range_.find(range);
+    }
+
+    // Look up the approximate bin from the uniform log-range grid, guarding
+    // against roundoff at the edges
+    real_type j = (std::log(range) - log_range_front_) / log_range_delta_;
+    size_type uniform_idx = static_cast<size_type>(max(j, real_type(0)));
+    size_type idx = range_bins_[min(uniform_idx, range_bins_.size() - 1)];
+
+    // Correct for a range that lies outside the stored bin
+    while (range < range_[idx])
+    {
+        --idx;
+    }
+    while (range >= range_[idx + 1])
+    {
+        ++idx;
+    }
+    return idx;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/InverseRangeInserter.cc
+//---------------------------------------------------------------------------//
+#include "InverseRangeInserter.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reference to mutable host data.
+ */
+InverseRangeInserter::InverseRangeInserter(IndexCollection* bins)
+    : bins_(bins)
+{
+    CELER_EXPECT(bins);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a lookup table for the given range values.
+ *
+ * The range values must be positive and strictly increasing. The stored bin
+ * for each uniform grid point is the index \em i such that
+ * \f$ r_i \le r < r_{i+1} \f$ , clamped to the valid bins.
+ */
+InverseRangeGridData InverseRangeInserter::operator()(SpanConstReal values)
+{
+    CELER_EXPECT(values.size() >= 2);
+    CELER_EXPECT(values.front() > 0);
+    CELER_EXPECT(std::is_sorted(values.begin(), values.end()));
+
+    InverseRangeGridData result;
+    result.log_range = UniformGridData::from_bounds(
+        std::log(values.front()),
+        std::log(values.back()),
+        points_per_bin * (values.size() - 1) + 1);
+
+    UniformGrid            log_range(result.log_range);
+    std::vector<size_type> bins(log_range.size());
+    for (auto j : range(log_range.size()))
+    {
+        real_type r    = std::exp(log_range[j]);
+        auto      iter = std::upper_bound(values.begin(), values.end(), r);
+        auto      bin  = static_cast<size_type>(iter - values.begin());
+        bins[j]        = clamp<size_type>(bin, 1, values.size() - 1) - 1;
+    }
+    result.bin = bins_.insert_back(bins.begin(), bins.end());
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/InverseRangeInserter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+#include "XsGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct accelerated lookup tables for inverting range grids.
+ *
+ * The uniform log-range grid has \c points_per_bin times as many points as
+ * the range table so that each uniform cell typically spans at most one
+ * range bin.
+ *
+ * \code
+    InverseRangeInserter insert(&data.inverse_range_bins);
+    InverseRangeGridData inv = insert(data.reals[range_grid.value]);
+   \endcode
+ */
+class InverseRangeInserter
+{
+  public:
+    //!@{
+    //! Type aliases
+    using IndexCollection
+        = Collection<size_type, Ownership::value, MemSpace::host>;
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+    //! Number of uniform grid points per range table point
+    static constexpr size_type points_per_bin = 2;
+
+  public:
+    // Construct with a reference to mutable host data
+    explicit InverseRangeInserter(IndexCollection* bins);
+
+    // Add a lookup table for the given range values
+    InverseRangeGridData operator()(SpanConstReal values);
+
+  private:
+    CollectionBuilder<size_type, MemSpace::host, ItemId<size_type>> bins_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
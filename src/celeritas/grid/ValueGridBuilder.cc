@@ -22,11 +22,11 @@ namespace celeritas
 {
 namespace
 {
-using SpanConstReal = ValueGridXsBuilder::SpanConstReal;
+using SpanConstDbl = ValueGridXsBuilder::SpanConstDbl;
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
-bool is_contiguous_increasing(SpanConstReal first, SpanConstReal second)
+bool is_contiguous_increasing(SpanConstDbl first, SpanConstDbl second)
 {
     return first.size() >= 2 && second.size() >= 2 && first.front() > 0
            && first.back() > first.front()
@@ -34,14 +34,14 @@ bool is_contiguous_increasing(SpanConstReal first, SpanConstReal second)
            && second.back() > second.front();
 }
 
-real_type calc_log_delta(SpanConstReal vec)
+double calc_log_delta(SpanConstDbl vec)
 {
-    return std::pow(vec.back() / vec.front(), real_type(1) / (vec.size() - 1));
+    return std::pow(vec.back() / vec.front(), 1.0 / (vec.size() - 1));
 }
 
-bool has_log_spacing(SpanConstReal vec)
+bool has_log_spacing(SpanConstDbl vec)
 {
-    real_type delta = calc_log_delta(vec);
+    double delta = calc_log_delta(vec);
     for (auto i : range(vec.size() - 1))
     {
         if (!soft_equal(delta, vec[i + 1] / vec[i]))
@@ -50,15 +50,15 @@ bool has_log_spacing(SpanConstReal vec)
     return true;
 }
 
-bool has_same_log_spacing(SpanConstReal first, SpanConstReal second)
+bool has_same_log_spacing(SpanConstDbl first, SpanConstDbl second)
 {
     return soft_equal(calc_log_delta(first), calc_log_delta(second));
 }
 
-bool is_nonnegative(SpanConstReal vec)
+template<class T>
+bool is_nonnegative(Span<T> vec)
 {
-    return std::all_of(
-        vec.begin(), vec.end(), [](real_type v) { return v >= 0; });
+    return std::all_of(vec.begin(), vec.end(), [](T v) { return v >= 0; });
 }
 
 bool is_on_grid_point(real_type value, real_type lo, real_type hi, size_type size)
@@ -70,7 +70,8 @@ bool is_on_grid_point(real_type value, real_type lo, real_type hi, size_type siz
     return soft_mod(value - lo, delta);
 }
 
-bool is_monotonic_increasing(SpanConstReal grid)
+template<class T>
+bool is_monotonic_increasing(Span<T> grid)
 {
     CELER_EXPECT(!grid.empty());
     auto iter = grid.begin();
@@ -100,10 +101,10 @@ ValueGridBuilder::~ValueGridBuilder() = default;
  * Construct XS arrays from imported data from Geant4.
  */
 std::unique_ptr<ValueGridXsBuilder>
-ValueGridXsBuilder::from_geant(SpanConstReal lambda_energy,
-                               SpanConstReal lambda,
-                               SpanConstReal lambda_prim_energy,
-                               SpanConstReal lambda_prim)
+ValueGridXsBuilder::from_geant(SpanConstDbl lambda_energy,
+                               SpanConstDbl lambda,
+                               SpanConstDbl lambda_prim_energy,
+                               SpanConstDbl lambda_prim)
 {
     CELER_EXPECT(is_contiguous_increasing(lambda_energy, lambda_prim_energy));
     CELER_EXPECT(has_log_spacing(lambda_energy)
@@ -134,8 +135,8 @@ ValueGridXsBuilder::from_geant(SpanConstReal lambda_energy,
  * Construct XS arrays from scaled (*E) data from Geant4.
  */
 std::unique_ptr<ValueGridXsBuilder>
-ValueGridXsBuilder::from_scaled(SpanConstReal lambda_prim_energy,
-                                SpanConstReal lambda_prim)
+ValueGridXsBuilder::from_scaled(SpanConstDbl lambda_prim_energy,
+                                SpanConstDbl lambda_prim)
 {
     CELER_EXPECT(lambda_prim.size() == lambda_prim_energy.size());
     CELER_EXPECT(has_log_spacing(lambda_prim_energy));
@@ -202,7 +203,7 @@ auto ValueGridXsBuilder::build(ValueGridInserter insert) const -> ValueGridId
 /*!
  * Construct arrays from log-spaced geant data.
  */
-auto ValueGridLogBuilder::from_geant(SpanConstReal energy, SpanConstReal value)
+auto ValueGridLogBuilder::from_geant(SpanConstDbl energy, SpanConstDbl value)
     -> UPLogBuilder
 {
     CELER_EXPECT(!energy.empty());
@@ -221,7 +222,7 @@ auto ValueGridLogBuilder::from_geant(SpanConstReal energy, SpanConstReal value)
  * (always nonnegative) stopping power -dE/dx . If not monotonic then the
  * inverse range cannot be calculated.
  */
-auto ValueGridLogBuilder::from_range(SpanConstReal energy, SpanConstReal value)
+auto ValueGridLogBuilder::from_range(SpanConstDbl energy, SpanConstDbl value)
     -> UPLogBuilder
 {
     CELER_EXPECT(!energy.empty());
@@ -66,21 +66,21 @@ class ValueGridXsBuilder final : public ValueGridBuilder
   public:
     //!@{
     //! Type aliases
-    using SpanConstReal = Span<const real_type>;
-    using VecReal       = std::vector<real_type>;
+    using SpanConstDbl = Span<const double>;
+    using VecReal      = std::vector<real_type>;
     //!@}
 
   public:
     // Construct from imported data
     static std::unique_ptr<ValueGridXsBuilder>
-    from_geant(SpanConstReal lambda_energy,
-               SpanConstReal lambda,
-               SpanConstReal lambda_prim_energy,
-               SpanConstReal lambda_prim);
+    from_geant(SpanConstDbl lambda_energy,
+               SpanConstDbl lambda,
+               SpanConstDbl lambda_prim_energy,
+               SpanConstDbl lambda_prim);
 
     // Construct from just scaled cross sections
     static std::unique_ptr<ValueGridXsBuilder>
-    from_scaled(SpanConstReal lambda_prim_energy, SpanConstReal lambda_prim);
+    from_scaled(SpanConstDbl lambda_prim_energy, SpanConstDbl lambda_prim);
 
     // Construct
     ValueGridXsBuilder(real_type emin,
@@ -111,16 +111,17 @@ class ValueGridLogBuilder : public ValueGridBuilder
     //! Type aliases
     using VecReal       = std::vector<real_type>;
     using SpanConstReal = Span<const real_type>;
+    using SpanConstDbl  = Span<const double>;
     using Id            = ItemId<XsGridData>;
     using UPLogBuilder  = std::unique_ptr<ValueGridLogBuilder>;
     //!@}
 
   public:
     // Construct from full grids
-    static UPLogBuilder from_geant(SpanConstReal energy, SpanConstReal value);
+    static UPLogBuilder from_geant(SpanConstDbl energy, SpanConstDbl value);
 
     // Construct from range
-    static UPLogBuilder from_range(SpanConstReal energy, SpanConstReal range);
+    static UPLogBuilder from_range(SpanConstDbl energy, SpanConstDbl range);
 
     // Construct
     ValueGridLogBuilder(real_type emin, real_type emax, VecReal value);
@@ -50,6 +50,28 @@ struct XsGridData
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Accelerated lookup for inverting a range grid.
+ *
+ * Each point \em j of the uniform \c log_range grid stores the index of the
+ * range table bin that contains the range \f$ \exp(\log r_0 + j \delta) \f$.
+ * Locating the bin of an arbitrary range is then a uniform grid lookup
+ * followed by (usually zero or one) linear steps rather than a binary search
+ * over the nonuniform range values.
+ */
+struct InverseRangeGridData
+{
+    UniformGridData      log_range; //!< Uniform grid in log(range)
+    ItemRange<size_type> bin;       //!< Range table bin for each grid point
+
+    //! Whether the interface is initialized and valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_range && bin.size() == log_range.size;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * A generic grid of 1D data with arbitrary interpolation.
@@ -7,10 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
-#include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/random/distribution/GenerateCanonical.hh"
@@ -28,22 +30,24 @@ namespace celeritas
  * of the element in the material.
  *
  * On construction, the element chooser uses the provided arguments to
- * precalculate all the microscopic cross sections in the given storage space.
- * The given function `calc_micro_xs` must accept a `ElementId` and return a
- * `real_type`, a non-negative microscopic cross section.
+ * calculate the total (material-averaged) microscopic cross section. The given
+ * function `calc_micro_xs` must accept a `ElementId` and return a
+ * `real_type`, a non-negative microscopic cross section. Sampling
+ * recalculates the elemental cross sections on the fly rather than saving
+ * them, so that no per-track scratch storage is required: the extra cost of
+ * evaluating the cross sections twice is small compared to the memory
+ * otherwise reserved for every track slot.
  *
  * The element chooser does \em not calculate macroscopic cross sections
  * because they're multiplied by fraction, not number density, and we only
  * care about the fractional abundances and cross section weighting.
  *
  * \code
-    ElementSelector select_element(mat, calc_micro, storage);
+    auto select_element = make_element_selector(mat, calc_micro);
     real_type total_macro_xs
-        = select_element.material_micro_xs() *  mat.number_density();
+        = select_element.material_micro_xs() * mat.number_density();
     ElementComponentId id = select_element(rng);
-    real_type selected_micro_xs =
- select_element.elemental_micro_xs()[el.get()]; ElementView el =
- mat.make_element_view(id);
+    ElementView el = mat.make_element_view(id);
     // use el.Z(), etc.
    \endcode
  *
@@ -54,21 +58,13 @@ namespace celeritas
  *
  * \todo Refactor to use Selector.
  */
+template<class MicroXsCalc>
 class ElementSelector
 {
   public:
-    //!@{
-    //! Type aliases
-    using SpanReal      = Span<real_type>;
-    using SpanConstReal = Span<const real_type>;
-    //!@}
-
-  public:
-    // Construct with material, xs calculator, and storage.
-    template<class MicroXsCalc>
+    // Construct with material and xs calculator
     inline CELER_FUNCTION ElementSelector(const MaterialView& material,
-                                          MicroXsCalc&&       calc_micro_xs,
-                                          SpanReal micro_xs_storage);
+                                          MicroXsCalc         calc_micro_xs);
 
     // Sample with the given RNG
     template<class Engine>
@@ -77,39 +73,50 @@ class ElementSelector
     //! Weighted material microscopic cross section
     CELER_FUNCTION real_type material_micro_xs() const { return material_xs_; }
 
-    // Individual (unweighted) microscopic cross sections
-    inline CELER_FUNCTION SpanConstReal elemental_micro_xs() const;
+    // Individual (unweighted) microscopic cross section of a component
+    inline CELER_FUNCTION real_type
+    elemental_micro_xs(ElementComponentId id) const;
 
   private:
     Span<const MatElementComponent> elements_;
+    MicroXsCalc                     calc_micro_xs_;
     real_type                       material_xs_;
-    real_type*                      elemental_xs_;
 };
 
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Create an element selector, deducing the cross section calculator type.
+ */
+template<class MicroXsCalc>
+CELER_FUNCTION ElementSelector<std::decay_t<MicroXsCalc>>
+make_element_selector(const MaterialView& material,
+                      MicroXsCalc&&       calc_micro_xs)
+{
+    return {material, std::forward<MicroXsCalc>(calc_micro_xs)};
+}
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
- * Construct with material, xs calculator, and storage.
+ * Construct with material and xs calculator.
  */
 template<class MicroXsCalc>
-CELER_FUNCTION ElementSelector::ElementSelector(const MaterialView& material,
-                                                MicroXsCalc&& calc_micro_xs,
-                                                SpanReal      storage)
+CELER_FUNCTION
+ElementSelector<MicroXsCalc>::ElementSelector(const MaterialView& material,
+                                              MicroXsCalc calc_micro_xs)
     : elements_(material.elements())
+    , calc_micro_xs_(std::move(calc_micro_xs))
     , material_xs_(0)
-    , elemental_xs_(storage.data())
 {
     CELER_EXPECT(!elements_.empty());
-    CELER_EXPECT(storage.size() >= material.num_elements());
-    for (auto i : range<size_type>(elements_.size()))
+    for (const MatElementComponent& component : elements_)
     {
-        const real_type micro_xs = calc_micro_xs(elements_[i].element);
+        const real_type micro_xs = calc_micro_xs_(component.element);
         CELER_ASSERT(micro_xs >= 0);
-        const real_type frac = elements_[i].fraction;
-
-        elemental_xs_[i] = micro_xs;
-        material_xs_ += micro_xs * frac;
+        material_xs_ += micro_xs * component.fraction;
     }
     CELER_ENSURE(material_xs_ >= 0);
 }
@@ -119,17 +126,21 @@ CELER_FUNCTION ElementSelector::ElementSelector(const MaterialView& material,
  * Sample the element with the given RNG.
  *
  * To reduce register usage, this function starts with the cumulative sums and
- * counts backward.
+ * counts backward. The microscopic cross sections are recalculated in the
+ * same order as during construction.
  */
+template<class MicroXsCalc>
 template<class Engine>
-CELER_FUNCTION ElementComponentId ElementSelector::operator()(Engine& rng) const
+CELER_FUNCTION ElementComponentId
+ElementSelector<MicroXsCalc>::operator()(Engine& rng) const
 {
     real_type accum_xs = -material_xs_ * generate_canonical(rng);
     size_type i        = 0;
     size_type imax     = elements_.size() - 1;
     for (; i != imax; ++i)
     {
-        accum_xs += elements_[i].fraction * elemental_xs_[i];
+        accum_xs += elements_[i].fraction
+                    * calc_micro_xs_(elements_[i].element);
         if (accum_xs > 0)
             break;
     }
@@ -138,11 +149,14 @@ CELER_FUNCTION ElementComponentId ElementSelector::operator()(Engine& rng) const
 
 //---------------------------------------------------------------------------//
 /*!
- * Get individual microscopic cross sections.
+ * Calculate the microscopic cross section of a single component.
  */
-CELER_FUNCTION auto ElementSelector::elemental_micro_xs() const -> SpanConstReal
+template<class MicroXsCalc>
+CELER_FUNCTION real_type
+ElementSelector<MicroXsCalc>::elemental_micro_xs(ElementComponentId id) const
 {
-    return {elemental_xs_, elements_.size()};
+    CELER_EXPECT(id < elements_.size());
+    return calc_micro_xs_(elements_[id.get()].element);
 }
 
 //---------------------------------------------------------------------------//
@@ -139,11 +139,6 @@ struct MaterialTrackState
  * The size of the view will be the size of the vector of tracks. Each particle
  * track state corresponds to the thread ID (\c ThreadId).
  *
- * The "element scratch space" is a 2D array of reals, indexed with
- * [track_id][el_component_id], where the fast-moving dimension has the
- * greatest number of element components of any material in the problem. This
- * can be used for the physics to calculate microscopic cross sections.
- *
  * \sa MaterialStateStore (owns the pointed-to data)
  * \sa MaterialTrackView (uses the pointed-to data in a kernel)
  */
@@ -154,7 +149,6 @@ struct MaterialStateData
     using Items = celeritas::StateCollection<T, W, M>;
 
     Items<MaterialTrackState> state;
-    Items<real_type> element_scratch; // 2D array: [num states][max components]
 
     //! Whether the interface is assigned
     explicit CELER_FUNCTION operator bool() const { return !state.empty(); }
@@ -167,8 +161,7 @@ struct MaterialStateData
     MaterialStateData& operator=(MaterialStateData<W2, M2>& other)
     {
         CELER_EXPECT(other);
-        state           = other.state;
-        element_scratch = other.element_scratch;
+        state = other.state;
         return *this;
     }
 };
@@ -179,12 +172,11 @@ struct MaterialStateData
  */
 template<MemSpace M>
 inline void resize(MaterialStateData<Ownership::value, M>* data,
-                   const HostCRef<MaterialParamsData>&     params,
+                   const HostCRef<MaterialParamsData>&,
                    size_type                               size)
 {
     CELER_EXPECT(size > 0);
     resize(&data->state, size);
-    resize(&data->element_scratch, size * params.max_element_components);
 }
 
 //---------------------------------------------------------------------------//
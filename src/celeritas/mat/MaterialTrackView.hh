@@ -65,9 +65,6 @@ class MaterialTrackView
     // Get a view to material properties
     CELER_FORCEINLINE_FUNCTION MaterialView make_material_view() const;
 
-    // Access scratch space with at least one real per element component
-    inline CELER_FUNCTION Span<real_type> element_scratch();
-
   private:
     const MaterialParamsRef& params_;
     const MaterialStateRef&  states_;
@@ -121,19 +118,6 @@ CELER_FUNCTION MaterialView MaterialTrackView::make_material_view() const
     return MaterialView(params_, this->material_id());
 }
 
-//---------------------------------------------------------------------------//
-/*!
- * Access scratch space with at least one real per element component.
- */
-CELER_FUNCTION Span<real_type> MaterialTrackView::element_scratch()
-{
-    auto            offset = thread_.get() * params_.max_element_components;
-    Span<real_type> all_scratch
-        = states_.element_scratch[AllItems<real_type, MemSpace::native>{}];
-    CELER_ENSURE(offset + params_.max_element_components <= all_scratch.size());
-    return all_scratch.subspan(offset, params_.max_element_components);
-}
-
 //---------------------------------------------------------------------------//
 /*!
  * Access the thread-local state.
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/CompactSecondariesAction.cc
+//---------------------------------------------------------------------------//
+#include "CompactSecondariesAction.hh"
+
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/StackAllocator.hh"
+
+#include "Secondary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Compact host secondaries.
+ *
+ * This runs serially after all interactions: the stack is typically small
+ * compared to the track states, and moving the secondaries is sequential.
+ */
+void CompactSecondariesAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+
+    StackAllocator<Secondary> allocate(data.states.physics.secondaries);
+    if (!allocate.chunked())
+    {
+        return;
+    }
+
+    // Gather the secondaries of all tracks (inactive tracks have none)
+    std::vector<Span<Secondary>*> allocations;
+    auto& track_states = data.states.physics.state;
+    for (auto tid : range(ThreadId{track_states.size()}))
+    {
+        Span<Secondary>& secondaries = track_states[tid].secondaries;
+        if (!secondaries.empty())
+        {
+            allocations.push_back(&secondaries);
+        }
+    }
+
+    allocate.compact(make_span(allocations));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
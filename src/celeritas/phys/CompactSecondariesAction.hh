@@ -0,0 +1,45 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/CompactSecondariesAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the unused chunk remainders from the host secondary stack.
+ *
+ * When host threads allocate secondaries from reserved chunks, the stack size
+ * after the interactions includes the unused ends of each chunk. This moves
+ * the secondaries of every track to the front of the stack, preserving their
+ * order, so that the stack size is the number of secondaries created in the
+ * step.
+ *
+ * Device secondaries are allocated with atomics and are already contiguous.
+ */
+class CompactSecondariesAction final : public ExplicitActionInterface,
+                                       public ConcreteAction
+{
+  public:
+    // Construct with ID and label
+    using ConcreteAction::ConcreteAction;
+
+    // Compact host secondaries
+    void execute(CoreHostRef const&) const final;
+
+    //! Device secondaries are always contiguous
+    void execute(CoreDeviceRef const&) const final {}
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::end; }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -33,6 +33,13 @@ struct ImportData;
  * import, the cutoff map in \c ImportMaterial stores only the cuts available
  * in Geant4, i.e. only values for gammas, electrons, positrons, and protons.
  *
+ * Since Geant4 creates a couple for each combination of material and
+ * production cuts (one per region that uses the material), an imported
+ * \c MaterialId corresponds to a couple rather than a unique material
+ * composition. Volumes in a region with coarser cuts are mapped to a copy of
+ * the material, and the physics tables imported for that copy are
+ * consistent with its cuts.
+ *
  * In Celeritas, particle cutoff is stored contiguously in a single vector
  * of size num_particles * num_materials, which stores all particle cutoffs
  * for all materials. During import, any particle that is not in Geant4's
@@ -66,6 +66,9 @@ class Model : public ExplicitActionInterface
 
     //! Dependency ordering of the action
     ActionOrder order() const final { return ActionOrder::post; }
+
+    //! Interactions only change tracks that selected this model
+    bool concurrent() const override { return true; }
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/MortonSort.cc
+//---------------------------------------------------------------------------//
+#include "MortonSort.hh"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Number of bits per dimension in a Morton code
+constexpr int morton_bits = 21;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Spread the lower 21 bits of an integer so there are two zeros between each.
+ */
+std::uint64_t spread_bits(std::uint64_t x)
+{
+    x &= 0x1fffffull;
+    x = (x | x << 32) & 0x1f00000000ffffull;
+    x = (x | x << 16) & 0x1f0000ff0000ffull;
+    x = (x | x << 8) & 0x100f00f00f00f00full;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+    x = (x | x << 2) & 0x1249249249249249ull;
+    return x;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the 63-bit Morton code of a point inside a bounding box.
+ *
+ * Each coordinate is quantized to 21 bits over the extent of the box, and the
+ * bits of the three coordinates are interleaved (x in the lowest bit) so that
+ * points that are close in space tend to have close codes. Points outside the
+ * box are clamped to its faces, and a degenerate axis contributes zeros.
+ */
+std::uint64_t
+morton_code(const Real3& pos, const Real3& lower, const Real3& upper)
+{
+    constexpr real_type max_int = (1u << morton_bits) - 1;
+
+    std::uint64_t result = 0;
+    for (auto ax : range(3))
+    {
+        const real_type width = upper[ax] - lower[ax];
+        CELER_EXPECT(width >= 0);
+
+        std::uint64_t quantized = 0;
+        if (width > 0)
+        {
+            real_type frac = (pos[ax] - lower[ax]) / width;
+            frac           = std::min<real_type>(std::max<real_type>(frac, 0),
+                                       1);
+            quantized      = static_cast<std::uint64_t>(frac * max_int);
+        }
+        result |= spread_bits(quantized) << ax;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort primaries along a space-filling curve through their positions.
+ *
+ * Neighboring primaries (and therefore neighboring track slots after
+ * initialization) start near each other, which improves the memory locality
+ * of geometry and material lookups for the first steps. The sort is stable,
+ * so primaries at the same position keep their original (event) order.
+ */
+void morton_sort(Span<Primary> primaries)
+{
+    if (primaries.size() < 2)
+    {
+        return;
+    }
+
+    // Find the bounding box of the starting positions
+    Real3 lower, upper;
+    lower.fill(std::numeric_limits<real_type>::infinity());
+    upper.fill(-std::numeric_limits<real_type>::infinity());
+    for (const Primary& p : primaries)
+    {
+        for (auto ax : range(3))
+        {
+            lower[ax] = std::min(lower[ax], p.position[ax]);
+            upper[ax] = std::max(upper[ax], p.position[ax]);
+        }
+    }
+
+    // Sort the primaries with their codes
+    std::vector<std::pair<std::uint64_t, Primary>> keyed(primaries.size());
+    for (auto i : range(primaries.size()))
+    {
+        keyed[i].first  = morton_code(primaries[i].position, lower, upper);
+        keyed[i].second = primaries[i];
+    }
+    std::stable_sort(
+        keyed.begin(), keyed.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+    for (auto i : range(primaries.size()))
+    {
+        primaries[i] = keyed[i].second;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/MortonSort.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+#include "corecel/cont/Span.hh"
+#include "celeritas/Types.hh"
+
+#include "Primary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Calculate the 63-bit Morton code of a point inside a bounding box
+std::uint64_t
+morton_code(const Real3& pos, const Real3& lower, const Real3& upper);
+
+// Sort primaries along a space-filling curve through their positions
+void morton_sort(Span<Primary> primaries);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
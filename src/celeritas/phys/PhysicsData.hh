@@ -228,6 +228,7 @@ struct PhysicsParamsScalars
     real_type fixed_step_limiter{}; //!< Global charged step size limit [cm]
 
     real_type secondary_stack_factor = 3; //!< Secondary storage per state size
+    size_type secondary_chunk_size{};     //!< Host secondaries reserved at once
 
     // When fixed step limiter is used, this is the corresponding action ID
     ActionId fixed_step_action{};
@@ -296,6 +297,8 @@ struct PhysicsParamsData
     using ParticleItems = Collection<T, W, M, ParticleId>;
     template<class T>
     using ParticleModelItems = Collection<T, W, M, ParticleModelId>;
+    template<class T>
+    using ValueGridItems = Collection<T, W, M, ValueGridId>;
 
     //// DATA ////
 
@@ -313,6 +316,10 @@ struct PhysicsParamsData
     ParticleModelItems<ModelId>      model_ids;
     ParticleModelItems<ModelXsTable> model_xs;
 
+    // Range inversion lookup tables [ValueGridId]
+    Items<size_type>                     inverse_range_bins;
+    ValueGridItems<InverseRangeGridData> inverse_range_grids;
+
     // Special data
     HardwiredModels<W, M> hardwired;
 
@@ -346,6 +353,9 @@ struct PhysicsParamsData
         model_ids       = other.model_ids;
         model_xs        = other.model_xs;
 
+        inverse_range_bins  = other.inverse_range_bins;
+        inverse_range_grids = other.inverse_range_grids;
+
         hardwired = other.hardwired;
 
         scalars = other.scalars;
@@ -466,7 +476,9 @@ inline void resize(PhysicsStateData<Ownership::value, M>* state,
     resize(&state->per_process_xs,
            size * params.scalars.max_particle_processes);
     resize(&state->relaxation, params.hardwired.relaxation_data, size);
-    resize(&state->secondaries, size * params.scalars.secondary_stack_factor);
+    resize(&state->secondaries,
+           size * params.scalars.secondary_stack_factor,
+           params.scalars.secondary_chunk_size);
 }
 
 //---------------------------------------------------------------------------//
@@ -24,11 +24,13 @@
 #include "celeritas/em/process/MultipleScatteringProcess.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/grid/InverseRangeInserter.hh"
 #include "celeritas/grid/ValueGridBuilder.hh"
 #include "celeritas/grid/ValueGridInserter.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/mat/MaterialParams.hh"
 
+#include "CompactSecondariesAction.hh"
 #include "ParticleParams.hh"
 #include "generated/DiscreteSelectAction.hh"
 #include "generated/PreStepAction.hh"
@@ -112,6 +114,7 @@ PhysicsParams::PhysicsParams(Input inp)
     this->build_ids(*inp.particles, &host_data);
     this->build_xs(inp.options, *inp.materials, &host_data);
     this->build_model_xs(*inp.materials, &host_data);
+    this->build_inverse_range(&host_data);
 
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
@@ -129,6 +132,19 @@ PhysicsParams::PhysicsParams(Input inp)
         fixed_step_action_                   = std::move(fixed_step_action);
     }
 
+    // Make the secondary stack contiguous if host threads allocate chunks
+    if (inp.options.secondary_chunk_size > 0)
+    {
+        auto& action_reg = *inp.action_registry;
+
+        auto compact_action = std::make_shared<CompactSecondariesAction>(
+            action_reg.next_id(),
+            "compact-secondaries",
+            "remove unused space from host secondary chunks");
+        action_reg.insert(compact_action);
+        compact_secondaries_action_ = std::move(compact_action);
+    }
+
     // Copy data to device
     data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
 
@@ -212,6 +228,7 @@ void PhysicsParams::build_options(const Options& opts, HostValue* data) const
     data->scalars.eloss_calc_limit       = opts.eloss_calc_limit;
     data->scalars.linear_loss_limit      = opts.linear_loss_limit;
     data->scalars.secondary_stack_factor = opts.secondary_stack_factor;
+    data->scalars.secondary_chunk_size   = opts.secondary_chunk_size;
 }
 
 //---------------------------------------------------------------------------//
@@ -707,5 +724,53 @@ void PhysicsParams::build_model_xs(const MaterialParams& mats,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct uniform lookup tables for inverting range grids.
+ *
+ * One entry is stored for every value grid so that the lookup can be indexed
+ * by the range grid's ID; grids that aren't energy loss range tables are left
+ * unassigned.
+ */
+void PhysicsParams::build_inverse_range(HostValue* data) const
+{
+    CELER_EXPECT(*data);
+
+    std::vector<InverseRangeGridData> temp_grids(data->value_grids.size());
+    InverseRangeInserter              insert(&data->inverse_range_bins);
+
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        const ProcessGroup& process_group = data->process_groups[particle_id];
+        if (!process_group.eloss_ppid)
+        {
+            continue;
+        }
+
+        Span<const ValueTable> range_tables
+            = data->value_tables[process_group.tables[ValueGridType::range]];
+        const ValueTable& range_table
+            = range_tables[process_group.eloss_ppid.get()];
+        for (ValueGridId grid_id : data->value_grid_ids[range_table.grids])
+        {
+            if (!grid_id || temp_grids[grid_id.get()])
+            {
+                continue;
+            }
+            Span<const real_type> values
+                = data->reals[data->value_grids[grid_id].value];
+            if (values.front() <= 0)
+            {
+                // Range can't be transformed to a log grid
+                continue;
+            }
+            temp_grids[grid_id.get()] = insert(values);
+        }
+    }
+
+    make_builder(&data->inverse_range_grids)
+        .insert_back(temp_grids.begin(), temp_grids.end());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
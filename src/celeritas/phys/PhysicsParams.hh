@@ -46,6 +46,10 @@ class ParticleParams;
  *   energy loss.
  * - \c secondary_stack_factor: the number of secondary slots per track slot
  *   allocated.
+ * - \c secondary_chunk_size: if nonzero, each host thread reserves this many
+ *   secondary slots at a time rather than atomically incrementing the shared
+ *   stack size for every interaction. A "compact-secondaries" action then
+ *   makes the stack contiguous at the end of each step.
  * - \c disable_integral_xs: for particles with energy loss processes, the
  *   particle energy changes over the step, so the assumption that the cross
  *   section is constant is no longer valid. By default, many charged particle
@@ -64,6 +68,7 @@ struct PhysicsParamsOptions
     Energy    eloss_calc_limit       = Energy{0.001};
     real_type linear_loss_limit      = 0.01;
     real_type secondary_stack_factor = 3;
+    size_type secondary_chunk_size   = 0;
     bool      disable_integral_xs    = false;
 };
 
@@ -87,6 +92,8 @@ struct PhysicsParamsOptions
  *   due to integral cross sectionl
  * - "integral-rejected": do not apply a discrete interaction
  * - "failure": model failed to allocate secondaries
+ * - "compact-secondaries": make the secondary stack contiguous (only with
+ *   chunked host allocation)
  */
 class PhysicsParams
 {
@@ -171,6 +178,7 @@ class PhysicsParams
     SPAction integral_rejection_action_;
     SPAction failure_action_;
     SPAction fixed_step_action_;
+    SPAction compact_secondaries_action_;
 
     // Host metadata/access
     VecProcess        processes_;
@@ -188,6 +196,7 @@ class PhysicsParams
                       const MaterialParams& mats,
                       HostValue*            data) const;
     void     build_model_xs(const MaterialParams& mats, HostValue* data) const;
+    void     build_inverse_range(HostValue* data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -16,6 +16,7 @@
 #include "celeritas/em/xs/EPlusGGMacroXsCalculator.hh"
 #include "celeritas/em/xs/LivermorePEMacroXsCalculator.hh"
 #include "celeritas/grid/GridIdFinder.hh"
+#include "celeritas/grid/InverseRangeCalculator.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/mat/MaterialView.hh"
 #include "celeritas/mat/TabulatedElementSelector.hh"
@@ -637,6 +638,32 @@ CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id) const
     return T{params_.value_grids[id], params_.reals};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct an inverse range calculator.
+ *
+ * If a uniform lookup table was built for the range grid, it is used to avoid
+ * a binary search over the range values.
+ */
+template<>
+inline CELER_FUNCTION InverseRangeCalculator
+PhysicsTrackView::make_calculator<InverseRangeCalculator>(ValueGridId id) const
+{
+    CELER_EXPECT(id < params_.value_grids.size());
+    if (id < params_.inverse_range_grids.size())
+    {
+        if (const InverseRangeGridData& inverse
+            = params_.inverse_range_grids[id])
+        {
+            return InverseRangeCalculator{params_.value_grids[id],
+                                          params_.reals,
+                                          inverse,
+                                          params_.inverse_range_bins};
+        }
+    }
+    return InverseRangeCalculator{params_.value_grids[id], params_.reals};
+}
+
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -0,0 +1,255 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/PrimaryBatchGenerator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/random/distribution/DeltaDistribution.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+#include "PDGNumber.hh"
+#include "ParticleParams.hh"
+#include "Primary.hh"
+#include "PrimaryGeneratorOptions.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fill caller-owned storage with primaries sampled from fixed distributions.
+ *
+ * This generates the same primaries (for the same distributions and random
+ * number sequence) as \c PrimaryGenerator, but the distributions are template
+ * parameters rather than \c std::function objects, and each call writes into
+ * a span instead of returning a new vector for every event. Events can span
+ * multiple calls: each call fills as much of the buffer as possible and
+ * returns the number of primaries written, which is zero once all events have
+ * been generated.
+ *
+ * Use \c visit_primary_batch_generator to construct a generator from
+ * run-time options.
+ */
+template<class ED, class PD, class DD>
+class PrimaryBatchGenerator
+{
+  public:
+    //!@{
+    using SPConstParticles = std::shared_ptr<const ParticleParams>;
+    //!@}
+
+    struct Input
+    {
+        std::vector<PDGNumber> pdg;
+        size_type              num_events{};
+        size_type              primaries_per_event{};
+    };
+
+  public:
+    // Construct with counts, shared particle data, and distributions
+    inline PrimaryBatchGenerator(SPConstParticles particles,
+                                 const Input&     inp,
+                                 ED               sample_energy,
+                                 PD               sample_pos,
+                                 DD               sample_dir);
+
+    // Generate primaries into the given storage
+    template<class Engine>
+    inline size_type operator()(Engine& rng, Span<Primary> primaries);
+
+    //! Total number of primaries that have yet to be generated
+    size_type num_remaining() const
+    {
+        return num_events_ * primaries_per_event_ - primary_count_;
+    }
+
+  private:
+    size_type               num_events_{};
+    size_type               primaries_per_event_{};
+    ED                      sample_energy_;
+    PD                      sample_pos_;
+    DD                      sample_dir_;
+    std::vector<ParticleId> particle_id_;
+    size_type               primary_count_{0};
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a batch generator from user input and pass it to a functor.
+ *
+ * The distributions are selected at run time from the options, so this
+ * instantiates the functor for each supported combination of energy,
+ * spatial, and angular distributions.
+ */
+template<class F>
+void visit_primary_batch_generator(
+    std::shared_ptr<const ParticleParams> particles,
+    const PrimaryGeneratorOptions&        opts,
+    F&&                                   visit)
+{
+    using DS = DistributionSelection;
+
+    CELER_EXPECT(opts);
+
+    auto visit_impl = [&](auto&& energy, auto&& pos, auto&& dir) {
+        using ED = std::decay_t<decltype(energy)>;
+        using PD = std::decay_t<decltype(pos)>;
+        using DD = std::decay_t<decltype(dir)>;
+
+        typename PrimaryBatchGenerator<ED, PD, DD>::Input inp;
+        inp.pdg                 = opts.pdg;
+        inp.num_events          = opts.num_events;
+        inp.primaries_per_event = opts.primaries_per_event;
+        PrimaryBatchGenerator<ED, PD, DD> generate(particles,
+                                                   inp,
+                                                   std::move(energy),
+                                                   std::move(pos),
+                                                   std::move(dir));
+        visit(generate);
+    };
+
+    // Select angular distribution
+    auto visit_dir = [&](auto&& energy, auto&& pos) {
+        const auto& p = opts.direction.params;
+        switch (opts.direction.distribution)
+        {
+            case DS::delta:
+                CELER_ASSERT(p.size() == 3);
+                return visit_impl(
+                    std::move(energy),
+                    std::move(pos),
+                    DeltaDistribution<Real3>(Real3{p[0], p[1], p[2]}));
+            case DS::isotropic:
+                CELER_ASSERT(p.empty());
+                return visit_impl(std::move(energy),
+                                  std::move(pos),
+                                  IsotropicDistribution<real_type>());
+            default:
+                CELER_ASSERT_UNREACHABLE();
+        }
+    };
+
+    // Select spatial distribution
+    auto visit_pos = [&](auto&& energy) {
+        const auto& p = opts.position.params;
+        switch (opts.position.distribution)
+        {
+            case DS::delta:
+                CELER_ASSERT(p.size() == 3);
+                return visit_dir(
+                    std::move(energy),
+                    DeltaDistribution<Real3>(Real3{p[0], p[1], p[2]}));
+            case DS::box:
+                CELER_ASSERT(p.size() == 6);
+                return visit_dir(std::move(energy),
+                                 UniformBoxDistribution<real_type>(
+                                     Real3{p[0], p[1], p[2]},
+                                     Real3{p[3], p[4], p[5]}));
+            default:
+                CELER_ASSERT_UNREACHABLE();
+        }
+    };
+
+    // Select energy distribution
+    const auto& p = opts.energy.params;
+    switch (opts.energy.distribution)
+    {
+        case DS::delta:
+            CELER_ASSERT(p.size() == 1);
+            return visit_pos(DeltaDistribution<real_type>(p[0]));
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with counts, shared particle data, and distributions.
+ */
+template<class ED, class PD, class DD>
+PrimaryBatchGenerator<ED, PD, DD>::PrimaryBatchGenerator(
+    SPConstParticles particles,
+    const Input&     inp,
+    ED               sample_energy,
+    PD               sample_pos,
+    DD               sample_dir)
+    : num_events_(inp.num_events)
+    , primaries_per_event_(inp.primaries_per_event)
+    , sample_energy_(std::move(sample_energy))
+    , sample_pos_(std::move(sample_pos))
+    , sample_dir_(std::move(sample_dir))
+{
+    CELER_EXPECT(particles);
+    CELER_EXPECT(!inp.pdg.empty());
+    CELER_EXPECT(inp.primaries_per_event > 0);
+
+    particle_id_.reserve(inp.pdg.size());
+    for (const auto& pdg : inp.pdg)
+    {
+        particle_id_.push_back(particles->find(pdg));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate primaries into the given storage.
+ *
+ * The return value is the number of primaries written to the front of the
+ * buffer.
+ */
+template<class ED, class PD, class DD>
+template<class Engine>
+size_type
+PrimaryBatchGenerator<ED, PD, DD>::operator()(Engine&       rng,
+                                              Span<Primary> primaries)
+{
+    const size_type count = std::min<size_type>(primaries.size(),
+                                                this->num_remaining());
+
+    // Event and track IDs are derived from the running primary count
+    size_type event   = primary_count_ / primaries_per_event_;
+    size_type track   = primary_count_ % primaries_per_event_;
+    size_type species = primary_count_ % particle_id_.size();
+    for (Primary& p : primaries.first(count))
+    {
+        p.particle_id = particle_id_[species];
+        p.energy      = units::MevEnergy{sample_energy_(rng)};
+        p.position    = sample_pos_(rng);
+        p.direction   = sample_dir_(rng);
+        p.time        = 0;
+        p.event_id    = EventId{event};
+        p.track_id    = TrackId{track};
+
+        if (++species == particle_id_.size())
+        {
+            species = 0;
+        }
+        if (++track == primaries_per_event_)
+        {
+            track = 0;
+            ++event;
+        }
+    }
+    primary_count_ += count;
+    return count;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "ProcessBuilder.hh"
 
+#include <algorithm>
+#include <vector>
+
+#include "celeritas/em/NativeEmTableBuilder.hh"
 #include "celeritas/em/process/BremsstrahlungProcess.hh"
 #include "celeritas/em/process/ComptonProcess.hh"
 #include "celeritas/em/process/EIonizationProcess.hh"
@@ -58,6 +62,7 @@ ProcessBuilder::ProcessBuilder(const ImportData& data,
     : particle_(std::move(particle))
     , material_(std::move(material))
     , brem_combined_(options.brem_combined)
+    , msc_step_limit_(options.msc_step_limit)
     , enable_lpm_(
           import_em_parameter(data.em_params, ImportEmParameter::lpm, true))
     , use_integral_xs_(import_em_parameter(
@@ -66,7 +71,34 @@ ProcessBuilder::ProcessBuilder(const ImportData& data,
     CELER_EXPECT(particle_);
     CELER_EXPECT(material_);
 
-    processes_ = std::make_shared<ImportedProcesses>(data.processes);
+    if (!options.native_em_tables)
+    {
+        processes_ = std::make_shared<ImportedProcesses>(data.processes);
+        return;
+    }
+
+    // Replace imported tables with natively generated ones where possible
+    NativeEmTableBuilder            build_tables(particle_, material_);
+    std::vector<ImportProcess>      processes;
+    std::vector<ImportProcessClass> native;
+    for (const ImportProcess& ip : data.processes)
+    {
+        if (NativeEmTableBuilder::is_supported(ip.process_class))
+        {
+            native.push_back(ip.process_class);
+        }
+        else
+        {
+            processes.push_back(ip);
+        }
+    }
+    std::sort(native.begin(), native.end());
+    native.erase(std::unique(native.begin(), native.end()), native.end());
+    for (ImportProcessClass ipc : native)
+    {
+        processes.push_back(build_tables(ipc));
+    }
+    processes_ = std::make_shared<ImportedProcesses>(std::move(processes));
 }
 
 //---------------------------------------------------------------------------//
@@ -105,8 +137,12 @@ auto ProcessBuilder::operator()(ImportProcessClass ipc) -> SPProcess
 //---------------------------------------------------------------------------//
 auto ProcessBuilder::build_msc() -> SPProcess
 {
+    MultipleScatteringProcess::Options options;
+    options.electron_step_limit = msc_step_limit_;
+    options.positron_step_limit = msc_step_limit_;
+
     return std::make_shared<MultipleScatteringProcess>(
-        particle_, material_, processes_);
+        particle_, material_, processes_, options);
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas/Types.hh"
 #include "celeritas/io/ImportProcess.hh"
 
 #include "Process.hh"
@@ -39,6 +40,10 @@ class ProcessBuilder
     struct Options
     {
         bool brem_combined{false};
+        //! Generate supported tables natively instead of using imported ones
+        bool native_em_tables{false};
+        //! Electron and positron MSC step limitation algorithm
+        MscStepLimitAlgorithm msc_step_limit{MscStepLimitAlgorithm::safety};
     };
 
   public:
@@ -61,6 +66,7 @@ class ProcessBuilder
     std::shared_ptr<const MaterialParams> material_;
     std::shared_ptr<ImportedProcesses>    processes_;
     bool                                  brem_combined_;
+    MscStepLimitAlgorithm                 msc_step_limit_;
     bool                                  enable_lpm_;
     bool                                  use_integral_xs_;
 
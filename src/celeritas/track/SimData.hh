@@ -34,6 +34,7 @@ struct SimTrackState
 
     TrackStatus status{TrackStatus::inactive};
     StepLimit   step_limit;
+    real_type   field_step{0}; //!< Field integration step estimate
 };
 
 using SimTrackInitializer = SimTrackState;
@@ -61,6 +61,9 @@ class SimTrackView
     // Limit the step by this distance and action
     inline CELER_FUNCTION bool step_limit(const StepLimit& sl);
 
+    // Save the field integration step estimate for the next step
+    inline CELER_FUNCTION void field_step(real_type step);
+
     //// DYNAMIC PROPERTIES ////
 
     // Unique track identifier
@@ -84,6 +87,9 @@ class SimTrackView
     // Limiting step and action to take
     CELER_FORCEINLINE_FUNCTION const StepLimit& step_limit() const;
 
+    // Field integration step estimate from the previous step (zero if unset)
+    CELER_FORCEINLINE_FUNCTION real_type field_step() const;
+
   private:
     const SimStateRef& states_;
     const ThreadId     thread_;
@@ -206,6 +212,16 @@ CELER_FUNCTION bool SimTrackView::step_limit(const StepLimit& sl)
     return is_limiting;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Save the field integration step estimate for the next step.
+ */
+CELER_FUNCTION void SimTrackView::field_step(real_type step)
+{
+    CELER_EXPECT(step >= 0);
+    states_.state[thread_].field_step = step;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Set whether the track is active, dying, or inactive.
@@ -281,5 +297,16 @@ CELER_FUNCTION const StepLimit& SimTrackView::step_limit() const
     return states_.state[thread_].step_limit;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Field integration step estimate from the previous step.
+ *
+ * This is zero for a new track.
+ */
+CELER_FUNCTION real_type SimTrackView::field_step() const
+{
+    return states_.state[thread_].field_step;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -27,7 +27,8 @@ namespace celeritas
  * There is no persistent data needed on device. Primaries are copied to device
  * only when they are needed to initialize new tracks and are not stored on
  * device. \c capacity is only used at construction to allocate memory
- * for track initializers and parent track IDs.
+ * for track initializers and parent track IDs, and \c policy is copied to the
+ * state.
  */
 template<Ownership W, MemSpace M>
 struct TrackInitParamsData;
@@ -57,8 +58,9 @@ struct TrackInitParamsData<W, MemSpace::host>
 
     //// DATA ////
 
-    Items<Primary> primaries;   //!< Primary particles
-    size_type      capacity{0}; //!< Initializer/parent storage per track
+    Items<Primary>  primaries;   //!< Primary particles
+    size_type       capacity{0}; //!< Initializer/parent storage per track
+    TrackInitPolicy policy{TrackInitPolicy::lifo}; //!< Vacancy filling order
 
     //// METHODS ////
 
@@ -74,6 +76,7 @@ struct TrackInitParamsData<W, MemSpace::host>
     {
         primaries = other.primaries;
         capacity  = other.capacity;
+        policy    = other.policy;
         return *this;
     }
 };
@@ -173,6 +176,11 @@ struct ResizableData
  * - \c track_counters stores the total number of particles that have been
  *   created per event.
  * - \c secondary_counts stores the number of secondaries created by each track
+ * - \c policy determines which initializers fill the vacancies when there
+ *   are more initializers than vacancies
+ * - \c scratch_indices, \c scratch_initializers, and \c scratch_parents
+ *   are scratch space with size \c capacity for reordering the initializers;
+ *   they are only allocated when the policy is not LIFO.
  */
 template<Ownership W, MemSpace M>
 struct TrackInitStateData
@@ -185,6 +193,8 @@ struct TrackInitStateData
     using ResizableItems = ResizableData<T, W, M>;
     template<class T>
     using StateItems = StateCollection<T, W, M>;
+    template<class T>
+    using Items = Collection<T, W, M>;
 
     //// DATA ////
 
@@ -197,6 +207,12 @@ struct TrackInitStateData
     size_type num_primaries{};   //!< Number of uninitialized primaries
     size_type num_secondaries{}; //!< Number of secondaries produced in step
 
+    TrackInitPolicy policy{TrackInitPolicy::lifo}; //!< Vacancy filling order
+
+    Items<size_type>        scratch_indices;
+    Items<TrackInitializer> scratch_initializers;
+    Items<ThreadId>         scratch_parents;
+
     //// METHODS ////
 
     //! Whether the data are assigned
@@ -211,13 +227,17 @@ struct TrackInitStateData
     TrackInitStateData& operator=(TrackInitStateData<W2, M2>& other)
     {
         CELER_EXPECT(other);
-        initializers     = other.initializers;
-        parents          = other.parents;
-        vacancies        = other.vacancies;
-        secondary_counts = other.secondary_counts;
-        track_counters   = other.track_counters;
-        num_primaries    = other.num_primaries;
-        num_secondaries  = other.num_secondaries;
+        initializers         = other.initializers;
+        parents              = other.parents;
+        vacancies            = other.vacancies;
+        secondary_counts     = other.secondary_counts;
+        track_counters       = other.track_counters;
+        num_primaries        = other.num_primaries;
+        num_secondaries      = other.num_secondaries;
+        policy               = other.policy;
+        scratch_indices      = other.scratch_indices;
+        scratch_initializers = other.scratch_initializers;
+        scratch_parents      = other.scratch_parents;
         return *this;
     }
 };
@@ -225,6 +245,40 @@ struct TrackInitStateData
 using TrackInitStateDeviceRef = DeviceRef<TrackInitStateData>;
 using TrackInitStateHostRef   = HostRef<TrackInitStateData>;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize the per-track data and mark the trailing track slots as empty.
+ *
+ * The track initializers and event counters are unchanged. This is used when
+ * the track state vector is reallocated with the first \c num_occupied slots
+ * holding the tracks that are still alive, so the parents of any queued
+ * initializers are discarded.
+ */
+template<MemSpace M>
+void resize_track_slots(TrackInitStateData<Ownership::value, M>* data,
+                        size_type                                size,
+                        size_type num_occupied = 0)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(size > 0 && num_occupied <= size);
+
+    data->parents          = {};
+    data->secondary_counts = {};
+    resize(&data->parents, size);
+    resize(&data->secondary_counts, size);
+    data->num_secondaries = 0;
+
+    // Initialize vacancies to mark the unoccupied track slots as empty
+    StateCollection<size_type, Ownership::value, MemSpace::host> vacancies;
+    resize(&vacancies, size);
+    for (auto i : range(size - num_occupied))
+    {
+        vacancies[ThreadId{i}] = num_occupied + i;
+    }
+    data->vacancies.storage = vacancies;
+    data->vacancies.resize(size - num_occupied);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Resize and initialize track initializer data.
@@ -248,21 +302,12 @@ void resize(TrackInitStateData<Ownership::value, M>* data,
     // Allocate device data
     auto capacity = params.capacity;
     resize(&data->initializers.storage, capacity);
-    resize(&data->parents, size);
-    resize(&data->secondary_counts, size);
 
     // Start with an empty vector of track initializers
     data->initializers.resize(0);
 
-    // Initialize vacancies to mark all track slots as empty
-    StateCollection<size_type, Ownership::value, MemSpace::host> vacancies;
-    resize(&vacancies, size);
-    for (auto i : range(size))
-    {
-        vacancies[ThreadId{i}] = i;
-    }
-    data->vacancies.storage = vacancies;
-    data->vacancies.resize(size);
+    // Allocate per-track data and mark all track slots as empty
+    resize_track_slots(data, size);
 
     // Initialize the track counter for each event as the number of primary
     // particles in that event
@@ -281,6 +326,15 @@ void resize(TrackInitStateData<Ownership::value, M>* data,
     make_builder(&track_counters).insert_back(counters.begin(), counters.end());
     data->track_counters = track_counters;
     data->num_primaries  = params.primaries.size();
+    data->policy         = params.policy;
+
+    if (data->policy != TrackInitPolicy::lifo)
+    {
+        // Allocate scratch space for selecting initializers
+        resize(&data->scratch_indices, capacity);
+        resize(&data->scratch_initializers, capacity);
+        resize(&data->scratch_parents, capacity);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -41,6 +41,7 @@ class TrackInitParams
     {
         std::vector<Primary> primaries;
         size_type            capacity; //!< Max number of initializers
+        TrackInitPolicy      policy{TrackInitPolicy::lifo};
     };
 
   public:
@@ -72,6 +72,11 @@ inline void extend_from_primaries(const TrackInitParamsHostRef& params,
  * state copied over from the parent instead of initialized from the position.
  * If there are more empty slots than new secondaries, they will be filled by
  * any track initializers remaining from previous steps using the position.
+ *
+ * If there are fewer empty slots than initializers, the scheduling policy
+ * determines which initializers become tracks. With any policy other than
+ * LIFO the initializers are first reordered, and only the selected
+ * secondaries from this step can still copy their parent's geometry state.
  */
 template<MemSpace M>
 inline void initialize_tracks(const CoreRef<M>& core_data,
@@ -86,6 +91,21 @@ inline void initialize_tracks(const CoreRef<M>& core_data,
         = std::min(data->vacancies.size(), data->initializers.size());
     if (num_tracks > 0)
     {
+        if (data->policy != TrackInitPolicy::lifo
+            && num_tracks < data->initializers.size())
+        {
+            // Move the initializers with the highest priority to the back
+            data->num_secondaries = detail::reorder_initializers<M>(
+                data->policy,
+                num_tracks,
+                data->initializers.data(),
+                data->parents[AllItems<ThreadId, M>{}],
+                data->num_secondaries,
+                {data->scratch_indices[AllItems<size_type, M>{}],
+                 data->scratch_initializers[AllItems<TrackInitializer, M>{}],
+                 data->scratch_parents[AllItems<ThreadId, M>{}]});
+        }
+
         // Launch a kernel to initialize tracks on device
         auto num_vacancies
             = min(data->vacancies.size(), data->initializers.size());
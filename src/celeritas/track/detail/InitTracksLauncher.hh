@@ -99,12 +99,17 @@ CELER_FUNCTION void InitTracksLauncher<M>::operator()(ThreadId tid) const
     // Initialize the geometry
     {
         GeoTrackView geo(params_.geometry, states_.geometry, vac_id);
+        ThreadId     parent_id;
         if (tid < data_.num_secondaries)
+        {
+            // Parent is invalid if the initializers were reordered and this
+            // one was not created in the last step
+            parent_id = data_.parents[from_back(data_.parents.size(), tid)];
+        }
+        if (parent_id)
         {
             // Copy the geometry state from the parent for improved
             // performance
-            ThreadId parent_id
-                = data_.parents[from_back(data_.parents.size(), tid)];
             GeoTrackView parent(params_.geometry, states_.geometry, parent_id);
             geo = GeoTrackView::DetailedInitializer{parent, init.geo.dir};
         }
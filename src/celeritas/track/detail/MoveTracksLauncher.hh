@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/MoveTracksLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/mat/MaterialTrackView.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+#include "celeritas/phys/PhysicsTrackView.hh"
+
+#include "../SimTrackView.hh"
+#include "../TrackInitData.hh"
+#include "Utils.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Move the alive tracks to the front of another state vector.
+ *
+ * This is used to reallocate the track states between steps. It must be
+ * called after the vacancies have been located at the end of a step, so that
+ * the non-vacant slots are exactly the alive tracks. They are moved in order
+ * of thread ID to the leading slots of the destination states.
+ *
+ * The geometry state is copied from the source slot (so that tracks on a
+ * boundary are preserved), as is the number of mean free paths to the next
+ * discrete interaction. Other physics state is recalculated at the next step.
+ */
+template<MemSpace M>
+class MoveTracksLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef         = CoreParamsData<Ownership::const_reference, M>;
+    using StateRef          = CoreStateData<Ownership::reference, M>;
+    using TrackInitStateRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared, source, destination, and initializer data
+    CELER_FUNCTION MoveTracksLauncher(const CoreRef<M>&        core_data,
+                                      const StateRef&          dst_states,
+                                      const TrackInitStateRef& init_data)
+        : params_(core_data.params)
+        , states_(core_data.states)
+        , dst_states_(dst_states)
+        , data_(init_data)
+    {
+        CELER_EXPECT(params_);
+        CELER_EXPECT(states_);
+        CELER_EXPECT(dst_states_);
+        CELER_EXPECT(data_);
+    }
+
+    // Move a single alive track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef&         params_;
+    const StateRef&          states_;
+    const StateRef&          dst_states_;
+    const TrackInitStateRef& data_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move a single alive track.
+ */
+template<MemSpace M>
+CELER_FUNCTION void MoveTracksLauncher<M>::operator()(ThreadId tid) const
+{
+    SimTrackView sim(states_.sim, tid);
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    // The vacancies are sorted, so the destination is the thread ID minus the
+    // number of empty slots before it
+    const size_type num_vacancies = data_.vacancies.size();
+    size_type       num_empty     = 0;
+    if (num_vacancies > 0)
+    {
+        const size_type* first = &data_.vacancies[ThreadId{0}];
+        num_empty = celeritas::lower_bound(
+                        first, first + num_vacancies, tid.get())
+                    - first;
+    }
+    const ThreadId dst_id{tid.get() - num_empty};
+    CELER_ASSERT(dst_id < dst_states_.size());
+
+    // Copy the simulation state
+    {
+        SimTrackView dst_sim(dst_states_.sim, dst_id);
+        dst_sim = states_.sim.state[tid];
+    }
+
+    // Copy the particle state
+    {
+        ParticleTrackView particle(params_.particles, states_.particles, tid);
+        ParticleTrackView dst_particle(
+            params_.particles, dst_states_.particles, dst_id);
+        dst_particle = {particle.particle_id(), particle.energy()};
+    }
+
+    // Copy the geometry and material
+    {
+        GeoTrackView geo(params_.geometry, states_.geometry, tid);
+        GeoTrackView dst_geo(params_.geometry, dst_states_.geometry, dst_id);
+        dst_geo = GeoTrackView::DetailedInitializer{geo, geo.dir()};
+
+        MaterialTrackView mat(params_.materials, states_.materials, tid);
+        MaterialTrackView dst_mat(
+            params_.materials, dst_states_.materials, dst_id);
+        dst_mat = {mat.material_id()};
+    }
+
+    // Reset the physics state but keep the sampled interaction length
+    {
+        PhysicsTrackView phys(params_.physics, states_.physics, {}, {}, tid);
+        PhysicsTrackView dst_phys(
+            params_.physics, dst_states_.physics, {}, {}, dst_id);
+        dst_phys = {};
+        if (phys.has_interaction_mfp())
+        {
+            dst_phys.interaction_mfp(phys.interaction_mfp());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
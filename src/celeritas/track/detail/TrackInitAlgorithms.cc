@@ -8,7 +8,11 @@
 #include "TrackInitAlgorithms.hh"
 
 #include <algorithm>
+#include <numeric>
 
+#include "corecel/cont/Range.hh"
+
+#include "../TrackInitData.hh"
 #include "Utils.hh"
 
 namespace celeritas
@@ -56,6 +60,84 @@ size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts)
     return acc;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move the track initializers with the highest priority to the back.
+ *
+ * Vacancies are filled from the back of the initializer vector, so this
+ * selects which \c count initializers become tracks in the next step. Both
+ * the selected and the remaining initializers keep their relative order, so
+ * that the position in the vector still reflects when each was created.
+ *
+ * The parents of the last \c num_secondaries initializers (those created in
+ * the previous step) are permuted along with them: the return value is the
+ * new number of initializers at the back whose parent slot is stored, with
+ * invalid parent IDs for initializers that must be initialized from their
+ * position.
+ *
+ * The scratch space must be at least as large as the initializer vector, so
+ * that no memory is allocated during a step. With the FIFO policy the
+ * selected initializers are the oldest ones, so no selection is needed.
+ */
+template<>
+size_type
+reorder_initializers<MemSpace::host>(TrackInitPolicy        policy,
+                                     size_type              count,
+                                     Span<TrackInitializer> inits,
+                                     Span<ThreadId>         parents,
+                                     size_type              num_secondaries,
+                                     const ReorderScratch&  scratch)
+{
+    const size_type size = inits.size();
+    CELER_EXPECT(count > 0 && count <= size && count <= parents.size());
+    CELER_EXPECT(scratch.indices.size() >= size
+                 && scratch.initializers.size() >= size
+                 && scratch.parents.size() >= count);
+
+    // Find the lowest-priority initializer that will be selected
+    LowerInitPriority lower_priority{policy, inits};
+    size_type         threshold = count - 1;
+    if (policy != TrackInitPolicy::fifo)
+    {
+        auto indices = scratch.indices.first(size);
+        std::iota(indices.begin(), indices.end(), size_type(0));
+        std::nth_element(indices.begin(),
+                         indices.begin() + (size - count),
+                         indices.end(),
+                         lower_priority);
+        threshold = indices[size - count];
+    }
+
+    // Order the remaining initializers before the selected ones, saving the
+    // parents of selected initializers created in the previous step
+    const size_type num_parents
+        = std::min({num_secondaries, size, size_type(parents.size())});
+    size_type num_unselected = 0;
+    size_type num_selected   = 0;
+    for (auto i : range(size))
+    {
+        if (lower_priority(i, threshold))
+        {
+            scratch.initializers[num_unselected++] = inits[i];
+            continue;
+        }
+        scratch.initializers[size - count + num_selected] = inits[i];
+        scratch.parents[num_selected++]
+            = i + num_parents >= size ? parents[parents.size() - (size - i)]
+                                      : ThreadId{};
+    }
+    CELER_ASSERT(num_selected == count);
+
+    // Copy back the initializers and the parents of the selected ones
+    std::copy(scratch.initializers.begin(),
+              scratch.initializers.begin() + size,
+              inits.begin());
+    std::copy(scratch.parents.begin(),
+              scratch.parents.begin() + count,
+              parents.end() - count);
+    return count;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -7,19 +7,61 @@
 //---------------------------------------------------------------------------//
 #include "TrackInitAlgorithms.hh"
 
+#include <thrust/copy.h>
 #include <thrust/device_ptr.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 
 #include "corecel/Macros.hh"
 #include "corecel/data/Copier.hh"
+#include "corecel/math/Algorithms.hh"
 
+#include "../TrackInitData.hh"
 #include "Utils.hh"
 
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Whether an initializer is not selected to fill a vacancy
+struct IsUnselected
+{
+    LowerInitPriority lower_priority;
+    const size_type*  threshold;
+
+    CELER_FUNCTION bool operator()(size_type i) const
+    {
+        return lower_priority(i, *threshold);
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Parent of an initializer if it was created in the previous step
+struct InitializerParent
+{
+    const ThreadId* parents_end;
+    size_type       size;
+    size_type       num_parents;
+
+    CELER_FUNCTION ThreadId operator()(size_type i) const
+    {
+        return i + num_parents >= size ? *(parents_end - (size - i))
+                                       : ThreadId{};
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Remove all elements in the vacancy vector that were flagged as active
@@ -73,6 +115,86 @@ size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
     return partial1 + partial2;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move the track initializers with the highest priority to the back.
+ *
+ * See the host implementation for details. Thrust has no selection
+ * algorithm, so the lowest-energy and event policies sort the indices to
+ * find the threshold; it is read on device so that the host never waits on
+ * it. The FIFO policy only rotates the initializers.
+ */
+template<>
+size_type
+reorder_initializers<MemSpace::device>(TrackInitPolicy        policy,
+                                       size_type              count,
+                                       Span<TrackInitializer> inits,
+                                       Span<ThreadId>         parents,
+                                       size_type              num_secondaries,
+                                       const ReorderScratch&  scratch)
+{
+    const size_type size = inits.size();
+    CELER_EXPECT(count > 0 && count <= size && count <= parents.size());
+    CELER_EXPECT(scratch.indices.size() >= size
+                 && scratch.initializers.size() >= size
+                 && scratch.parents.size() >= count);
+
+    const size_type num_parents
+        = min(min(num_secondaries, size), size_type(parents.size()));
+    auto init_parent = thrust::make_transform_iterator(
+        thrust::counting_iterator<size_type>(0),
+        InitializerParent{parents.data() + parents.size(), size, num_parents});
+    auto inits_begin = thrust::device_pointer_cast(inits.data());
+    auto temp_begin  = thrust::device_pointer_cast(scratch.initializers.data());
+    auto temp_parents_begin
+        = thrust::device_pointer_cast(scratch.parents.data());
+
+    if (policy == TrackInitPolicy::fifo)
+    {
+        // Move the oldest initializers to the back
+        thrust::copy(inits_begin + count, inits_begin + size, temp_begin);
+        thrust::copy(
+            inits_begin, inits_begin + count, temp_begin + size - count);
+        thrust::copy(init_parent, init_parent + count, temp_parents_begin);
+    }
+    else
+    {
+        // Find the lowest-priority initializer that will be selected
+        LowerInitPriority lower_priority{policy, inits};
+        auto idx_begin = thrust::device_pointer_cast(scratch.indices.data());
+        thrust::sequence(idx_begin, idx_begin + size, size_type(0));
+        thrust::sort(idx_begin, idx_begin + size, lower_priority);
+        IsUnselected is_unselected{lower_priority,
+                                   scratch.indices.data() + size - count};
+
+        // Order the remaining initializers before the selected ones, saving
+        // the parents of selected initializers created in the previous step
+        thrust::counting_iterator<size_type> stencil(0);
+        thrust::stable_partition_copy(inits_begin,
+                                      inits_begin + size,
+                                      stencil,
+                                      temp_begin,
+                                      temp_begin + size - count,
+                                      is_unselected);
+        thrust::stable_partition_copy(init_parent,
+                                      init_parent + size,
+                                      stencil,
+                                      thrust::make_discard_iterator(),
+                                      temp_parents_begin,
+                                      is_unselected);
+    }
+
+    // Copy back the initializers and the parents of the selected ones
+    thrust::copy(temp_begin, temp_begin + size, inits_begin);
+    thrust::copy(temp_parents_begin,
+                 temp_parents_begin + count,
+                 thrust::device_pointer_cast(parents.data()) + parents.size()
+                     - count);
+    CELER_DEVICE_CHECK_ERROR();
+
+    return count;
+}
+
 //---------------------------------------------------------------------------//
 #undef LAUNCH_KERNEL
 } // namespace detail
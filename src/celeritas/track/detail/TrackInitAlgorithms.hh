@@ -9,11 +9,16 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
+#include "corecel/OpaqueId.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
 
 namespace celeritas
 {
+struct TrackInitializer;
+
 namespace detail
 {
 //---------------------------------------------------------------------------//
@@ -36,6 +41,40 @@ size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts);
 template<>
 size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts);
 
+//---------------------------------------------------------------------------//
+// Preallocated space for reordering track initializers
+struct ReorderScratch
+{
+    Span<size_type>        indices;
+    Span<TrackInitializer> initializers;
+    Span<ThreadId>         parents;
+};
+
+//---------------------------------------------------------------------------//
+// Move the track initializers with the highest priority to the back
+template<MemSpace M>
+size_type reorder_initializers(TrackInitPolicy        policy,
+                               size_type              count,
+                               Span<TrackInitializer> inits,
+                               Span<ThreadId>         parents,
+                               size_type              num_secondaries,
+                               const ReorderScratch&  scratch);
+
+template<>
+size_type reorder_initializers<MemSpace::host>(TrackInitPolicy,
+                                               size_type,
+                                               Span<TrackInitializer>,
+                                               Span<ThreadId>,
+                                               size_type,
+                                               const ReorderScratch&);
+template<>
+size_type reorder_initializers<MemSpace::device>(TrackInitPolicy,
+                                                 size_type,
+                                                 Span<TrackInitializer>,
+                                                 Span<ThreadId>,
+                                                 size_type,
+                                                 const ReorderScratch&);
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -52,6 +91,17 @@ inline size_type exclusive_scan_counts<MemSpace::device>(Span<size_type>)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+template<>
+inline size_type reorder_initializers<MemSpace::device>(TrackInitPolicy,
+                                                        size_type,
+                                                        Span<TrackInitializer>,
+                                                        Span<ThreadId>,
+                                                        size_type,
+                                                        const ReorderScratch&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 #endif
 //---------------------------------------------------------------------------//
 } // namespace detail
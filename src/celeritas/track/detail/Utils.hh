@@ -10,8 +10,12 @@
 #include "corecel/Assert.hh"
 #include "corecel/OpaqueId.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/math/NumericLimits.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+
+#include "../TrackInitData.hh"
 
 namespace celeritas
 {
@@ -40,6 +44,51 @@ CELER_FORCEINLINE_FUNCTION ThreadId from_back(size_type size, ThreadId tid)
     return ThreadId{size - tid.get() - 1};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compare the scheduling priority of two track initializers.
+ *
+ * The arguments are indices into the vector of initializers, and the result
+ * is true if the first should fill a vacancy \em after the second. Ties are
+ * broken by position so that more recently created initializers (which may
+ * still be able to copy their parent's geometry state) are preferred.
+ */
+struct LowerInitPriority
+{
+    TrackInitPolicy              policy;
+    Span<const TrackInitializer> inits;
+
+    CELER_FUNCTION bool operator()(size_type a, size_type b) const
+    {
+        switch (policy)
+        {
+            case TrackInitPolicy::fifo:
+                return a > b;
+            case TrackInitPolicy::lowest_energy: {
+                auto ea = inits[a].particle.energy.value();
+                auto eb = inits[b].particle.energy.value();
+                if (ea != eb)
+                {
+                    return ea > eb;
+                }
+                break;
+            }
+            case TrackInitPolicy::event: {
+                auto ea = inits[a].sim.event_id.unchecked_get();
+                auto eb = inits[b].sim.event_id.unchecked_get();
+                if (ea != eb)
+                {
+                    return ea > eb;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        return a < b;
+    }
+};
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
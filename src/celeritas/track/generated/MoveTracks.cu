@@ -0,0 +1,48 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/generated/MoveTracks.cu
+//! \note Auto-generated by gen-trackinit.py: DO NOT MODIFY!
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/MoveTracksLauncher.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "corecel/sys/Device.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+namespace
+{
+__global__ void move_tracks_kernel(
+    const CoreDeviceRef core_data,
+    const CoreStateDeviceRef dst_states,
+    const TrackInitStateDeviceRef init_data)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < core_data.states.size()))
+        return;
+
+    detail::MoveTracksLauncher<MemSpace::device> launch(core_data, dst_states, init_data);
+    launch(tid);
+}
+} // namespace
+
+void move_tracks(
+    const CoreDeviceRef& core_data,
+    const CoreStateDeviceRef& dst_states,
+    const TrackInitStateDeviceRef& init_data)
+{
+    CELER_LAUNCH_KERNEL(
+        move_tracks,
+        celeritas::device().default_block_size(),
+        core_data.states.size(),
+        core_data, dst_states, init_data);
+}
+
+} // namespace generated
+} // namespace celeritas
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/track/detail/MoveTracksLauncher.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/track/TrackInitData.hh"
+
+namespace celeritas
+{
+namespace generated
+{
+
+void move_tracks(
+    const CoreHostRef& core_data,
+    const CoreStateHostRef& dst_states,
+    const TrackInitStateHostRef& init_data);
+
+void move_tracks(
+    const CoreDeviceRef& core_data,
+    const CoreStateDeviceRef& dst_states,
+    const TrackInitStateDeviceRef& init_data);
+
+#if !CELER_USE_DEVICE
+inline void move_tracks(const CoreDeviceRef&, const CoreStateDeviceRef&, const TrackInitStateDeviceRef&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+} // namespace generated
+} // namespace celeritas
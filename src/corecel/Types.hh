@@ -22,8 +22,13 @@ using size_type = unsigned int;
 using size_type = std::size_t;
 #endif
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
 //! Numerical type for real numbers
 using real_type = double;
+#elif CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_FLOAT
+//! Numerical type for real numbers (reduced precision)
+using real_type = float;
+#endif
 
 //! Equivalent to std::size_t but compatible with CUDA atomics
 using ull_int = unsigned long long int;
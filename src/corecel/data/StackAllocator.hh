@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <algorithm>
 #include <new>
 
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/Atomics.hh"
+#include "corecel/sys/HostThread.hh"
 
 #include "StackAllocatorData.hh"
 
@@ -89,6 +92,13 @@ namespace celeritas
  * These separate kernel launches are needed as grid-level synchronization
  * points.
  *
+ * On host, every thread adding to the shared size contends for the same cache
+ * line. If the data was built with a nonzero chunk size, each host thread
+ * instead reserves a chunk of storage at a time and allocates from it without
+ * atomics. The allocations are then interleaved with unused chunk remainders,
+ * so \c size() is an upper bound until \c compact is called with all the
+ * live allocations.
+ *
  * \todo Instead of returning a pointer, return IdRange<T>. Rename
  * StackAllocatorData to StackAllocation and have it look like a collection so
  * that *it* will provide access to the data. Better yet, have a
@@ -133,6 +143,14 @@ class StackAllocator
     inline CELER_FUNCTION Span<value_type> get();
     inline CELER_FUNCTION Span<const value_type> get() const;
 
+    //// HOST CHUNKS ////
+
+    //! Whether host threads allocate from reserved chunks
+    CELER_FUNCTION bool chunked() const { return !data_.chunks.empty(); }
+
+    // Move the given allocations to the front of the stack
+    inline void compact(Span<Span<value_type>*> allocations);
+
   private:
     const Data& data_;
 
@@ -140,7 +158,20 @@ class StackAllocator
 
     using SizeId    = ItemId<size_type>;
     using StorageId = ItemId<T>;
+    using ChunkId   = ItemId<StackAllocatorChunk>;
     static CELER_CONSTEXPR_FUNCTION SizeId size_id() { return SizeId{0}; }
+
+    // Sentinel for a failed reservation
+    static CELER_CONSTEXPR_FUNCTION size_type no_space()
+    {
+        return static_cast<size_type>(-1);
+    }
+
+    // Reserve space from the shared size
+    inline CELER_FUNCTION size_type reserve(size_type count);
+
+    // Reserve space from the calling thread's chunk
+    inline size_type reserve_chunked(size_type count);
 };
 
 //---------------------------------------------------------------------------//
@@ -180,6 +211,12 @@ template<class T>
 CELER_FUNCTION void StackAllocator<T>::clear()
 {
     data_.size[this->size_id()] = 0;
+#if !CELER_DEVICE_COMPILE
+    for (size_type i = 0; i < data_.chunks.size(); ++i)
+    {
+        data_.chunks[ChunkId{i}] = {};
+    }
+#endif
 }
 
 //---------------------------------------------------------------------------//
@@ -195,26 +232,14 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
 {
     CELER_EXPECT(count > 0);
 
-    // Atomic add 'count' to the shared size
-    size_type start = atomic_add(&data_.size[this->size_id()], count);
-    if (CELER_UNLIKELY(start + count > data_.storage.size()))
+#if !CELER_DEVICE_COMPILE
+    size_type start = this->chunked() ? this->reserve_chunked(count)
+                                      : this->reserve(count);
+#else
+    size_type start = this->reserve(count);
+#endif
+    if (CELER_UNLIKELY(start == this->no_space()))
     {
-        // Out of memory: restore the old value so that another thread can
-        // potentially use it. Multiple threads are likely to exceed the
-        // capacity simultaneously. Only one has a "start" value less than or
-        // equal to the total capacity: the remainder are (arbitrarily) higher
-        // than that.
-        if (start <= this->capacity())
-        {
-            // We were the first thread to exceed capacity, even though other
-            // threads might have failed (and might still be failing) to
-            // allocate. Restore the actual allocated size to the start value.
-            // This might allow another thread with a smaller allocation to
-            // succeed, but it also guarantees that at the end of the kernel,
-            // the size reflects the actual capacity.
-            data_.size[this->size_id()] = start;
-        }
-
         // TODO It might be useful to set an "out of memory" flag to make it
         // easier for host code to detect whether a failure occurred, rather
         // than looping through primaries and testing for failure.
@@ -272,5 +297,118 @@ CELER_FUNCTION auto StackAllocator<T>::get() const -> Span<const value_type>
     return data_.storage[ItemRange<T>{StorageId{0}, StorageId{this->size()}}];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move the given allocations to the front of the stack.
+ *
+ * This must be called on host with *every* live allocation after all threads
+ * have finished allocating. The allocations are moved (preserving their order
+ * in the stack) so that they are contiguous, and the spans are updated to
+ * point to the new locations. The size afterward is the total number of
+ * allocated elements, and the thread chunks are emptied.
+ */
+template<class T>
+void StackAllocator<T>::compact(Span<Span<value_type>*> allocations)
+{
+    std::sort(allocations.begin(),
+              allocations.end(),
+              [](const Span<value_type>* a, const Span<value_type>* b) {
+                  return a->data() < b->data();
+              });
+
+    value_type* const first = &data_.storage[StorageId{0}];
+    value_type*       dest  = first;
+    for (Span<value_type>* alloc : allocations)
+    {
+        CELER_ASSERT(alloc->data() >= dest
+                     && alloc->data() + alloc->size()
+                            <= first + this->capacity());
+        value_type* moved = dest + alloc->size();
+        if (alloc->data() != dest)
+        {
+            // Moving forward is safe since the destination precedes the
+            // source (std::move forbids a destination inside the source)
+            std::move(alloc->begin(), alloc->end(), dest);
+        }
+        *alloc = {dest, moved};
+        dest   = moved;
+    }
+
+    this->clear();
+    data_.size[this->size_id()] = static_cast<size_type>(dest - first);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reserve space from the shared size.
+ *
+ * Returns \c no_space() if the storage is exhausted.
+ */
+template<class T>
+CELER_FUNCTION size_type StackAllocator<T>::reserve(size_type count)
+{
+    // Atomic add 'count' to the shared size
+    size_type start = atomic_add(&data_.size[this->size_id()], count);
+    if (CELER_UNLIKELY(start + count > data_.storage.size()))
+    {
+        // Out of memory: restore the old value so that another thread can
+        // potentially use it. Multiple threads are likely to exceed the
+        // capacity simultaneously. Only one has a "start" value less than or
+        // equal to the total capacity: the remainder are (arbitrarily) higher
+        // than that.
+        if (start <= this->capacity())
+        {
+            // We were the first thread to exceed capacity, even though other
+            // threads might have failed (and might still be failing) to
+            // allocate. Restore the actual allocated size to the start value.
+            // This might allow another thread with a smaller allocation to
+            // succeed, but it also guarantees that at the end of the kernel,
+            // the size reflects the actual capacity.
+            data_.size[this->size_id()] = start;
+        }
+        return this->no_space();
+    }
+    return start;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reserve space from the calling thread's chunk.
+ *
+ * When the chunk is exhausted, its remainder is abandoned and a new one is
+ * reserved from the shared size. Near the end of the storage, where a full
+ * chunk no longer fits, the exact count is reserved instead.
+ */
+template<class T>
+size_type StackAllocator<T>::reserve_chunked(size_type count)
+{
+    const int thread = host_thread_index();
+    if (CELER_UNLIKELY(thread < 0
+                       || static_cast<size_type>(thread)
+                              >= data_.chunks.size()))
+    {
+        // Nested parallelism or more threads than when the data was built
+        return this->reserve(count);
+    }
+
+    StackAllocatorChunk& chunk
+        = data_.chunks[ChunkId{static_cast<size_type>(thread)}];
+    if (chunk.end - chunk.begin < count)
+    {
+        const size_type chunk_size = celeritas::max(data_.chunk_size, count);
+        size_type       start      = this->reserve(chunk_size);
+        if (start == this->no_space())
+        {
+            return chunk_size > count ? this->reserve(count) : start;
+        }
+        chunk.begin = start;
+        chunk.end   = start + chunk_size;
+    }
+
+    size_type start = chunk.begin;
+    chunk.begin += count;
+    return start;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,8 +7,13 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
+#include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/sys/HostThread.hh"
 
 #include "Collection.hh"
 #include "CollectionAlgorithms.hh"
@@ -16,20 +21,52 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Range of stack storage reserved by a single host thread.
+ *
+ * Each chunk is aligned and padded to a cache line so that threads updating
+ * their own chunks do not write to the same line. Host storage for the
+ * over-aligned type relies on aligned allocation (C++17 or \c -faligned-new ).
+ */
+struct alignas(64) StackAllocatorChunk
+{
+    size_type begin{0}; //!< Next unallocated element
+    size_type end{0};   //!< End of the reserved range
+
+    size_type padding_[64 / sizeof(size_type) - 2];
+};
+
+static_assert(sizeof(StackAllocatorChunk) == 64,
+              "stack allocator chunks must fill one cache line");
+static_assert(alignof(StackAllocatorChunk) == 64,
+              "stack allocator chunks must start on a cache line");
+
 //---------------------------------------------------------------------------//
 /*!
  * Storage for a stack and its dynamic size.
+ *
+ * On host, the stack can optionally be allocated in chunks: each thread
+ * reserves \c chunk_size elements at a time from the shared size and
+ * sub-allocates from them without atomics. The \c chunks collection is empty
+ * if this mode is disabled (always the case on device).
  */
 template<class T, Ownership W, MemSpace M>
 struct StackAllocatorData
 {
-    celeritas::Collection<T, W, M>         storage; //!< Allocated capacity
-    celeritas::Collection<size_type, W, M> size;    //!< Stored size
+    template<class U>
+    using Items = celeritas::Collection<U, W, M>;
+
+    Items<T>                   storage; //!< Allocated capacity
+    Items<size_type>           size;    //!< Stored size
+    Items<StackAllocatorChunk> chunks;  //!< Reserved ranges [thread]
+    size_type                  chunk_size{0}; //!< Elements reserved at once
 
     //! Whether the data is assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !storage.empty() && !size.empty();
+        return !storage.empty() && !size.empty()
+               && chunks.empty() == (chunk_size == 0);
     }
 
     //! Total capacity of stack
@@ -40,8 +77,10 @@ struct StackAllocatorData
     StackAllocatorData& operator=(StackAllocatorData<T, W2, M2>& other)
     {
         CELER_EXPECT(other);
-        storage = other.storage;
-        size    = other.size;
+        storage    = other.storage;
+        size       = other.size;
+        chunks     = other.chunks;
+        chunk_size = other.chunk_size;
         return *this;
     }
 };
@@ -60,5 +99,38 @@ resize(StackAllocatorData<T, Ownership::value, M>* data, size_type capacity)
     celeritas::fill(size_type(0), &data->size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize a stack allocator that reserves chunks on host.
+ *
+ * The chunked mode is only enabled for host memory and when \c chunk_size is
+ * nonzero: one chunk is created for each thread that can run a host parallel
+ * region.
+ */
+template<class T, MemSpace M>
+inline void resize(StackAllocatorData<T, Ownership::value, M>* data,
+                   size_type                                   capacity,
+                   size_type                                   chunk_size)
+{
+    resize(data, capacity);
+    if (M != MemSpace::host || chunk_size == 0)
+    {
+        return;
+    }
+
+    // Initialize empty chunks
+    std::vector<StackAllocatorChunk> chunks(max_host_threads(),
+                                            StackAllocatorChunk{});
+    Collection<StackAllocatorChunk, Ownership::value, MemSpace::host> temp;
+    make_builder(&temp).insert_back(chunks.begin(), chunks.end());
+    CELER_ASSERT(reinterpret_cast<std::uintptr_t>(
+                     temp[AllItems<StackAllocatorChunk, MemSpace::host>{}]
+                         .data())
+                     % alignof(StackAllocatorChunk)
+                 == 0);
+    data->chunks     = std::move(temp);
+    data->chunk_size = chunk_size;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -46,6 +46,7 @@ void BuildOutput::output(JsonPimpl* j) const
 #    undef CO_SAVE_CFG
         cfg["CELERITAS_BUILD_TYPE"] = celeritas_build_type;
         cfg["CELERITAS_RNG"]        = celeritas_rng;
+        cfg["CELERITAS_REAL_TYPE"]  = celeritas_real_type;
         if (CELERITAS_USE_GEANT4)
         {
             cfg["CLHEP_VERSION"]  = celeritas_clhep_version;
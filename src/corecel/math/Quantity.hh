@@ -98,8 +98,12 @@ class Quantity
     {
     }
 
-    //! Construct implicitly from a unitless quantity
-    CELER_CONSTEXPR_FUNCTION Quantity(Unitless uq) : value_(uq.value_) {}
+    //! Construct implicitly from a unitless quantity of any precision
+    template<class T>
+    CELER_CONSTEXPR_FUNCTION Quantity(detail::UnitlessQuantity<T> uq)
+        : value_(uq.value_)
+    {
+    }
 
     //! Get numeric value, discarding units
     CELER_CONSTEXPR_FUNCTION value_type value() const { return value_; }
@@ -117,15 +121,15 @@ class Quantity
     {                                                                \
         return lhs.value() TOKEN rhs.value();                        \
     }                                                                \
-    template<class U, class T>                                       \
+    template<class U, class T, class T2>                             \
     CELER_CONSTEXPR_FUNCTION bool operator TOKEN(                    \
-        Quantity<U, T> lhs, detail::UnitlessQuantity<T> rhs)         \
+        Quantity<U, T> lhs, detail::UnitlessQuantity<T2> rhs)        \
     {                                                                \
         return lhs.value() TOKEN rhs.value_;                         \
     }                                                                \
-    template<class U, class T>                                       \
+    template<class U, class T, class T2>                             \
     CELER_CONSTEXPR_FUNCTION bool operator TOKEN(                    \
-        detail::UnitlessQuantity<T> lhs, Quantity<U, T> rhs)         \
+        detail::UnitlessQuantity<T2> lhs, Quantity<U, T> rhs)        \
     {                                                                \
         return lhs.value_ TOKEN rhs.value();                         \
     }                                                                \
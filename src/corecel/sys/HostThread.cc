@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/HostThread.cc
+//---------------------------------------------------------------------------//
+#include "HostThread.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Maximum number of threads available to a host parallel region.
+ *
+ * These are defined out of line so that inline code (which may be compiled
+ * into translation units without OpenMP flags) sees the same thread layout as
+ * the library's parallel loops.
+ */
+int max_host_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Index of the calling thread in the outermost host parallel region.
+ *
+ * This is zero outside of a parallel region. Parallel loops inside tasks run
+ * in serialized nested regions, where the thread number is always zero, so
+ * the index is taken from the outermost team instead. If nested parallelism
+ * is active, threads are not uniquely identified and the result is -1.
+ */
+int host_thread_index()
+{
+#if CELERITAS_USE_OPENMP
+    if (omp_get_active_level() > 1)
+    {
+        return -1;
+    }
+    return omp_get_level() > 0 ? omp_get_ancestor_thread_num(1) : 0;
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
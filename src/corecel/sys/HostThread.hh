@@ -0,0 +1,21 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/HostThread.hh
+//! \brief Query the OpenMP thread layout from code built without OpenMP
+//---------------------------------------------------------------------------//
+#pragma once
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Maximum number of threads available to a host parallel region
+int max_host_threads();
+
+// Index of the calling thread in the outermost host parallel region
+int host_thread_index();
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,8 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
+#include "celeritas_config.h"
 #include "corecel/OpaqueId.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 
 #include "Types.hh"
@@ -26,13 +30,15 @@ struct OrangeParamsScalars
     static constexpr size_type max_level{1};
 
     size_type max_faces{};
+    size_type max_surfaces{};
     size_type max_intersections{};
     size_type max_logic_depth{};
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return max_level > 0 && max_faces > 0 && max_intersections > 0;
+        return max_level > 0 && max_faces > 0 && max_surfaces > 0
+               && max_intersections > 0;
     }
 };
 
@@ -238,11 +244,26 @@ struct OrangeStateData
     StateItems<Sense>          sense;
     StateItems<BoundaryResult> boundary;
 
+    // Distance and surface along the current direction, reused between steps
+    StateItems<real_type> next_step;
+    StateItems<SurfaceId> next_surf;
+    StateItems<Sense>     next_sense;
+
+#if CELERITAS_DEBUG
+    // Number of distance-to-boundary requests and those satisfied by the
+    // reused distance, and whether the last request stopped at the maximum
+    // step before a saved boundary
+    StateItems<size_type> find_step_count;
+    StateItems<size_type> cached_step_count;
+    StateItems<char>      step_limited;
+#endif
+
     // Scratch space
-    Items<Sense>     temp_sense;    // [track][max_faces]
-    Items<FaceId>    temp_face;     // [track][max_intersections]
-    Items<real_type> temp_distance; // [track][max_intersections]
-    Items<size_type> temp_isect;    // [track][max_intersections]
+    Items<Sense>     temp_sense;      // [track][max_faces]
+    Items<SenseMemo> temp_surf_sense; // [track][max_surfaces]
+    Items<FaceId>    temp_face;       // [track][max_intersections]
+    Items<real_type> temp_distance;   // [track][max_intersections]
+    Items<size_type> temp_isect;      // [track][max_intersections]
 
     //// METHODS ////
 
@@ -256,7 +277,16 @@ struct OrangeStateData
             && surf.size() == pos.size()
             && sense.size() == pos.size()
             && boundary.size() == pos.size()
+            && next_step.size() == pos.size()
+            && next_surf.size() == pos.size()
+            && next_sense.size() == pos.size()
+#if CELERITAS_DEBUG
+            && find_step_count.size() == pos.size()
+            && cached_step_count.size() == pos.size()
+            && step_limited.size() == pos.size()
+#endif
             && !temp_sense.empty()
+            && !temp_surf_sense.empty()
             && !temp_face.empty()
             && temp_distance.size() == temp_face.size()
             && temp_isect.size() == temp_face.size();
@@ -279,10 +309,21 @@ struct OrangeStateData
         sense    = other.sense;
         boundary = other.boundary;
 
-        temp_sense    = other.temp_sense;
-        temp_face     = other.temp_face;
-        temp_distance = other.temp_distance;
-        temp_isect    = other.temp_isect;
+        next_step  = other.next_step;
+        next_surf  = other.next_surf;
+        next_sense = other.next_sense;
+
+#if CELERITAS_DEBUG
+        find_step_count   = other.find_step_count;
+        cached_step_count = other.cached_step_count;
+        step_limited      = other.step_limited;
+#endif
+
+        temp_sense      = other.temp_sense;
+        temp_surf_sense = other.temp_surf_sense;
+        temp_face       = other.temp_face;
+        temp_distance   = other.temp_distance;
+        temp_isect      = other.temp_isect;
 
         CELER_ENSURE(*this);
         return *this;
@@ -307,9 +348,32 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->sense, size);
     resize(&data->boundary, size);
 
+    resize(&data->next_step, size);
+    fill(real_type{0}, &data->next_step);
+    resize(&data->next_surf, size);
+    resize(&data->next_sense, size);
+
+#if CELERITAS_DEBUG
+    resize(&data->find_step_count, size);
+    fill(size_type{0}, &data->find_step_count);
+    resize(&data->cached_step_count, size);
+    fill(size_type{0}, &data->cached_step_count);
+    resize(&data->step_limited, size);
+    fill(char{0}, &data->step_limited);
+#endif
+
     size_type face_states = params.scalars.max_faces * size;
     resize(&data->temp_sense, face_states);
 
+    // Surface sense memo must start out as "unknown"
+    {
+        std::vector<SenseMemo> memo(params.scalars.max_surfaces * size,
+                                    SenseMemo::unknown);
+        Collection<SenseMemo, Ownership::value, MemSpace::host> temp;
+        make_builder(&temp).insert_back(memo.begin(), memo.end());
+        data->temp_surf_sense = temp;
+    }
+
     size_type isect_states = params.scalars.max_intersections * size;
     resize(&data->temp_face, isect_states);
     resize(&data->temp_distance, isect_states);
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <fstream>
 #include <initializer_list>
+#include <utility>
 
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
@@ -25,6 +26,8 @@
 #include "Data.hh"
 #include "Types.hh"
 #include "construct/OrangeInput.hh"
+#include "detail/OrangeBinaryIO.hh"
+#include "detail/SurfaceDeduplicator.hh"
 #include "detail/UnitInserter.hh"
 #include "univ/detail/LogicStack.hh"
 
@@ -80,14 +83,23 @@ OrangeInput input_from_json(std::string filename)
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct from a JSON file (if JSON is enabled).
+ * Construct from a JSON file (if JSON is enabled) or from a binary file.
  *
  * The JSON format is defined by the SCALE ORANGE exporter (not currently
- * distributed).
+ * distributed). Files with a \c .org.bin extension are instead loaded
+ * directly as fully constructed data written by \c write_binary , bypassing
+ * the JSON parsing and unit construction.
  */
-OrangeParams::OrangeParams(const std::string& json_filename)
-    : OrangeParams(input_from_json(json_filename))
+OrangeParams::OrangeParams(const std::string& filename)
 {
+    if (ends_with(filename, ".org.bin"))
+    {
+        this->load_binary(filename);
+    }
+    else
+    {
+        this->build(input_from_json(filename));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -97,6 +109,54 @@ OrangeParams::OrangeParams(const std::string& json_filename)
  * Volume and surface labels must be unique for the time being.
  */
 OrangeParams::OrangeParams(OrangeInput input)
+{
+    this->build(std::move(input));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the constructed geometry to a binary file.
+ *
+ * The output contains the fully constructed host data and the surface/volume
+ * labels, and it can be loaded by passing the filename (which should end in
+ * \c .org.bin ) to the constructor. The file is only portable between builds
+ * with the same endianness and the same sizes of \c real_type and
+ * \c size_type .
+ */
+void OrangeParams::write_binary(const std::string& filename) const
+{
+    CELER_LOG(info) << "Writing ORANGE geometry binary to " << filename;
+    if (!ends_with(filename, ".org.bin"))
+    {
+        CELER_LOG(warning) << "Expected '.org.bin' extension for ORANGE "
+                              "binary output";
+    }
+
+    detail::OrangeBinaryMetadata metadata;
+    metadata.surface_labels.reserve(surf_labels_.size());
+    for (auto sid : range(SurfaceId{surf_labels_.size()}))
+    {
+        metadata.surface_labels.push_back(surf_labels_.get(sid));
+    }
+    metadata.volume_labels.reserve(vol_labels_.size());
+    for (auto vid : range(VolumeId{vol_labels_.size()}))
+    {
+        metadata.volume_labels.push_back(vol_labels_.get(vid));
+    }
+    metadata.bbox = bbox_;
+
+    std::ofstream outfile(filename, std::ios::out | std::ios::binary);
+    CELER_VALIDATE(outfile,
+                   << "failed to open geometry output at '" << filename
+                   << '\'');
+    detail::write_orange_binary(this->host_ref(), metadata, outfile);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct all units from the input definition.
+ */
+void OrangeParams::build(OrangeInput&& input)
 {
     CELER_VALIDATE(input.units.size() == 1,
                    << "input geometry has " << input.units.size()
@@ -104,18 +164,74 @@ OrangeParams::OrangeParams(OrangeInput input)
                       "universe");
 
     // Insert all units
-    HostVal<OrangeParamsData> host_data;
-    detail::UnitInserter      insert_unit(&host_data);
+    HostVal<OrangeParamsData>   host_data;
+    detail::SurfaceDeduplicator merge_surfaces(input.surface_tol);
+    detail::UnitInserter        insert_unit(&host_data);
     auto universe_type  = make_builder(&host_data.universe_type);
     auto universe_index = make_builder(&host_data.universe_index);
-    for (const UnitInput& u : input.units)
+    for (UnitInput& u : input.units)
     {
         CELER_VALIDATE(
             u, << "unit '" << u.label << "' is not properly constructed");
+        if (size_type num_merged = merge_surfaces(&u))
+        {
+            CELER_LOG(info) << "Merged " << num_merged
+                            << " duplicate surfaces in unit '" << u.label
+                            << "' (" << u.surfaces.size() << " remain)";
+        }
         SimpleUnitId uid = insert_unit(u);
         universe_type.push_back(UniverseType::simple);
         universe_index.push_back(uid.get());
     }
+
+    // TODO: update this to work over multiple universe levels
+    // Capture metadata
+    UnitInput&         u = input.units.front();
+    std::vector<Label> volume_labels;
+    volume_labels.resize(u.volumes.size());
+    for (auto i : range(u.volumes.size()))
+    {
+        volume_labels[i] = std::move(u.volumes[i].label);
+    }
+
+    this->finalize(std::move(host_data),
+                   std::move(u.surfaces.labels),
+                   std::move(volume_labels),
+                   u.bbox);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load fully constructed data from a binary file.
+ */
+void OrangeParams::load_binary(const std::string& filename)
+{
+    CELER_LOG(info) << "Loading ORANGE geometry binary from " << filename;
+    ScopedTimeLog scoped_time;
+
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open geometry at '" << filename << '\'');
+
+    HostVal<OrangeParamsData>    host_data;
+    detail::OrangeBinaryMetadata metadata;
+    detail::read_orange_binary(infile, &host_data, &metadata);
+
+    this->finalize(std::move(host_data),
+                   std::move(metadata.surface_labels),
+                   std::move(metadata.volume_labels),
+                   metadata.bbox);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Validate constructed host data, save metadata, and copy to device.
+ */
+void OrangeParams::finalize(HostVal<OrangeParamsData>&& host_data,
+                            std::vector<Label>&&        surface_labels,
+                            std::vector<Label>&&        volume_labels,
+                            const BoundingBox&          bbox)
+{
     CELER_VALIDATE(host_data.scalars.max_logic_depth
                        < detail::LogicStack::max_stack_depth(),
                    << "input geometry has at least one volume with a "
@@ -125,20 +241,10 @@ OrangeParams::OrangeParams(OrangeInput input)
                       "stack is limited to a depth of "
                    << detail::LogicStack::max_stack_depth());
 
-    // TODO: update this to work over multiple universe levels
-    {
-        // Capture metadata
-        UnitInput& u = input.units.front();
-        surf_labels_ = LabelIdMultiMap<SurfaceId>{std::move(u.surfaces.labels)};
-        std::vector<Label> volume_labels;
-        volume_labels.resize(u.volumes.size());
-        for (auto i : range(u.volumes.size()))
-        {
-            volume_labels[i] = std::move(u.volumes[i].label);
-        }
-        vol_labels_ = LabelIdMultiMap<VolumeId>{std::move(volume_labels)};
-        bbox_       = u.bbox;
-    }
+    surf_labels_ = LabelIdMultiMap<SurfaceId>{std::move(surface_labels)};
+    vol_labels_  = LabelIdMultiMap<VolumeId>{std::move(volume_labels)};
+    bbox_        = bbox;
+
     CELER_ASSERT(host_data.simple_unit.size() == 1);
     supports_safety_ = host_data.simple_unit[SimpleUnitId{0}].simple_safety;
 
@@ -41,8 +41,8 @@ class OrangeParams
     //!@}
 
   public:
-    // Construct from a JSON file (if JSON is enabled)
-    explicit OrangeParams(const std::string& json_filename);
+    // Construct from a JSON file (if JSON) or a binary ".org.bin" file
+    explicit OrangeParams(const std::string& filename);
 
     // ADVANCED usage: construct from explicit host data
     explicit OrangeParams(OrangeInput input);
@@ -86,6 +86,11 @@ class OrangeParams
     //! Reference to managed GPU geometry data
     const DeviceRef& device_ref() const { return data_.device(); }
 
+    //// I/O ////
+
+    // Write the constructed geometry to a binary file for fast reloading
+    void write_binary(const std::string& filename) const;
+
   private:
     // Host metadata/access
     LabelIdMultiMap<SurfaceId> surf_labels_;
@@ -95,6 +100,15 @@ class OrangeParams
 
     // Host/device storage and reference
     CollectionMirror<OrangeParamsData> data_;
+
+    //// HELPER FUNCTIONS ////
+
+    void build(OrangeInput&& input);
+    void load_binary(const std::string& filename);
+    void finalize(HostVal<OrangeParamsData>&& host_data,
+                  std::vector<Label>&&        surface_labels,
+                  std::vector<Label>&&        volume_labels,
+                  const BoundingBox&          bbox);
 };
 
 //---------------------------------------------------------------------------//
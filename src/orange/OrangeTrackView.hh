@@ -42,6 +42,12 @@ namespace celeritas
  *
  * \c move_internal with a position \em should depend on the safety distance
  * but that's not yet implemented.
+ *
+ * The distance to the next boundary is saved in the state and decremented by
+ * \c move_internal , so consecutive straight-line steps (e.g. limited by
+ * physics) reuse it without intersecting any surfaces. It is invalidated by
+ * changing the direction or position, or by moving to a boundary. The number
+ * of distance requests and reused distances is tallied for each track.
  */
 class OrangeTrackView
 {
@@ -88,7 +94,7 @@ class OrangeTrackView
     //! After 'find_next_step', the next straight-line surface
     CELER_FUNCTION SurfaceId next_surface_id() const
     {
-        return next_surface_.id();
+        return this->next_surface().id();
     }
     // Whether the track is outside the valid geometry region
     CELER_FORCEINLINE_FUNCTION bool is_outside() const;
@@ -128,8 +134,7 @@ class OrangeTrackView
     const StateRef&  states_;
     ThreadId         thread_;
 
-    real_type         next_step_{0};   //!< Temporary next step
-    detail::OnSurface next_surface_{}; //!< Temporary next surface
+    real_type& next_step_; //!< Persistent distance to next boundary
 
     //// HELPER FUNCTIONS ////
 
@@ -139,16 +144,28 @@ class OrangeTrackView
     // Create local sense reference
     inline CELER_FUNCTION Span<Sense> make_temp_sense() const;
 
+    // Create local surface sense memo
+    inline CELER_FUNCTION Span<SenseMemo> make_temp_surf_sense() const;
+
     // Create local distance
     inline CELER_FUNCTION detail::TempNextFace make_temp_next() const;
 
     inline CELER_FUNCTION detail::LocalState make_local_state() const;
 
+    // Surface at the end of the next step, if any
+    inline CELER_FUNCTION detail::OnSurface next_surface() const;
+
+    // Save the result of a distance-to-boundary calculation
+    inline CELER_FUNCTION void set_next_step(const detail::Intersection&);
+
     // Whether the next distance-to-boundary has been found
     CELER_FORCEINLINE_FUNCTION bool has_next_step() const;
 
     // Invalidate the next distance-to-boundary
     CELER_FORCEINLINE_FUNCTION void clear_next_step();
+
+    // Tally a distance-to-boundary request in debug mode
+    CELER_FORCEINLINE_FUNCTION void tally_next_step(bool cached, bool limited);
 };
 
 //---------------------------------------------------------------------------//
@@ -161,13 +178,14 @@ CELER_FUNCTION
 OrangeTrackView::OrangeTrackView(const ParamsRef& params,
                                  const StateRef&  states,
                                  ThreadId         thread)
-    : params_(params), states_(states), thread_(thread)
+    : params_(params)
+    , states_(states)
+    , thread_(thread)
+    , next_step_(states.next_step[thread])
 {
     CELER_EXPECT(params_);
     CELER_EXPECT(states_);
     CELER_EXPECT(thread < states.size());
-
-    CELER_ENSURE(!this->has_next_step());
 }
 
 //---------------------------------------------------------------------------//
@@ -199,7 +217,8 @@ OrangeTrackView::operator=(const Initializer_t& init)
     local.dir        = init.dir;
     local.volume     = {};
     local.surface    = {};
-    local.temp_sense = this->make_temp_sense();
+    local.temp_sense      = this->make_temp_sense();
+    local.temp_surf_sense = this->make_temp_surf_sense();
 
     // Initialize logical state
     auto tracker = this->make_tracker(UniverseId{0});
@@ -222,15 +241,18 @@ CELER_FUNCTION
 OrangeTrackView& OrangeTrackView::operator=(const DetailedInitializer& init)
 {
     CELER_EXPECT(is_soft_unit_vector(init.dir));
-    CELER_EXPECT(states_.vol[init.other.thread_]);
+    const StateRef& other_states = init.other.states_;
+    const ThreadId  other_thread = init.other.thread_;
+    CELER_EXPECT(other_states.vol[other_thread]);
 
-    // Copy init track's position but update the direction
-    states_.pos[thread_]   = states_.pos[init.other.thread_];
+    // Copy init track's position but update the direction; the other track
+    // may belong to a different state vector
+    states_.pos[thread_]   = other_states.pos[other_thread];
     states_.dir[thread_]   = init.dir;
-    states_.vol[thread_]   = states_.vol[init.other.thread_];
-    states_.surf[thread_]  = states_.surf[init.other.thread_];
-    states_.sense[thread_] = states_.sense[init.other.thread_];
-    states_.boundary[thread_] = states_.boundary[init.other.thread_];
+    states_.vol[thread_]   = other_states.vol[other_thread];
+    states_.surf[thread_]  = other_states.surf[other_thread];
+    states_.sense[thread_] = other_states.sense[other_thread];
+    states_.boundary[thread_] = other_states.boundary[other_thread];
 
     // Clear step and surface info
     this->clear_next_step();
@@ -271,23 +293,23 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
         return {0, true};
     }
 
-    if (!next_surface_ && next_step_ != no_intersection())
+    if (!this->next_surface() && next_step_ != no_intersection())
     {
         // Reset a previously found truncated distance
         this->clear_next_step();
     }
 
-    if (!this->has_next_step())
+    const bool cached = this->has_next_step();
+    if (!cached)
     {
-        auto tracker  = this->make_tracker(UniverseId{0});
-        auto isect    = tracker.intersect(this->make_local_state());
-        next_step_    = isect.distance;
-        next_surface_ = isect.surface;
+        auto tracker = this->make_tracker(UniverseId{0});
+        this->set_next_step(tracker.intersect(this->make_local_state()));
     }
 
     Propagation result;
     result.distance = next_step_;
-    result.boundary = static_cast<bool>(next_surface_);
+    result.boundary = static_cast<bool>(this->next_surface());
+    this->tally_next_step(cached, false);
     return result;
 }
 
@@ -296,7 +318,9 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
  * Find a nearby distance to the next geometric boundary up to a distance.
  *
  * This may reduce the number of surfaces needed to check, sort, or write to
- * temporary memory, thereby speeding up transport.
+ * temporary memory, thereby speeding up transport. In volumes without
+ * internal surfaces, the full distance is calculated and saved so that
+ * subsequent shorter steps along the same direction need no intersection.
  */
 CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
 {
@@ -307,28 +331,45 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
         // On a boundary, headed back in: next step is zero
         return {0, true};
     }
-    else if (next_step_ > max_step)
+
+    if (next_step_ > max_step)
     {
         // Cached next step is beyond the given step
+        this->tally_next_step(true, true);
         return {max_step, false};
     }
-    else if (!next_surface_ && next_step_ < max_step)
+    else if (!this->next_surface() && next_step_ < max_step)
     {
         // Reset a previously found truncated distance
         this->clear_next_step();
     }
 
-    if (!this->has_next_step())
+    const bool cached = this->has_next_step();
+    if (!cached)
     {
-        auto tracker  = this->make_tracker(UniverseId{0});
-        auto isect    = tracker.intersect(this->make_local_state(), max_step);
-        next_step_    = isect.distance;
-        next_surface_ = isect.surface;
+        auto tracker = this->make_tracker(UniverseId{0});
+        if (tracker.has_internal_surfaces(states_.vol[thread_]))
+        {
+            // Only sort and test intersections up to the maximum step
+            this->set_next_step(
+                tracker.intersect(this->make_local_state(), max_step));
+        }
+        else
+        {
+            // Save the exact boundary distance for subsequent steps
+            this->set_next_step(tracker.intersect(this->make_local_state()));
+            if (next_step_ > max_step)
+            {
+                this->tally_next_step(false, true);
+                return {max_step, false};
+            }
+        }
     }
 
     Propagation result;
     result.distance = next_step_;
-    result.boundary = static_cast<bool>(next_surface_);
+    result.boundary = static_cast<bool>(this->next_surface());
+    this->tally_next_step(cached, !result.boundary);
 
     CELER_ENSURE(result.distance <= max_step);
     return result;
@@ -358,13 +399,16 @@ CELER_FUNCTION void OrangeTrackView::move_to_boundary()
 {
     CELER_EXPECT(states_.boundary[thread_] != BoundaryResult::reentrant);
     CELER_EXPECT(this->has_next_step());
-    CELER_EXPECT(next_surface_);
+    CELER_EXPECT(this->next_surface());
+#if CELERITAS_DEBUG
+    CELER_EXPECT(!states_.step_limited[thread_]);
+#endif
 
     // Physically move next step
     axpy(next_step_, states_.dir[thread_], &states_.pos[thread_]);
     // Move to the inside of the surface
-    states_.surf[thread_]     = next_surface_.id();
-    states_.sense[thread_]    = next_surface_.unchecked_sense();
+    states_.surf[thread_]  = states_.next_surf[thread_];
+    states_.sense[thread_] = states_.next_sense[thread_];
     this->clear_next_step();
 }
 
@@ -379,7 +423,7 @@ CELER_FUNCTION void OrangeTrackView::move_internal(real_type dist)
 {
     CELER_EXPECT(this->has_next_step());
     CELER_EXPECT(dist > 0 && dist <= next_step_);
-    CELER_EXPECT(dist != next_step_ || !next_surface_);
+    CELER_EXPECT(dist != next_step_ || !this->next_surface());
 
     // Move and update next_step_
     axpy(dist, states_.dir[thread_], &states_.pos[thread_]);
@@ -427,7 +471,8 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
     local.dir     = this->dir();
     local.volume  = states_.vol[thread_];
     local.surface = {states_.surf[thread_], flip_sense(states_.sense[thread_])};
-    local.temp_sense = this->make_temp_sense();
+    local.temp_sense      = this->make_temp_sense();
+    local.temp_surf_sense = this->make_temp_surf_sense();
 
     // Update the post-crossing volume
     auto              tracker = this->make_tracker(UniverseId{0});
@@ -523,6 +568,18 @@ CELER_FUNCTION Span<Sense> OrangeTrackView::make_temp_sense() const
         offset, max_faces);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the surface sense memo for the current thread.
+ */
+CELER_FUNCTION Span<SenseMemo> OrangeTrackView::make_temp_surf_sense() const
+{
+    const auto max_surfaces = params_.scalars.max_surfaces;
+    auto       offset       = thread_.get() * max_surfaces;
+    return states_.temp_surf_sense[AllItems<SenseMemo, MemSpace::native>{}]
+        .subspan(offset, max_surfaces);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Set up intersection scratch space.
@@ -553,11 +610,33 @@ CELER_FUNCTION detail::LocalState OrangeTrackView::make_local_state() const
     local.dir        = states_.dir[thread_];
     local.volume     = states_.vol[thread_];
     local.surface    = {states_.surf[thread_], states_.sense[thread_]};
-    local.temp_sense = this->make_temp_sense();
-    local.temp_next  = this->make_temp_next();
+    local.temp_sense      = this->make_temp_sense();
+    local.temp_surf_sense = this->make_temp_surf_sense();
+    local.temp_next       = this->make_temp_next();
     return local;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Surface at the end of the next step, if any.
+ */
+CELER_FUNCTION detail::OnSurface OrangeTrackView::next_surface() const
+{
+    return {states_.next_surf[thread_], states_.next_sense[thread_]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the result of a distance-to-boundary calculation.
+ */
+CELER_FUNCTION void
+OrangeTrackView::set_next_step(const detail::Intersection& isect)
+{
+    next_step_                  = isect.distance;
+    states_.next_surf[thread_]  = isect.surface.id();
+    states_.next_sense[thread_] = isect.surface.unchecked_sense();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether any next step has been calculated.
@@ -578,7 +657,29 @@ CELER_FUNCTION void OrangeTrackView::clear_next_step()
 {
     next_step_ = 0;
 #if CELERITAS_DEBUG
-    next_surface_ = {};
+    states_.next_surf[thread_]    = {};
+    states_.step_limited[thread_] = false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally a distance-to-boundary request in debug mode.
+ *
+ * A step that stops short of the next boundary is flagged so that moving to
+ * the boundary afterward is caught as an error.
+ */
+CELER_FUNCTION void
+OrangeTrackView::tally_next_step(CELER_MAYBE_UNUSED bool cached,
+                                 CELER_MAYBE_UNUSED bool limited)
+{
+#if CELERITAS_DEBUG
+    ++states_.find_step_count[thread_];
+    if (cached)
+    {
+        ++states_.cached_step_count[thread_];
+    }
+    states_.step_limited[thread_] = limited;
 #endif
 }
 
@@ -151,6 +151,21 @@ enum class SignedSense
     outside = 1
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Previously calculated sense of a surface, or "unknown".
+ *
+ * The zero value is "unknown" so that zero-initialized storage is an empty
+ * memo.
+ */
+enum class SenseMemo : unsigned char
+{
+    unknown = 0,
+    inside,
+    on,
+    outside
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * When evaluating an intersection, whether the point is on the surface.
@@ -288,6 +303,24 @@ CELER_CONSTEXPR_FUNCTION Sense to_sense(SignedSense s)
     return Sense(static_cast<int>(s) >= 0);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a signed sense to a memoized value.
+ */
+CELER_CONSTEXPR_FUNCTION SenseMemo to_sense_memo(SignedSense s)
+{
+    return static_cast<SenseMemo>(static_cast<int>(s) + 2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a known memoized value back to a signed sense.
+ */
+CELER_CONSTEXPR_FUNCTION SignedSense to_signed_sense(SenseMemo s)
+{
+    return static_cast<SignedSense>(static_cast<int>(s) - 2);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Convert a signed sense to a surface state.
@@ -92,6 +92,9 @@ struct OrangeInput
 {
     std::vector<UnitInput> units;
 
+    //! Relative tolerance for merging near-identical surfaces
+    real_type surface_tol{1e-8};
+
     // TODO: array of universe types and universe ID -> offset
     // or maybe std::variant when we require C++17
 
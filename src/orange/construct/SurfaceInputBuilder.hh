@@ -20,13 +20,14 @@ struct SurfaceInput;
 /*!
  * Construct surfaces on the host.
  *
- * Currently this simply appends the surface to the Data, but the full
- * robust geometry implementation will implement "soft" surface deduplication.
+ * This simply appends the surface to the input. Near-identical surfaces are
+ * merged (and the volume logic remapped) when the unit is constructed by \c
+ * OrangeParams .
  *
  * \code
    SurfaceInputBuilder insert_surface(&surface_input);
    auto id = insert_surface(PlaneX(123));
-   auto id2 = insert_surface(PlaneX(123.0000001)); // TODO: equals id
+   auto id2 = insert_surface(PlaneX(123.0000001)); // merged into id later
    \endcode
  */
 class SurfaceInputBuilder
@@ -0,0 +1,288 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeBinaryIO.cc
+//---------------------------------------------------------------------------//
+#include "OrangeBinaryIO.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Leading bytes of every file
+constexpr char magic[8] = {'O', 'R', 'A', 'N', 'G', 'E', 'B', '\0'};
+
+// Increment when the layout of any ORANGE data structure changes:
+// - 1: initial layout
+// - 2: add max_surfaces to the scalars (surface sense memoization)
+constexpr std::uint32_t format_version = 2;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write raw values to a binary stream.
+ *
+ * Every item must be trivially copyable: the persistent ORANGE data is
+ * composed solely of POD structs and opaque IDs, so collections are dumped
+ * directly from their storage.
+ */
+class BinaryWriter
+{
+  public:
+    explicit BinaryWriter(std::ostream& os) : os_(os) {}
+
+    template<class T>
+    void operator()(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "binary output requires trivially copyable types");
+        this->write_bytes(&value, sizeof(T));
+    }
+
+    template<class T, class I>
+    void operator()(const Collection<T,
+                                     Ownership::const_reference,
+                                     MemSpace::host,
+                                     I>& col)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "binary output requires trivially copyable types");
+        auto items = col[AllItems<T, MemSpace::host>{}];
+        (*this)(static_cast<std::uint64_t>(items.size()));
+        this->write_bytes(items.data(), items.size() * sizeof(T));
+    }
+
+    void operator()(const std::string& s)
+    {
+        (*this)(static_cast<std::uint64_t>(s.size()));
+        this->write_bytes(s.data(), s.size());
+    }
+
+    void operator()(const std::vector<Label>& labels)
+    {
+        (*this)(static_cast<std::uint64_t>(labels.size()));
+        for (const Label& label : labels)
+        {
+            (*this)(label.name);
+            (*this)(label.ext);
+        }
+    }
+
+  private:
+    std::ostream& os_;
+
+    void write_bytes(const void* data, std::size_t count)
+    {
+        os_.write(static_cast<const char*>(data), count);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read raw values from a binary stream.
+ *
+ * Collections are resized and then filled with a single bulk read.
+ */
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(std::istream& is) : is_(is) {}
+
+    template<class T>
+    void operator()(T* value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "binary input requires trivially copyable types");
+        this->read_bytes(value, sizeof(T));
+    }
+
+    template<class T, class I>
+    void operator()(Collection<T, Ownership::value, MemSpace::host, I>* col)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "binary input requires trivially copyable types");
+        auto count = this->read_size();
+        if (count == 0)
+            return;
+        resize(col, count);
+        auto items = (*col)[AllItems<T, MemSpace::host>{}];
+        this->read_bytes(items.data(), items.size() * sizeof(T));
+    }
+
+    void operator()(std::string* s)
+    {
+        s->resize(this->read_size());
+        this->read_bytes(&(*s)[0], s->size());
+    }
+
+    void operator()(std::vector<Label>* labels)
+    {
+        labels->resize(this->read_size());
+        for (Label& label : *labels)
+        {
+            (*this)(&label.name);
+            (*this)(&label.ext);
+        }
+    }
+
+  private:
+    std::istream& is_;
+
+    std::uint64_t read_size()
+    {
+        std::uint64_t result;
+        (*this)(&result);
+        CELER_VALIDATE(result <= static_cast<std::uint64_t>(
+                           std::numeric_limits<size_type>::max()),
+                       << "ORANGE binary data is corrupt (read size "
+                       << result << ")");
+        return result;
+    }
+
+    void read_bytes(void* data, std::size_t count)
+    {
+        is_.read(static_cast<char*>(data), count);
+        CELER_VALIDATE(is_ && static_cast<std::size_t>(is_.gcount()) == count,
+                       << "unexpected end of ORANGE binary data");
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a reader or writer to every collection in the ORANGE data.
+ *
+ * The order here defines the on-disk layout: modifying it requires
+ * incrementing \c format_version .
+ */
+template<class F, class D>
+void visit_collections(F&& visit, D& data)
+{
+    visit(data.universe_type);
+    visit(data.universe_index);
+    visit(data.simple_unit);
+    visit(data.surface_ids);
+    visit(data.volume_ids);
+    visit(data.real_ids);
+    visit(data.logic_ints);
+    visit(data.reals);
+    visit(data.surface_types);
+    visit(data.connectivities);
+    visit(data.volume_records);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sizes of fundamental types, to prevent loading across incompatible builds.
+ */
+std::uint32_t type_signature()
+{
+    return (sizeof(real_type) << 16) | (sizeof(size_type) << 8)
+           | sizeof(logic_int);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write fully constructed ORANGE data to a binary stream.
+ *
+ * The stream must be opened in binary mode. The result is specific to the
+ * endianness and type sizes of the current build.
+ */
+void write_orange_binary(const HostCRef<OrangeParamsData>& data,
+                         const OrangeBinaryMetadata&       metadata,
+                         std::ostream&                     os)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(metadata.bbox);
+
+    BinaryWriter write(os);
+    os.write(magic, sizeof(magic));
+    write(format_version);
+    write(type_signature());
+
+    write(data.scalars);
+    visit_collections([&write](const auto& col) { write(col); }, data);
+
+    write(metadata.surface_labels);
+    write(metadata.volume_labels);
+    write(metadata.bbox);
+
+    CELER_VALIDATE(os, << "failed to write ORANGE binary data");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read fully constructed ORANGE data from a binary stream.
+ *
+ * No validation beyond the header and the final data consistency checks is
+ * performed, so the input must have been created by \c write_orange_binary .
+ */
+void read_orange_binary(std::istream&              is,
+                        HostVal<OrangeParamsData>* data,
+                        OrangeBinaryMetadata*      metadata)
+{
+    CELER_EXPECT(data && !*data);
+    CELER_EXPECT(metadata);
+
+    BinaryReader read(is);
+    {
+        char file_magic[sizeof(magic)];
+        is.read(file_magic, sizeof(file_magic));
+        CELER_VALIDATE(is && std::memcmp(file_magic, magic, sizeof(magic)) == 0,
+                       << "input is not an ORANGE binary geometry");
+    }
+    {
+        std::uint32_t version;
+        read(&version);
+        CELER_VALIDATE(version <= format_version,
+                       << "ORANGE binary geometry has format version "
+                       << version << ", which is newer than the version ("
+                       << format_version << ") supported by this build");
+        CELER_VALIDATE(version == format_version,
+                       << "ORANGE binary geometry has obsolete format version "
+                       << version << " (this build requires version "
+                       << format_version
+                       << "): regenerate it from the original geometry");
+        std::uint32_t signature;
+        read(&signature);
+        CELER_VALIDATE(signature == type_signature(),
+                       << "ORANGE binary geometry was written by a build "
+                          "with incompatible type sizes");
+    }
+
+    read(&data->scalars);
+    visit_collections([&read](auto& col) { read(&col); }, *data);
+
+    read(&metadata->surface_labels);
+    read(&metadata->volume_labels);
+    read(&metadata->bbox);
+
+    CELER_VALIDATE(*data && metadata->bbox,
+                   << "ORANGE binary data is inconsistent");
+    CELER_VALIDATE(metadata->surface_labels.size()
+                       == data->surface_types.size(),
+                   << "ORANGE binary data has " << data->surface_types.size()
+                   << " surfaces but " << metadata->surface_labels.size()
+                   << " surface labels");
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,45 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/OrangeBinaryIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+#include "corecel/cont/Label.hh"
+#include "orange/BoundingBox.hh"
+#include "orange/Data.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host metadata stored alongside the constructed ORANGE data.
+ */
+struct OrangeBinaryMetadata
+{
+    std::vector<Label> surface_labels;
+    std::vector<Label> volume_labels;
+    BoundingBox        bbox;
+};
+
+//---------------------------------------------------------------------------//
+// Write fully constructed ORANGE data to a binary stream
+void write_orange_binary(const HostCRef<OrangeParamsData>& data,
+                         const OrangeBinaryMetadata&       metadata,
+                         std::ostream&                     os);
+
+// Read fully constructed ORANGE data from a binary stream
+void read_orange_binary(std::istream&              is,
+                        HostVal<OrangeParamsData>* data,
+                        OrangeBinaryMetadata*      metadata);
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,257 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SurfaceDeduplicator.cc
+//---------------------------------------------------------------------------//
+#include "SurfaceDeduplicator.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/SoftEqual.hh"
+#include "orange/construct/OrangeInput.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Scale a general quadric and return whether its sense was flipped.
+ */
+bool canonicalize_quadric(Span<real_type> coeffs, real_type tol)
+{
+    real_type max_abs = 0;
+    for (real_type c : coeffs)
+    {
+        max_abs = std::max(max_abs, std::fabs(c));
+    }
+    CELER_VALIDATE(max_abs > 0,
+                   << "general quadric has no nonzero coefficients");
+
+    // Make the first nonzero coefficient positive
+    auto first_nonzero = std::find_if(
+        coeffs.begin(), coeffs.end(), [max_abs, tol](real_type c) {
+            return std::fabs(c) > tol * max_abs;
+        });
+    CELER_ASSERT(first_nonzero != coeffs.end());
+    bool      flip  = *first_nonzero < 0;
+    real_type scale = (flip ? -1 : 1) / max_abs;
+
+    for (real_type& c : coeffs)
+    {
+        c *= scale;
+    }
+    return flip;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the representative of a set of merged surfaces.
+ */
+size_type find_root(std::vector<size_type>* parent, size_type i)
+{
+    std::vector<size_type>& p = *parent;
+    while (p[i] != i)
+    {
+        p[i] = p[p[i]];
+        i    = p[i];
+    }
+    return i;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a relative tolerance.
+ *
+ * A tolerance of zero merges only surfaces with identical coefficients.
+ */
+SurfaceDeduplicator::SurfaceDeduplicator(real_type tol) : tol_(tol)
+{
+    CELER_EXPECT(tol_ >= 0 && tol_ < 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Canonicalize and merge surfaces, returning the number removed.
+ */
+size_type SurfaceDeduplicator::operator()(UnitInput* unit) const
+{
+    CELER_EXPECT(unit);
+    SurfaceInput& surfaces = unit->surfaces;
+    CELER_EXPECT(surfaces);
+
+    const size_type num_surfaces = surfaces.size();
+
+    // Calculate the offset of each surface's data
+    std::vector<size_type> offsets(num_surfaces + 1, 0);
+    std::partial_sum(
+        surfaces.sizes.begin(), surfaces.sizes.end(), offsets.begin() + 1);
+    CELER_VALIDATE(offsets.back() == surfaces.data.size(),
+                   << "incorrect surface data size (" << surfaces.data.size()
+                   << "): should match accumulated sizes (" << offsets.back()
+                   << ")");
+    auto get_data = [&surfaces, &offsets](size_type i) {
+        return make_span(surfaces.data)
+            .subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    };
+
+    //// Canonicalize ////
+
+    std::vector<bool> flipped(num_surfaces, false);
+    for (auto i : range(num_surfaces))
+    {
+        if (surfaces.types[i] == SurfaceType::gq)
+        {
+            flipped[i] = canonicalize_quadric(get_data(i), tol_);
+        }
+    }
+
+    //// Merge ////
+
+    // Sort surfaces by type and leading coefficient so that candidates for
+    // merging are adjacent
+    std::vector<size_type> order(num_surfaces);
+    std::iota(order.begin(), order.end(), size_type(0));
+    std::sort(order.begin(), order.end(), [&](size_type a, size_type b) {
+        if (surfaces.types[a] != surfaces.types[b])
+        {
+            return surfaces.types[a] < surfaces.types[b];
+        }
+        return get_data(a).front() < get_data(b).front();
+    });
+
+    SoftEqual<>            soft_eq(tol_, tol_);
+    std::vector<size_type> parent(num_surfaces);
+    std::iota(parent.begin(), parent.end(), size_type(0));
+    for (auto i : range(num_surfaces))
+    {
+        const size_type cur      = order[i];
+        const auto      cur_data = get_data(cur);
+        for (auto j = i; j-- > 0;)
+        {
+            const size_type prev      = order[j];
+            const auto      prev_data = get_data(prev);
+            if (surfaces.types[prev] != surfaces.types[cur]
+                || !soft_eq(prev_data.front(), cur_data.front()))
+            {
+                // No earlier surfaces can match
+                break;
+            }
+            if (std::equal(prev_data.begin(),
+                           prev_data.end(),
+                           cur_data.begin(),
+                           soft_eq))
+            {
+                // Keep the lowest surface index as the representative
+                size_type a = find_root(&parent, prev);
+                size_type b = find_root(&parent, cur);
+                parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+    }
+
+    // Renumber the representative surfaces, preserving their order
+    std::vector<size_type> new_id(num_surfaces);
+    SurfaceInput           merged;
+    for (auto i : range(num_surfaces))
+    {
+        size_type root = find_root(&parent, i);
+        if (root != i)
+        {
+            CELER_ASSERT(root < i);
+            new_id[i] = new_id[root];
+            continue;
+        }
+        new_id[i] = merged.size();
+        auto data = get_data(i);
+        merged.types.push_back(surfaces.types[i]);
+        merged.data.insert(merged.data.end(), data.begin(), data.end());
+        merged.sizes.push_back(data.size());
+        merged.labels.push_back(std::move(surfaces.labels[i]));
+    }
+    const size_type num_merged = num_surfaces - merged.size();
+    surfaces                   = std::move(merged);
+    if (num_merged == 0
+        && std::find(flipped.begin(), flipped.end(), true) == flipped.end())
+    {
+        // No volumes need to be updated
+        return 0;
+    }
+
+    //// Remap volumes ////
+
+    for (VolumeInput& vol : unit->volumes)
+    {
+        std::vector<SurfaceId> faces;
+        faces.reserve(vol.faces.size());
+        for (SurfaceId f : vol.faces)
+        {
+            CELER_VALIDATE(f < num_surfaces,
+                           << "invalid surface ID " << f.unchecked_get()
+                           << " in volume '" << vol.label << "'");
+            faces.push_back(SurfaceId{new_id[f.unchecked_get()]});
+        }
+        std::sort(faces.begin(), faces.end());
+        faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+        std::vector<logic_int> logic;
+        logic.reserve(vol.logic.size());
+        bool negated = false;
+        for (logic_int token : vol.logic)
+        {
+            if (logic::is_operator_token(token))
+            {
+                if (token == logic::lnot && negated)
+                {
+                    // Cancel the negation added for a flipped surface
+                    logic.pop_back();
+                }
+                else
+                {
+                    logic.push_back(token);
+                }
+                negated = false;
+                continue;
+            }
+
+            CELER_VALIDATE(token < vol.faces.size(),
+                           << "invalid face index " << token
+                           << " in logic for volume '" << vol.label << "'");
+            size_type old_id = vol.faces[token].unchecked_get();
+            auto      iter   = std::lower_bound(
+                faces.begin(), faces.end(), SurfaceId{new_id[old_id]});
+            CELER_ASSERT(iter != faces.end());
+            logic.push_back(iter - faces.begin());
+            negated = flipped[old_id];
+            if (negated)
+            {
+                logic.push_back(logic::lnot);
+            }
+        }
+
+        vol.faces = std::move(faces);
+        vol.logic = std::move(logic);
+    }
+
+    return num_merged;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,56 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SurfaceDeduplicator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "orange/Types.hh"
+
+namespace celeritas
+{
+struct UnitInput;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Canonicalize surfaces and merge near-duplicates in a unit definition.
+ *
+ * Geometries converted from CAD or GDML often define the same plane or
+ * cylinder separately for each adjacent volume. Merging them reduces the
+ * number of surfaces that must be intersected and the faces per volume.
+ *
+ * General quadrics are first scaled so that their largest coefficient has
+ * unit magnitude and their first nonzero coefficient is positive. Negating a
+ * quadric swaps its inside and outside, so the sense of that surface is
+ * negated in the logic of every volume that uses it.
+ *
+ * Surfaces of the same type whose coefficients all match within the relative
+ * (and, for coefficients near zero, absolute) tolerance are then replaced by
+ * the first of them, keeping its label. The faces and logic of each volume
+ * are remapped to the merged surface IDs.
+ *
+ * \code
+   SurfaceDeduplicator dedup(1e-8);
+   size_type num_merged = dedup(&unit);
+   \endcode
+ */
+class SurfaceDeduplicator
+{
+  public:
+    // Construct with a relative tolerance
+    explicit SurfaceDeduplicator(real_type tol);
+
+    // Canonicalize and merge surfaces, returning the number removed
+    size_type operator()(UnitInput* unit) const;
+
+  private:
+    real_type tol_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -135,6 +135,7 @@ UnitInserter::UnitInserter(Data* orange_data) : orange_data_(orange_data)
 
     // Initialize scalars
     orange_data_->scalars.max_faces         = 1;
+    orange_data_->scalars.max_surfaces      = 1;
     orange_data_->scalars.max_intersections = 1;
 }
 
@@ -148,6 +149,8 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
 
     // Insert surfaces
     unit.surfaces = this->insert_surfaces(inp.surfaces);
+    inplace_max<size_type>(&orange_data_->scalars.max_surfaces,
+                           inp.surfaces.size());
 
     // Define volumes
     std::vector<VolumeRecord>       vol_records(inp.volumes.size());
@@ -41,8 +41,11 @@ class QuadraticSolver
     using Intersections = Array<real_type, 2>;
     //!@}
 
-    //! Fuzziness for "along surface"
-    static CELER_CONSTEXPR_FUNCTION real_type min_a() { return 1e-10; }
+    //! Fuzziness for "along surface" (coarser in single precision)
+    static CELER_CONSTEXPR_FUNCTION real_type min_a()
+    {
+        return CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-10 : 1e-5;
+    }
 
     // Solve when possibly along a surface (zeroish a)
     static inline CELER_FUNCTION Intersections solve_general(
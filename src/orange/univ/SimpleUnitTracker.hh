@@ -76,6 +76,9 @@ class SimpleUnitTracker
     inline CELER_FUNCTION Intersection intersect(const LocalState& state,
                                                  real_type max_dist) const;
 
+    // Whether distance-to-boundary must track through internal surfaces
+    inline CELER_FUNCTION bool has_internal_surfaces(VolumeId vol) const;
+
     // Calculate closest distance to a surface in any direction
     inline CELER_FUNCTION real_type safety(const Real3& pos,
                                            VolumeId     vol) const;
@@ -134,6 +137,9 @@ SimpleUnitTracker::SimpleUnitTracker(const ParamsRef& params, SimpleUnitId suid)
  *
  * To avoid edge cases and inconsistent logical/physical states, it is
  * prohibited to initialize from an arbitrary point directly onto a surface.
+ *
+ * Since surfaces are typically shared among many volumes, the sense of each
+ * surface is memoized during the search.
  */
 CELER_FUNCTION auto
 SimpleUnitTracker::initialize(const LocalState& state) const -> Initialization
@@ -141,10 +147,13 @@ SimpleUnitTracker::initialize(const LocalState& state) const -> Initialization
     CELER_EXPECT(params_);
     CELER_EXPECT(!state.surface && !state.volume);
 
-    detail::SenseCalculator calc_senses(
-        this->make_local_surfaces(), state.pos, state.temp_sense);
+    detail::SenseCalculator calc_senses(this->make_local_surfaces(),
+                                        state.pos,
+                                        state.temp_sense,
+                                        state.temp_surf_sense);
 
     // Loop over all volumes (TODO: use BVH)
+    Initialization result;
     for (VolumeId volid : range(VolumeId{this->num_volumes()}))
     {
         VolumeView vol = this->make_local_volume(volid);
@@ -158,37 +167,50 @@ SimpleUnitTracker::initialize(const LocalState& state) const -> Initialization
             // State is *not* inside this volume: try the next one
             continue;
         }
-        if (logic_state.face)
+        if (!logic_state.face)
         {
-            // Initialized on a boundary in this volume but wasn't known
-            // to be crossing a surface. Fail safe by letting the multi-level
-            // tracking geometry (NOT YET IMPLEMENTED in GPU ORANGE) bump and
-            // try again.
-            break;
+            // Found and not unexpectedly on a surface!
+            result = {volid, {}};
         }
-
-        // Found and not unexpectedly on a surface!
-        return {volid, {}};
+        // Otherwise, initialized on a boundary in this volume but wasn't
+        // known to be crossing a surface. Fail safe by letting the
+        // multi-level tracking geometry (NOT YET IMPLEMENTED in GPU ORANGE)
+        // bump and try again.
+        break;
     }
 
-    // Not found
-    return {};
+    // Reset the memo for the next point
+    calc_senses.clear_memo();
+    return result;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Find the local volume on the opposite side of a surface.
+ *
+ * If more than one other volume is connected to the surface, the senses of
+ * the surfaces shared among the candidates are memoized. Only the faces of
+ * the volumes that were tested are reset afterward.
  */
 CELER_FUNCTION auto
 SimpleUnitTracker::cross_boundary(const LocalState& state) const
     -> Initialization
 {
     CELER_EXPECT(state.surface && state.volume);
+
+    // Connected volumes, including the current one
+    Span<const VolumeId> neighbors = this->get_neighbors(state.surface.id());
+    const bool           use_memo  = neighbors.size() > 2;
+
     detail::SenseCalculator calc_senses(
-        this->make_local_surfaces(), state.pos, state.temp_sense);
+        this->make_local_surfaces(),
+        state.pos,
+        state.temp_sense,
+        use_memo ? state.temp_surf_sense : Span<SenseMemo>{});
 
     // Loop over all connected surfaces (TODO: intersect with BVH)
-    for (VolumeId volid : this->get_neighbors(state.surface.id()))
+    Initialization result;
+    for (VolumeId volid : neighbors)
     {
         if (volid == state.volume)
         {
@@ -209,11 +231,28 @@ SimpleUnitTracker::cross_boundary(const LocalState& state) const
         }
 
         // Found the volume! Convert the face to a surface ID and return
-        return {volid, get_surface(vol, logic_state.face)};
+        result = {volid, get_surface(vol, logic_state.face)};
+        break;
     }
 
-    // Failed to find a valid volume containing the point
-    return {};
+    if (use_memo)
+    {
+        // Reset the memo for the faces of the volumes we tested
+        for (VolumeId volid : neighbors)
+        {
+            if (volid != state.volume)
+            {
+                calc_senses.clear_memo(this->make_local_volume(volid));
+            }
+            if (volid == result.volume)
+            {
+                break;
+            }
+        }
+    }
+
+    // Result is null if we failed to find a valid volume containing the point
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -245,6 +284,19 @@ SimpleUnitTracker::intersect(const LocalState& state, real_type max_dist) const
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether distance-to-boundary must track through internal surfaces.
+ *
+ * For volumes without internal surfaces, the nearest intersection is the
+ * boundary, so limiting the search distance saves little work.
+ */
+CELER_FUNCTION bool SimpleUnitTracker::has_internal_surfaces(VolumeId vol) const
+{
+    return this->make_local_volume(vol).flags()
+           & VolumeRecord::internal_surfaces;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate nearest distance to a surface in any direction.
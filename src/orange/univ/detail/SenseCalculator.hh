@@ -26,6 +26,12 @@ namespace detail
  *
  * This is an implementation detail for CellInitializer but is also used by
  * complex intersection methods.
+ *
+ * When testing several volumes at the same point, an optional memo indexed by
+ * local surface ID saves each surface's sense the first time it's calculated
+ * so that surfaces shared between volumes are evaluated only once. The memo
+ * entries must be "unknown" on construction, and the caller is responsible
+ * for clearing them (with \c clear_memo) before the position changes.
  */
 class SenseCalculator
 {
@@ -43,10 +49,22 @@ class SenseCalculator
                                           const Real3&    pos,
                                           Span<Sense>     storage);
 
+    // Construct with a memo of surface senses
+    inline CELER_FUNCTION SenseCalculator(const Surfaces& surfaces,
+                                          const Real3&    pos,
+                                          Span<Sense>     storage,
+                                          Span<SenseMemo> memo);
+
     // Calculate senses for the given volume, possibly on a face
     inline CELER_FUNCTION result_type operator()(const VolumeView& vol,
                                                  OnFace face = {}) const;
 
+    // Reset the memoized senses of a volume's faces
+    inline CELER_FUNCTION void clear_memo(const VolumeView& vol) const;
+
+    // Reset all memoized senses
+    inline CELER_FUNCTION void clear_memo() const;
+
   private:
     //! Compressed vector of surface definitions
     Surfaces surfaces_;
@@ -56,6 +74,9 @@ class SenseCalculator
 
     //! Temporary senses
     Span<Sense> sense_storage_;
+
+    //! Previously calculated senses, indexed by surface (optional)
+    Span<SenseMemo> memo_;
 };
 
 //---------------------------------------------------------------------------//
@@ -67,10 +88,25 @@ class SenseCalculator
 CELER_FUNCTION SenseCalculator::SenseCalculator(const Surfaces& surfaces,
                                                 const Real3&    pos,
                                                 Span<Sense>     storage)
-    : surfaces_(surfaces), pos_(pos), sense_storage_(storage)
+    : SenseCalculator(surfaces, pos, storage, {})
 {
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a memo of surface senses.
+ *
+ * An empty memo disables memoization.
+ */
+CELER_FUNCTION SenseCalculator::SenseCalculator(const Surfaces& surfaces,
+                                                const Real3&    pos,
+                                                Span<Sense>     storage,
+                                                Span<SenseMemo> memo)
+    : surfaces_(surfaces), pos_(pos), sense_storage_(storage), memo_(memo)
+{
+    CELER_EXPECT(memo_.empty() || memo_.size() >= surfaces_.num_surfaces());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate senses for the given volume.
@@ -93,6 +129,18 @@ SenseCalculator::operator()(const VolumeView& vol, OnFace face) const
     // Build a functor to calculate the sense of a surface ID given the current
     // state position
     auto calc_sense = make_surface_action(surfaces_, CalcSense{pos_});
+    auto calc_memo_sense = [this, &calc_sense](SurfaceId sid) {
+        if (memo_.empty())
+        {
+            return calc_sense(sid);
+        }
+        SenseMemo& memo = memo_[sid.unchecked_get()];
+        if (memo == SenseMemo::unknown)
+        {
+            memo = to_sense_memo(calc_sense(sid));
+        }
+        return to_signed_sense(memo);
+    };
 
     // Fill the temp logic vector with values for all surfaces in the cell
     for (FaceId cur_face : range(FaceId{vol.num_faces()}))
@@ -101,7 +149,7 @@ SenseCalculator::operator()(const VolumeView& vol, OnFace face) const
         if (cur_face != face.id())
         {
             // Calculate sense
-            SignedSense ss = calc_sense(vol.get_surface(cur_face));
+            SignedSense ss = calc_memo_sense(vol.get_surface(cur_face));
             cur_sense      = to_sense(ss);
             if (!result.face && ss == SignedSense::on)
             {
@@ -122,6 +170,38 @@ SenseCalculator::operator()(const VolumeView& vol, OnFace face) const
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the memoized senses of a volume's faces.
+ */
+CELER_FUNCTION void SenseCalculator::clear_memo(const VolumeView& vol) const
+{
+    if (memo_.empty())
+    {
+        return;
+    }
+    for (SurfaceId sid : vol.faces())
+    {
+        memo_[sid.unchecked_get()] = SenseMemo::unknown;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset all memoized senses.
+ */
+CELER_FUNCTION void SenseCalculator::clear_memo() const
+{
+    if (memo_.empty())
+    {
+        return;
+    }
+    for (SenseMemo& memo : memo_.first(surfaces_.num_surfaces()))
+    {
+        memo = SenseMemo::unknown;
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -176,16 +176,19 @@ struct TempNextFace
  * except for the temporary storage references.
  *
  * The temporary vectors should be sufficient to store all the senses and
- * intersections in any cell.
+ * intersections in any cell. The surface sense memo has one entry per local
+ * surface and must be "unknown" on entry; trackers that use it restore it
+ * before returning.
  */
 struct LocalState
 {
-    Real3        pos;
-    Real3        dir;
-    VolumeId     volume;
-    OnSurface    surface;
-    Span<Sense>  temp_sense;
-    TempNextFace temp_next;
+    Real3           pos;
+    Real3           dir;
+    VolumeId        volume;
+    OnSurface       surface;
+    Span<Sense>     temp_sense;
+    Span<SenseMemo> temp_surf_sense;
+    TempNextFace    temp_next;
 };
 
 //---------------------------------------------------------------------------//
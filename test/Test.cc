@@ -131,9 +131,10 @@ bool Test::strict_testing()
 }
 
 //---------------------------------------------------------------------------//
-// Provide a definition for the "inf" value. (This is needed by C++ < 17 so
+// Provide definitions for the static values. (This is needed by C++ < 17 so
 // that the adddress off the static value can be taken.)
 constexpr double Test::inf;
+constexpr double Test::coarse_eps;
 
 //---------------------------------------------------------------------------//
 } // namespace test
@@ -11,6 +11,8 @@
 #include <string>
 #include <gtest/gtest.h>
 
+#include "celeritas_config.h"
+
 namespace celeritas
 {
 namespace test
@@ -38,6 +40,10 @@ class Test : public ::testing::Test
     // Define "inf" value for subclass testing
     static constexpr double inf = HUGE_VAL;
 
+    // Relative tolerance for results computed in real_type arithmetic
+    static constexpr double coarse_eps
+        = CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-12 : 1e-5;
+
   private:
     int filename_counter_ = 0;
 };
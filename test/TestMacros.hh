@@ -57,6 +57,13 @@
 #    define TEST_IF_CELERITAS_DEBUG(name) DISABLED_##name
 #endif
 
+//! Construct a test name that is disabled when real_type is not double
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+#    define TEST_IF_CELERITAS_DOUBLE(name) name
+#else
+#    define TEST_IF_CELERITAS_DOUBLE(name) DISABLED_##name
+#endif
+
 //! Construct a test name that is disabled when CUDA/HIP are disabled
 #if CELER_USE_DEVICE
 #    define TEST_IF_CELER_DEVICE(name) name
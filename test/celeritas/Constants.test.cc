@@ -26,7 +26,7 @@ namespace test
 {
 //---------------------------------------------------------------------------//
 
-TEST(ConstantsTest, mathematical)
+TEST(ConstantsTest, TEST_IF_CELERITAS_DOUBLE(mathematical))
 {
     EXPECT_DOUBLE_EQ(euler, std::exp(1.0));
     EXPECT_DOUBLE_EQ(pi, std::acos(-1.0));
@@ -35,13 +35,13 @@ TEST(ConstantsTest, mathematical)
 }
 
 //! Test that no precision is lost for cm<->m and other integer factors.
-TEST(ConstantsTest, exact_equivalence)
+TEST(ConstantsTest, TEST_IF_CELERITAS_DOUBLE(exact_equivalence))
 {
     EXPECT_EQ(299792458e2, c_light);     // cm/s
     EXPECT_EQ(6.62607015e-27, h_planck); // erg
 }
 
-TEST(ConstantsTest, formulas)
+TEST(ConstantsTest, TEST_IF_CELERITAS_DOUBLE(formulas))
 {
     EXPECT_SOFT_NEAR(e_electron * e_electron
                          / (2 * alpha_fine_structure * h_planck * c_light),
@@ -106,7 +106,7 @@ namespace units
 namespace test
 {
 //---------------------------------------------------------------------------//
-TEST(UnitsTest, equivalence)
+TEST(UnitsTest, TEST_IF_CELERITAS_DOUBLE(equivalence))
 {
     EXPECT_DOUBLE_EQ(ampere * ampere * second * second * second * second
                          / (kilogram * meter * meter),
@@ -47,10 +47,9 @@ std::string gdml_filename(const char* basename)
 }
 
 //---------------------------------------------------------------------------//
-ImportData load_import_data(std::string filename)
+ImportData
+load_import_data(std::string filename, const GeantPhysicsOptions& options)
 {
-    GeantPhysicsOptions options;
-    options.em_bins_per_decade = 14;
     GeantImporter import(GeantSetup(filename, options));
     return import();
 }
@@ -173,8 +172,12 @@ auto GeantTestBase::build_physics() -> SPConstPhysics
         input.particles, input.materials, process_data, brem_options));
     if (this->enable_msc())
     {
+        MultipleScatteringProcess::Options msc_options;
+        msc_options.electron_step_limit = this->msc_step_limit();
+        msc_options.positron_step_limit = this->msc_step_limit();
+
         input.processes.push_back(std::make_shared<MultipleScatteringProcess>(
-            input.particles, input.materials, process_data));
+            input.particles, input.materials, process_data, msc_options));
     }
     return std::make_shared<PhysicsParams>(std::move(input));
 }
@@ -203,6 +206,14 @@ auto GeantTestBase::build_physics_options() const -> PhysicsOptions
     return options;
 }
 
+//---------------------------------------------------------------------------//
+auto GeantTestBase::build_geant_options() const -> GeantPhysicsOptions
+{
+    GeantPhysicsOptions options;
+    options.em_bins_per_decade = 14;
+    return options;
+}
+
 //---------------------------------------------------------------------------//
 // Lazily set up and load geant4
 auto GeantTestBase::imported_data() const -> const ImportData&
@@ -219,8 +230,10 @@ auto GeantTestBase::imported_data() const -> const ImportData&
                        << "Geant4 currently crashes on second G4RunManager "
                           "instantiation (see issue #462)");
         // Note: importing may crash if Geant4 has an error
-        i.imported          = load_import_data(this->test_data_path(
-            "celeritas", gdml_filename(cur_basename.c_str()).c_str()));
+        i.imported          = load_import_data(
+            this->test_data_path("celeritas",
+                                 gdml_filename(cur_basename.c_str()).c_str()),
+            this->build_geant_options());
         // Save basename *after* load
         i.geometry_basename = cur_basename;
     }
@@ -15,6 +15,7 @@
 
 namespace celeritas
 {
+struct GeantPhysicsOptions;
 struct ImportData;
 struct PhysicsParamsOptions;
 } // namespace celeritas
@@ -49,6 +50,12 @@ class GeantTestBase : virtual public GlobalGeoTestBase
     virtual bool      combined_brems() const         = 0;
     virtual real_type secondary_stack_factor() const = 0;
 
+    //! MSC step limitation algorithm for electrons and positrons
+    virtual MscStepLimitAlgorithm msc_step_limit() const
+    {
+        return MscStepLimitAlgorithm::safety;
+    }
+
     SPConstMaterial    build_material() override;
     SPConstGeoMaterial build_geomaterial() override;
     SPConstParticle    build_particle() override;
@@ -58,6 +65,9 @@ class GeantTestBase : virtual public GlobalGeoTestBase
 
     virtual PhysicsOptions build_physics_options() const;
 
+    // Geant4 setup options (only the first fixture in a process is loaded)
+    virtual GeantPhysicsOptions build_geant_options() const;
+
     // Access lazily (re)loaded static geant4 data
     const ImportData& imported_data() const;
 };
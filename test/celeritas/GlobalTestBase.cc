@@ -62,6 +62,8 @@ auto GlobalTestBase::build_core() -> SPConstCore
     inp.along_step  = this->along_step();
     inp.rng         = this->rng();
     inp.action_reg  = this->action_reg();
+    inp.transparent_boundaries = this->transparent_boundaries();
+    inp.navigation_batch_size  = this->navigation_batch_size();
     CELER_ASSERT(inp);
     return std::make_shared<CoreParams>(std::move(inp));
 }
@@ -12,6 +12,7 @@
 #include <string>
 
 #include "corecel/Assert.hh"
+#include "corecel/Types.hh"
 #include "celeritas/geo/GeoParamsFwd.hh"
 #include "celeritas/random/RngParamsFwd.hh"
 
@@ -117,6 +118,11 @@ class GlobalTestBase : public Test
     virtual SPConstPhysics     build_physics()     = 0;
     virtual SPConstAction      build_along_step()  = 0;
 
+    //! Whether neutral particles pass through same-material boundaries
+    virtual bool transparent_boundaries() const { return false; }
+    //! Number of host tracks per navigation batch (zero to disable)
+    virtual size_type navigation_batch_size() const { return 0; }
+
   private:
     SPConstRng      build_rng() const;
     SPActionRegistry build_action_reg() const;
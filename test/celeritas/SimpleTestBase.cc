@@ -7,10 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "SimpleTestBase.hh"
 
+#include <random>
+
+#include "corecel/cont/Range.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/process/ComptonProcess.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/ClearSecondariesAction.hh"
 #include "celeritas/global/alongstep/AlongStepNeutralAction.hh"
 #include "celeritas/io/ImportProcess.hh"
 #include "celeritas/mat/MaterialParams.hh"
@@ -19,11 +23,55 @@
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/PhysicsParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
 
 namespace celeritas
 {
 namespace test
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Make isotropic 1 MeV gammas in the center of the detector.
+ *
+ * Consecutive primaries are grouped into events of \c per_event tracks.
+ */
+std::vector<Primary>
+SimpleTestBase::make_isotropic_gammas(size_type count,
+                                      size_type per_event) const
+{
+    CELER_EXPECT(per_event > 0);
+
+    Primary p;
+    p.particle_id = this->particle()->find(pdg::gamma());
+    CELER_ASSERT(p.particle_id);
+    p.energy   = units::MevEnergy{1};
+    p.position = {0, 0, 0};
+    p.time     = 0;
+
+    std::vector<Primary>    result(count, p);
+    IsotropicDistribution<> sample_dir;
+    std::mt19937            rng;
+    for (auto i : range(count))
+    {
+        result[i].event_id  = EventId{i / per_event};
+        result[i].track_id  = TrackId{i % per_event};
+        result[i].direction = sample_dir(rng);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Discard secondaries at the end of each step.
+ */
+void SimpleTestBase::insert_clear_secondaries()
+{
+    auto& action_reg = *this->action_reg();
+    action_reg.insert(std::make_shared<ClearSecondariesAction>(
+        action_reg.next_id(), "clear-secondaries", "discard secondaries"));
+}
+
 //---------------------------------------------------------------------------//
 auto SimpleTestBase::build_material() -> SPConstMaterial
 {
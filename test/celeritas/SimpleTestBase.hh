@@ -7,12 +7,16 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 
 #include "GlobalGeoTestBase.hh"
 
 namespace celeritas
 {
+struct Primary;
+
 namespace test
 {
 //---------------------------------------------------------------------------//
@@ -22,6 +26,13 @@ namespace test
 class SimpleTestBase : virtual public GlobalGeoTestBase
 {
   protected:
+    // Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary>
+    make_isotropic_gammas(size_type count, size_type per_event = 1) const;
+
+    // Discard secondaries, since electrons cannot be transported
+    void insert_clear_secondaries();
+
     const char* geometry_basename() const override { return "two-boxes"; }
 
     virtual real_type secondary_stack_factor() const { return 1.0; }
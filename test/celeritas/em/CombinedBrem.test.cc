@@ -170,6 +170,7 @@ TEST_F(CombinedBremTest, basic_seltzer_berger)
     EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
 
     // Note: these are "gold" values based on the host RNG.
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_angle[] = {0.959441513277674,
                                      0.994350429950924,
                                      0.968866136008621,
@@ -179,6 +180,12 @@ TEST_F(CombinedBremTest, basic_seltzer_berger)
                                       0.0316182310804369,
                                       0.0838794010486177,
                                       0.106195186929141};
+#else
+    const double expected_angle[] = {
+        0.97385364770889, 0.80490833520889, 0.9999588727951, -0.18801872432232};
+    const double expected_energy[] = {
+        0.48727408051491, 0.240134075284, 0.038054831326008, 0.46071639657021};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_angle, angle);
 
@@ -238,6 +245,7 @@ TEST_F(CombinedBremTest, basic_relativistic_brem)
 
     // Note: these are "gold" values based on the host RNG.
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy[] = {
         18844.5999305425, 42.185863858534, 3991.9107959354, 212.273682952066};
 
@@ -245,6 +253,11 @@ TEST_F(CombinedBremTest, basic_relativistic_brem)
                                      0.999999999587026,
                                      0.999999999684891,
                                      0.999999999474844};
+#else
+    const double expected_energy[]
+        = {4649.4677734375, 11386.349609375, 35.620674133301, 11.57880115509};
+    const double expected_angle[] = {1, 0.99999994039536, 1, 0.99999994039536};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_angle, angle);
@@ -320,6 +333,7 @@ TEST_F(CombinedBremTest, stress_test_combined)
     }
 
     // Gold values for average number of calls to RNG
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     static const double expected_avg_engine_samples[] = {14.088,
                                                          13.2402,
                                                          12.9641,
@@ -356,6 +370,18 @@ TEST_F(CombinedBremTest, stress_test_combined)
                                                          917.61799096706,
                                                          10758.713294023,
                                                          146932.68621334};
+#else
+    static const double expected_avg_engine_samples[] = {
+        7.039575, 6.6134, 6.46615, 6.2891, 6.2482, 6.16565, 6.21695, 6.63695,
+        7.6764, 7.11505, 6.6369, 6.4705, 6.2924, 6.2417, 6.1728, 6.2157,
+        6.63655, 7.65945};
+    static const double expected_avg_energy_samples[] = {
+        0.20235775802839, 0.54050938753001, 1.0138825299462, 4.3590290814817,
+        8.5447179004919, 84.635031741308, 913.95603155624, 10841.991148005,
+        147677.04509902, 0.19289848808148, 0.52538842238081, 0.98227838823795,
+        4.4954330886306, 8.5248056515914, 85.049464243638, 901.81195694801,
+        10755.188917846, 148191.35379674};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
     EXPECT_VEC_SOFT_EQ(expected_avg_energy_samples, avg_energy_samples);
@@ -79,7 +79,7 @@ class EPlusGGInteractorTest : public InteractorHostTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(EPlusGGInteractorTest, basic)
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(basic))
 {
     const int num_samples = 4;
 
@@ -174,7 +174,7 @@ TEST_F(EPlusGGInteractorTest, at_rest)
     }
 }
 
-TEST_F(EPlusGGInteractorTest, stress_test)
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     const int           num_samples = 8192;
     std::vector<double> avg_engine_samples;
@@ -223,7 +223,7 @@ TEST_F(EPlusGGInteractorTest, stress_test)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
-TEST_F(EPlusGGInteractorTest, macro_xs)
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(macro_xs))
 {
     using units::MevEnergy;
 
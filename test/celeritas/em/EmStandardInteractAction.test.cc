@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/EmStandardInteractAction.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/em/generated/EmStandardInteractAction.hh"
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/StepperTestBase.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::generated::EmStandardInteractAction;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EmStandardInteractActionTest : public SimpleTestBase,
+                                     public StepperTestBase
+{
+  public:
+    EmStandardInteractActionTest()
+    {
+        this->insert_clear_secondaries();
+    }
+
+    //! Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    //! Replace the Klein-Nishina action with the fused action
+    void insert_fused_action()
+    {
+        auto& action_reg = *this->action_reg();
+        action_reg.insert(std::make_shared<EmStandardInteractAction>(
+            action_reg.next_id(), *this->physics()));
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EmStandardInteractActionTest, setup)
+{
+    EXPECT_VEC_EQ((std::vector<std::string>{"pre-step",
+                                            "along-step-neutral",
+                                            "physics-discrete-select",
+                                            "scat-klein-nishina",
+                                            "geo-boundary",
+                                            "dummy-action",
+                                            "clear-secondaries"}),
+                  this->check_setup().actions);
+
+    this->insert_fused_action();
+    auto result = this->check_setup();
+    EXPECT_VEC_EQ((std::vector<std::string>{"pre-step",
+                                            "along-step-neutral",
+                                            "physics-discrete-select",
+                                            "interact-em-standard",
+                                            "geo-boundary",
+                                            "dummy-action",
+                                            "clear-secondaries"}),
+                  result.actions);
+}
+
+TEST_F(EmStandardInteractActionTest, host)
+{
+    size_type num_primaries = 1024;
+    size_type num_tracks    = 1024;
+
+    RunResult expected;
+    {
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 2));
+        expected = this->run(step, num_primaries);
+    }
+    ASSERT_TRUE(expected);
+    // Some gammas must scatter in the detector before leaving the world
+    EXPECT_LT(2, expected.calc_avg_steps_per_primary());
+
+    this->insert_fused_action();
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 2));
+    auto                    result = this->run(step, num_primaries);
+
+    // Fusing must not change the physics
+    EXPECT_VEC_EQ(expected.active, result.active);
+    EXPECT_VEC_EQ(expected.queued, result.queued);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
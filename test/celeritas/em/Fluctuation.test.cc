@@ -162,7 +162,7 @@ TEST_F(EnergyLossDistributionTest, none)
     EXPECT_EQ(0, rng.count());
 }
 
-TEST_F(EnergyLossDistributionTest, gaussian)
+TEST_F(EnergyLossDistributionTest, TEST_IF_CELERITAS_DOUBLE(gaussian))
 {
     ParticleTrackView particle(
         particles->host_ref(), particle_state.ref(), ThreadId{0});
@@ -234,7 +234,7 @@ TEST_F(EnergyLossDistributionTest, gaussian)
     EXPECT_EQ(41006, rng.count());
 }
 
-TEST_F(EnergyLossDistributionTest, urban)
+TEST_F(EnergyLossDistributionTest, TEST_IF_CELERITAS_DOUBLE(urban))
 {
     ParticleTrackView particle(
         particles->host_ref(), particle_state.ref(), ThreadId{0});
@@ -5,6 +5,9 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/em/ImportedProcesses.test.cc
 //---------------------------------------------------------------------------//
+#include <algorithm>
+
+#include "celeritas/em/NativeEmTableBuilder.hh"
 #include "celeritas/em/process/BremsstrahlungProcess.hh"
 #include "celeritas/em/process/ComptonProcess.hh"
 #include "celeritas/em/process/EIonizationProcess.hh"
@@ -98,6 +101,42 @@ TEST_F(ImportedProcessesTest, compton)
     }
 }
 
+TEST_F(ImportedProcessesTest, compton_native)
+{
+    // Find the exported Compton tables
+    auto ip_id = processes_->find({pdg::gamma(), ImportProcessClass::compton});
+    ASSERT_TRUE(ip_id);
+    const ImportProcess& exported = processes_->get(ip_id);
+
+    // Generate them without Geant4
+    NativeEmTableBuilder build(particles_, materials_);
+    ImportProcess        native = build(ImportProcessClass::compton);
+    ASSERT_EQ(exported.tables.size(), native.tables.size());
+
+    for (const ImportPhysicsTable& expected : exported.tables)
+    {
+        auto actual = std::find_if(
+            native.tables.begin(),
+            native.tables.end(),
+            [&expected](const ImportPhysicsTable& t) {
+                return t.table_type == expected.table_type;
+            });
+        ASSERT_NE(native.tables.end(), actual)
+            << "missing " << to_cstring(expected.table_type);
+        EXPECT_EQ(expected.y_units, actual->y_units);
+        ASSERT_EQ(expected.physics_vectors.size(),
+                  actual->physics_vectors.size());
+
+        for (auto i : range(expected.physics_vectors.size()))
+        {
+            const auto& exp_vec = expected.physics_vectors[i];
+            const auto& act_vec = actual->physics_vectors[i];
+            EXPECT_VEC_SOFT_EQ(exp_vec.x, act_vec.x);
+            EXPECT_VEC_NEAR(exp_vec.y, act_vec.y, 1e-6);
+        }
+    }
+}
+
 TEST_F(ImportedProcessesTest, e_ionization)
 {
     EIonizationProcess::Options options;
@@ -225,7 +264,10 @@ TEST_F(ImportedProcessesTest, msc)
 {
     // Create Multiple scattering process
     auto process = std::make_shared<MultipleScatteringProcess>(
-        particles_, materials_, processes_);
+        particles_,
+        materials_,
+        processes_,
+        MultipleScatteringProcess::Options{});
 
     // Test model
     auto models = process->build_models(ActionIdIter{});
@@ -123,6 +123,7 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
     EXPECT_EQ(4, this->secondary_allocator().get().size());
 
     // Note: these are "gold" values based on the host RNG.
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy[]
         = {0.4581502636229, 1.325852509857, 9.837250571445, 0.5250297816972};
     const double expected_costheta[] = {
@@ -131,6 +132,17 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
         = {9.541849736377, 8.674147490143, 0.1627494285554, 9.474970218303};
     const double expected_costheta_electron[]
         = {0.998962567429, 0.9941635460938, 0.3895748042313, 0.9986216572142};
+#else
+    const double expected_energy[]
+        = {6.0639214515686, 0.27948331832886, 3.2050406932831, 4.9878907203674};
+    const double expected_costheta[] = {
+        0.96683114767075, -0.77727031707764, 0.89166384935379,
+        0.94865196943283};
+    const double expected_energy_electron[]
+        = {3.9360785484314, 9.720516204834, 6.7949590682983, 5.0121092796326};
+    const double expected_costheta_electron[] = {
+        0.93652468919754, 0.99985194206238, 0.97998303174973, 0.95796078443527};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
     EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
@@ -189,8 +201,13 @@ TEST_F(KleinNishinaInteractorTest, stress_test)
 
     // PRINT_EXPECTED(avg_engine_samples);
     // Gold values for average number of calls to RNG
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_avg_engine_samples[]
         = {10.99816894531, 9.483154296875, 8.295532226562, 8.00439453125};
+#else
+    const double expected_avg_engine_samples[]
+        = {5.5062255859375, 4.753662109375, 4.1458435058594, 4.0023803710938};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
@@ -238,10 +255,17 @@ TEST_F(KleinNishinaInteractorTest, distributions)
     EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
     // PRINT_EXPECTED(eps_dist);
     // PRINT_EXPECTED(costheta_dist);
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const int expected_eps_dist[]
         = {0, 0, 2010, 1365, 1125, 1067, 1077, 1066, 1123, 1167};
     const int expected_costheta_dist[]
         = {495, 459, 512, 528, 565, 701, 803, 1101, 1693, 3143};
+#else
+    const int expected_eps_dist[]
+        = {0, 0, 2067, 1358, 1138, 1045, 1042, 1049, 1147, 1154};
+    const int expected_costheta_dist[]
+        = {503, 495, 535, 512, 564, 685, 828, 1084, 1669, 3125};
+#endif
     EXPECT_VEC_EQ(expected_eps_dist, eps_dist);
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
 }
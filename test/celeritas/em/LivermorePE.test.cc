@@ -109,8 +109,15 @@ class LivermorePETest : public InteractorHostTestBase
             const auto& electron = interaction.secondaries.front();
             EXPECT_TRUE(electron);
             EXPECT_EQ(model_->host_ref().ids.electron, electron.particle_id);
+            // The binding energy at high energy can be below
+            // single-precision resolution
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
             EXPECT_GT(this->particle_track().energy().value(),
                       electron.energy.value());
+#else
+            EXPECT_GE(this->particle_track().energy().value(),
+                      electron.energy.value());
+#endif
             EXPECT_LT(0, electron.energy.value());
             EXPECT_SOFT_EQ(1.0, norm(electron.direction));
         }
@@ -184,12 +191,24 @@ TEST_F(LivermorePETest, basic)
     EXPECT_EQ(4, this->secondary_allocator().get().size());
 
     // Note: these are "gold" values based on the host RNG.
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy_electron[]
         = {0.00062884, 0.00062884, 0.00070136, 0.00069835};
     const double expected_costheta_electron[] = {
         0.1217302869581, 0.8769397871407, -0.1414717733267, -0.2414106440617};
     const double expected_energy_deposition[]
         = {0.00037116, 0.00037116, 0.00029864, 0.00030165};
+#else
+    const double expected_energy_electron[] = {
+        0.00070136005524546, 0.0006983500206843, 0.00097625004127622,
+        0.00070136005524546};
+    const double expected_costheta_electron[] = {
+        -0.048117764294147, 0.19282042980194, 0.39132106304169,
+        -0.027694225311279};
+    const double expected_energy_deposition[] = {
+        0.00029863999225199, 0.00030164999770932, 2.3750000764267e-05,
+        0.00029863999225199};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
     EXPECT_VEC_SOFT_EQ(expected_costheta_electron, costheta_electron);
     EXPECT_VEC_SOFT_EQ(expected_energy_deposition, energy_deposition);
@@ -274,8 +293,13 @@ TEST_F(LivermorePETest, stress_test)
     }
 
     // Gold values
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_avg_engine_samples[]
         = {15.99755859375, 16.09204101562, 13.79919433594, 8.590209960938, 2};
+#else
+    const double expected_avg_engine_samples[] = {
+        7.9705200195312, 8.0143432617188, 6.9155883789062, 4.292724609375, 1};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 
     const double expected_avg_num_secondaries[] = {1, 1, 1, 1, 1};
@@ -288,11 +312,17 @@ TEST_F(LivermorePETest, stress_test)
                                           1.183012701892};
     EXPECT_VEC_SOFT_EQ(expected_avg_cosine, expected_avg_cosine);
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_avg_energy[] = {7.287875885011e-05,
                                           0.006708485731503,
                                           0.9967066970311,
                                           9.996704339284,
                                           999.9967069717};
+#else
+    const double expected_avg_energy[] = {
+        7.2903810797387e-05, 0.0067213492719986, 0.99669744251878,
+        9.9966985538485, 999.99668502249};
+#endif
     EXPECT_VEC_SOFT_EQ(expected_avg_energy, avg_energy);
 }
 
@@ -369,13 +399,18 @@ TEST_F(LivermorePETest, distributions_all)
         }
     }
     EXPECT_EQ(secondary_size, this->secondary_allocator().get().size());
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_EQ(2180, num_secondaries);
+#else
+    EXPECT_EQ(2130, num_secondaries);
+#endif
 
     for (const auto& it : energy_to_count)
     {
         energy.push_back(it.first);
         count.push_back(it.second);
     }
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_costheta_dist[]
         = {23, 61, 83, 129, 135, 150, 173, 134, 85, 27};
     const double expected_energy[] = {
@@ -389,8 +424,22 @@ TEST_F(LivermorePETest, distributions_all)
     const int expected_count[] = {
         42, 80, 26,  24, 27, 54, 2, 5, 5,  5, 4,   141, 61,  3,  2,  169, 260,
         1,  39, 195, 2,  8,  5,  3, 2, 14, 1, 280, 216, 424, 32, 16, 32};
+#else
+    const double expected_costheta_dist[]
+        = {27, 70, 109, 116, 147, 133, 131, 124, 98, 45};
+    const double expected_energy[] = {
+        2.901e-05, 3.202e-05, 4.576e-05, 4.604e-05, 4.877e-05, 4.905e-05,
+        6.529e-05, 6.83e-05, 0.00021764, 0.00022065, 0.00023439, 0.00023467,
+        0.0002374, 0.00023768, 0.00025142, 0.0002517, 0.00025415, 0.00025443,
+        0.00025471, 0.00025814, 0.00027095, 0.00027368, 0.00029016, 0.00030691,
+        0.00030719, 0.00062884, 0.00069835, 0.00070136, 0.0009595, 0.00097625,
+        0.00097653, 0.00099578};
+    const int expected_count[] = {
+        36, 81, 24, 20, 21, 42, 2, 6, 9, 2, 5, 125, 53, 6, 175, 267, 50, 173, 6,
+        2, 8, 7, 1, 6, 3, 242, 215, 441, 40, 28, 33, 1};
+#endif
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
-    EXPECT_VEC_SOFT_EQ(expected_energy, energy);
+    EXPECT_VEC_NEAR(expected_energy, energy, coarse_eps);
     EXPECT_VEC_EQ(expected_count, count);
 }
 
@@ -454,13 +503,18 @@ TEST_F(LivermorePETest, distributions_radiative)
         }
     }
     EXPECT_EQ(secondary_size, this->secondary_allocator().get().size());
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_EQ(10007, num_secondaries);
+#else
+    EXPECT_EQ(10005, num_secondaries);
+#endif
 
     for (const auto& it : energy_to_count)
     {
         energy.push_back(it.first);
         count.push_back(it.second);
     }
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy[] = {
         6.951e-05,
         0.00025814,
@@ -477,7 +531,13 @@ TEST_F(LivermorePETest, distributions_radiative)
     };
     const int expected_count[]
         = {2, 1, 1, 1, 2, 2525, 2228, 4358, 337, 181, 361, 10};
-    EXPECT_VEC_SOFT_EQ(expected_energy, energy);
+#else
+    const double expected_energy[] = {
+        7.252e-05, 0.00025814, 0.00026115, 0.00062884, 0.00069835, 0.00070136,
+        0.0009595, 0.00097625, 0.00097653, 0.00099578};
+    const int expected_count[] = {1, 3, 1, 2547, 2233, 4332, 323, 189, 367, 9};
+#endif
+    EXPECT_VEC_NEAR(expected_energy, energy, coarse_eps);
     EXPECT_VEC_EQ(expected_count, count);
 }
 
@@ -511,7 +571,7 @@ TEST_F(LivermorePETest, macro_xs)
            6.653075041804e-11, 1.971081007251e-11, 5.85857761177e-12,
            1.743005702864e-12, 5.187166124179e-13, 1.543827005416e-13,
            4.594922185898e-14, 1.367605938008e-14};
-    EXPECT_VEC_SOFT_EQ(expected_macro_xs, macro_xs);
+    EXPECT_VEC_NEAR(expected_macro_xs, macro_xs, coarse_eps);
 }
 //---------------------------------------------------------------------------//
 } // namespace test
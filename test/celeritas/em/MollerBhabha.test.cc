@@ -62,9 +62,15 @@ class MollerBhabhaInteractorTest : public InteractorHostTestBase
 
     void sanity_check(const Interaction& interaction) const
     {
-        // Check change to parent track
+        // Check change to parent track (the energy loss at high energy can
+        // be below single-precision resolution)
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
         EXPECT_GT(this->particle_track().energy().value(),
                   interaction.energy.value());
+#else
+        EXPECT_GE(this->particle_track().energy().value(),
+                  interaction.energy.value());
+#endif
         EXPECT_LT(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, norm(interaction.direction));
         EXPECT_EQ(Action::scattered, interaction.action);
@@ -155,31 +161,63 @@ TEST_F(MollerBhabhaInteractorTest, basic)
 
     //// Moller
     // Gold values based on the host rng. Energies are in MeV
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_m_inc_exit_cost[]
         = {0.9981497250995, 0.999993612333, 0.999999995461, 0.9999999999998};
     const double expected_m_inc_exit_e[]
         = {0.9927116916645, 9.998622388005, 999.9911084469, 99999.99528134};
+#else
+    const double expected_m_inc_exit_cost[]
+        = {0.99972081184387, 0.99995255470276, 1, 0.99999994039536};
+    const double expected_m_inc_exit_e[]
+        = {0.99889624118805, 9.989767074585, 999.99896240234, 100000};
+#endif
     const double expected_m_inc_edep[] = {0, 0, 0, 0};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_m_sec_cost[] = {
         0.1196563201983, 0.03851909820188, 0.09291901073767, 0.06779325842364};
     const double expected_m_sec_e[] = {0.007288308335526,
                                        0.001377611995461,
                                        0.008891553104294,
                                        0.004718664979811};
+#else
+    const double expected_m_sec_cost[] = {
+        0.046705812215805, 0.10453170537949, 0.031967133283615,
+        0.04485397040844};
+    const double expected_m_sec_e[] = {
+        0.0011037767399102, 0.010233225300908, 0.0010443788487464,
+        0.0020602601580322};
+#endif
 
     //// Bhabha
     // Gold values based on the host rng. Energies are in MeV
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_b_inc_exit_cost[]
         = {0.9997453107903, 0.999994190499, 0.9999999989865, 0.9999999999999};
     const double expected_b_inc_exit_e[]
         = {0.9989928374838, 9.998747065072, 999.9980145461, 99999.99864983};
+#else
+    const double expected_b_inc_exit_cost[]
+        = {0.99973881244659, 0.99997538328171, 1, 1};
+    const double expected_b_inc_exit_e[]
+        = {0.99896788597107, 9.9946937561035, 999.99859619141, 99999.7890625};
+#endif
     const double expected_b_inc_edep[] = {0, 0, 0, 0};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_b_sec_cost[] = {
         0.04461708949452, 0.03673697288345, 0.04405602044159, 0.03632326062515};
     const double expected_b_sec_e[] = {0.001007162516187,
                                        0.001252934927768,
                                        0.001985453873814,
                                        0.001350170413359};
+#else
+    const double expected_b_sec_cost[] = {
+        0.045165486633778, 0.07545131444931, 0.036709994077682,
+        0.41208970546722};
+    const double expected_b_sec_e[] = {
+        0.0010320994770154, 0.0053060776554048, 0.0013777154963464,
+        0.20905221998692};
+#endif
 
     //// Moller
     EXPECT_VEC_SOFT_EQ(expected_m_inc_exit_cost, m_results.inc_exit_cost);
@@ -257,27 +295,55 @@ TEST_F(MollerBhabhaInteractorTest, cutoff_1MeV)
 
     //// Moller
     // Gold values based on the host rng. Energies are in MeV
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_m_inc_exit_cost[]
         = {0.9784675127353, 0.9997401875592, 0.9999953862586, 0.9999999997589};
     const double expected_m_inc_exit_e[]
         = {6.75726441249, 95.11275692125, 991.0427997072, 99995.28168559};
+#else
+    const double expected_m_inc_exit_cost[]
+        = {0.99442476034164, 0.99952125549316, 0.99999952316284, 1};
+    const double expected_m_inc_exit_e[]
+        = {8.9184904098511, 91.348701477051, 998.95568847656, 99997.9375};
+#endif
     const double expected_m_inc_edep[] = {0, 0, 0, 0};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_m_sec_cost[]
         = {0.9154612855963, 0.91405872098, 0.9478947756541, 0.9066254320384};
     const double expected_m_sec_e[]
         = {3.24273558751, 4.887243078746, 8.957200292789, 4.718314414109};
+#else
+    const double expected_m_sec_cost[]
+        = {0.7527888417244, 0.9505203962326, 0.7112734913826, 0.81757408380508};
+    const double expected_m_sec_e[]
+        = {1.0815094709396, 8.6512985229492, 1.0442863702774, 2.0602164268494};
+#endif
 
     //// Bhabha
     // Gold values based on the host rng. Energies are in MeV
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_b_inc_exit_cost[]
         = {0.9774788335858, 0.9999472046111, 0.9999992012865, 0.999999999931};
     const double expected_b_inc_exit_e[]
         = {6.654742369665, 98.96696134497, 998.4378016843, 99998.64983431};
+#else
+    const double expected_b_inc_exit_cost[] = {
+        0.99472510814667, 0.99972879886627, 0.99999934434891, 0.99999994039536};
+    const double expected_b_inc_exit_e[]
+        = {8.971173286438, 94.91089630127, 998.62280273438, 99791.3828125};
+#endif
     const double expected_b_inc_edep[] = {0, 0, 0, 0};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_b_sec_cost[]
         = {0.9188415916986, 0.7126175077086, 0.777906053136, 0.7544377929863};
     const double expected_b_sec_e[]
         = {3.345257630335, 1.033038655033, 1.562198315728, 1.350165690206};
+#else
+    const double expected_b_sec_cost[] = {
+        0.74359583854675, 0.91721034049988, 0.75803112983704, 0.99756443500519};
+    const double expected_b_sec_e[]
+        = {1.0288265943527, 5.0891065597534, 1.3771959543228, 208.61860656738};
+#endif
 
     //// Moller
     EXPECT_VEC_SOFT_EQ(expected_m_inc_exit_cost, m_results.inc_exit_cost);
@@ -361,6 +427,7 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
     }
 
     // Gold values for average number of calls to rng
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_avg_engine_samples[] = {20.8046,
                                                   13.2538,
                                                   9.5695,
@@ -371,6 +438,11 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
                                                   7.1706,
                                                   7.0299,
                                                   7.0079};
+#else
+    const double expected_avg_engine_samples[] = {
+        10.4168, 6.61395, 4.7698, 4.5915, 4.5959, 283.15125, 4.35485, 3.57575,
+        3.5211, 3.5034};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
@@ -0,0 +1,274 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/NativeEmTableBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/em/NativeEmTableBuilder.hh"
+
+#include <cmath>
+
+#include "celeritas/Constants.hh"
+#include "celeritas/em/process/ComptonProcess.hh"
+#include "celeritas/em/xs/KleinNishinaMicroXsCalculator.hh"
+#include "celeritas/phys/ImportedProcessAdapter.hh"
+#include "celeritas/phys/InteractorHostTestBase.hh"
+#include "celeritas/phys/Model.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class NativeEmTableBuilderTest : public InteractorHostTestBase
+{
+  protected:
+    using MevEnergy = units::MevEnergy;
+
+    void SetUp() override
+    {
+        using namespace units;
+        using namespace constants;
+
+        MaterialParams::Input mi;
+        mi.elements  = {{1, AmuMass{1.008}, "H"},
+                       {8, AmuMass{15.999}, "O"},
+                       {26, AmuMass{55.845}, "Fe"},
+                       {82, AmuMass{207.2}, "Pb"}};
+        mi.materials = {
+            {0.1 * na_avogadro,
+             293.,
+             MatterState::solid,
+             {{ElementId{0}, 2.0 / 3.0}, {ElementId{1}, 1.0 / 3.0}},
+             "H2O"},
+            {0.14 * na_avogadro,
+             293.,
+             MatterState::solid,
+             {{ElementId{2}, 1.0}},
+             "Fe"},
+            {0.05 * na_avogadro,
+             293.,
+             MatterState::solid,
+             {{ElementId{3}, 1.0}},
+             "Pb"},
+        };
+        this->set_material_params(mi);
+    }
+
+    //! Total Klein-Nishina cross section for a free electron [b]
+    static double free_electron_xs(double energy)
+    {
+        using constants::r_electron;
+        const double k = energy / 0.51099895;
+        const double l = std::log(1 + 2 * k);
+        return 2 * constants::pi * r_electron * r_electron / units::barn
+               * ((1 + k) / (k * k) * (2 * (1 + k) / (1 + 2 * k) - l / k)
+                  + l / (2 * k) - (1 + 3 * k) / ((1 + 2 * k) * (1 + 2 * k)));
+    }
+
+    real_type calc_micro_xs(ElementId el, double energy) const
+    {
+        const auto& particles = *this->particle_params();
+        KleinNishinaMicroXsCalculator calc_xs(
+            particles.get(particles.find(pdg::electron())).mass(),
+            MevEnergy{energy});
+        return calc_xs(this->material_params()->get(el));
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(NativeEmTableBuilderTest, micro_xs)
+{
+    const double    energies[] = {1e-3, 1e-2, 0.1, 1, 10, 100};
+    const ElementId elements[] = {ElementId{0}, ElementId{2}, ElementId{3}};
+
+    std::vector<real_type> xs;
+    for (ElementId el : elements)
+    {
+        for (double e : energies)
+        {
+            xs.push_back(this->calc_micro_xs(el, e));
+        }
+    }
+
+    // clang-format off
+    const real_type expected_xs[] = {0.089908503299863, 0.45934761972575,
+        0.4929991919724, 0.21262802559737, 0.050570092174591,
+        0.0083063959821017, 1.0069880047218, 8.6112006054708, 12.020028647137,
+        5.5309009412599, 1.3182665113698, 0.21641098433654, 1.3256757684245,
+        14.822936352804, 34.029539871373, 17.461907643892, 4.1673195117195,
+        0.6825268975381};
+    // clang-format on
+    // The Klein-Nishina formula loses precision at low energy
+    EXPECT_VEC_NEAR(expected_xs,
+                    xs,
+                    CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-12
+                                                                      : 1e-4);
+
+    // The binding corrections are negligible at high energy, so the cross
+    // section should approach Z times the free-electron cross section
+    for (ElementId el : elements)
+    {
+        const int z = this->material_params()->get(el).atomic_number();
+        for (double e : {1.0, 10.0, 100.0})
+        {
+            EXPECT_SOFT_NEAR(z * free_electron_xs(e),
+                             this->calc_micro_xs(el, e),
+                             0.05)
+                << "Z=" << z << ", E=" << e;
+        }
+    }
+}
+
+TEST_F(NativeEmTableBuilderTest, compton)
+{
+    EXPECT_TRUE(NativeEmTableBuilder::is_supported(ImportProcessClass::compton));
+    EXPECT_FALSE(NativeEmTableBuilder::is_supported(ImportProcessClass::e_ioni));
+
+    NativeEmTableBuilder build(this->particle_params(),
+                               this->material_params());
+    ImportProcess        process = build(ImportProcessClass::compton);
+    ASSERT_TRUE(process);
+    EXPECT_EQ(pdg::gamma().get(), process.particle_pdg);
+    EXPECT_EQ(ImportProcessClass::compton, process.process_class);
+    ASSERT_EQ(2, process.tables.size());
+
+    const ImportPhysicsTable& lambda = process.tables[0];
+    EXPECT_EQ(ImportTableType::lambda, lambda.table_type);
+    EXPECT_EQ(ImportUnits::cm_inv, lambda.y_units);
+    const ImportPhysicsTable& lambda_prim = process.tables[1];
+    EXPECT_EQ(ImportTableType::lambda_prim, lambda_prim.table_type);
+    EXPECT_EQ(ImportUnits::cm_mev_inv, lambda_prim.y_units);
+
+    const auto& mats = *this->material_params();
+    ASSERT_EQ(mats.size(), lambda.physics_vectors.size());
+    ASSERT_EQ(mats.size(), lambda_prim.physics_vectors.size());
+    for (auto mat_id : range(MaterialId{mats.size()}))
+    {
+        const auto& lo = lambda.physics_vectors[mat_id.get()];
+        const auto& hi = lambda_prim.physics_vectors[mat_id.get()];
+
+        // Geant4 default grid: 7 bins per decade
+        ASSERT_EQ(29, lo.x.size());
+        ASSERT_EQ(57, hi.x.size());
+        EXPECT_EQ(ImportPhysicsVectorType::log, lo.vector_type);
+        EXPECT_SOFT_EQ(1e-4, lo.x.front());
+        EXPECT_EQ(1, lo.x.back());
+        EXPECT_EQ(1, hi.x.front());
+        EXPECT_SOFT_EQ(1e8, hi.x.back());
+        EXPECT_SOFT_EQ(std::pow(10.0, 1.0 / 7), lo.x[1] / lo.x[0]);
+
+        // Cross sections must be continuous across the two tables
+        EXPECT_SOFT_EQ(lo.y.back(), hi.y.front());
+
+        // Macroscopic cross section is the density-weighted sum
+        MaterialView mat   = mats.get(mat_id);
+        real_type    macro = 0;
+        for (auto i : range(mat.num_elements()))
+        {
+            ElementComponentId ec{i};
+            macro += mat.get_element_density(ec)
+                     * this->calc_micro_xs(mat.element_id(ec), 10.0)
+                     * units::barn;
+        }
+        const auto idx = 7; // 10 MeV
+        EXPECT_SOFT_EQ(10.0, hi.x[idx]);
+        EXPECT_SOFT_EQ(macro * 10, hi.y[idx]);
+    }
+
+    // Tables should be usable by the Compton process
+    auto imported = std::make_shared<ImportedProcesses>(
+        std::vector<ImportProcess>{std::move(process)});
+    ComptonProcess compton(this->particle_params(), imported);
+    auto           models = compton.build_models(Process::ActionIdIter{});
+    ASSERT_EQ(1, models.size());
+    Applicability applic = *models.front()->applicability().begin();
+    applic.material      = MaterialId{1};
+    auto builders        = compton.step_limits(applic);
+    EXPECT_TRUE(builders[ValueGridType::macro_xs]);
+    EXPECT_FALSE(builders[ValueGridType::energy_loss]);
+}
+
+// Compare against tables exported from Geant4 for the same material
+TEST_F(NativeEmTableBuilderTest, geant4_steel)
+{
+    using namespace units;
+
+    // G4_STAINLESS-STEEL from four-steel-slabs.gdml: 8 g/cm^3 by mass fraction
+    const double mass_frac[] = {0.746212874621521, 0.169001044311525,
+                                0.0847860810669534};
+    const double molar_mass[] = {55.845, 51.9961, 58.6934};
+    double       moles[3];
+    double       total_moles = 0;
+    for (auto i : range(3))
+    {
+        moles[i] = mass_frac[i] / molar_mass[i];
+        total_moles += moles[i];
+    }
+
+    MaterialParams::Input mi;
+    mi.elements  = {{26, AmuMass{molar_mass[0]}, "Fe"},
+                   {24, AmuMass{molar_mass[1]}, "Cr"},
+                   {28, AmuMass{molar_mass[2]}, "Ni"}};
+    mi.materials = {{8.0 * total_moles * constants::na_avogadro,
+                     293.15,
+                     MatterState::solid,
+                     {{ElementId{0}, moles[0] / total_moles},
+                      {ElementId{1}, moles[1] / total_moles},
+                      {ElementId{2}, moles[2] / total_moles}},
+                     "steel"}};
+    this->set_material_params(mi);
+
+    NativeEmTableBuilder build(this->particle_params(),
+                               this->material_params());
+    ImportProcess        process = build(ImportProcessClass::compton);
+    ASSERT_EQ(2, process.tables.size());
+    const auto& lo = process.tables[0].physics_vectors.front();
+    const auto& hi = process.tables[1].physics_vectors.front();
+    ASSERT_EQ(29, lo.y.size());
+    ASSERT_EQ(57, hi.y.size());
+
+    // Reference values from the Geant4 tables exported to
+    // four-steel-slabs.root: the full tables agree to 1.5e-6 relative
+    // except at 0.1 keV, where Geant4 returns zero below its
+    // parameterization limit
+    static const unsigned int lo_idx[] = {1u, 7u, 14u, 21u, 28u};
+    static const double       expected_lambda[] = {0.0026889375908310644,
+                                             0.08717809610885258,
+                                             0.7452923102668797,
+                                             1.0380329526664696,
+                                             0.47744974859269784};
+    static const unsigned int hi_idx[] = {7u, 14u, 28u, 42u, 56u};
+    static const double       expected_lambda_prim[] = {1.1379678764738417,
+                                                  1.8681337048212967,
+                                                  3.3454630906649307,
+                                                  4.823787506285325,
+                                                  6.302121887435451};
+    std::vector<double> lambda;
+    for (auto i : lo_idx)
+    {
+        lambda.push_back(lo.y[i]);
+    }
+    std::vector<double> lambda_prim;
+    for (auto i : hi_idx)
+    {
+        lambda_prim.push_back(hi.y[i]);
+    }
+    const double tol = CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 2e-6
+                                                                         : 1e-4;
+    EXPECT_VEC_NEAR(expected_lambda, lambda, tol);
+    EXPECT_VEC_NEAR(expected_lambda_prim, lambda_prim, tol);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
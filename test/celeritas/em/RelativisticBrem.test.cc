@@ -175,8 +175,8 @@ TEST_F(RelativisticBremTest, dxsec)
                                      3.48016652710843,
                                      3.41226786120072};
 
-    EXPECT_VEC_SOFT_EQ(expected_dxsec_lpm, dxsec_value_lpm);
-    EXPECT_VEC_SOFT_EQ(expected_dxsec, dxsec_value);
+    EXPECT_VEC_NEAR(expected_dxsec_lpm, dxsec_value_lpm, coarse_eps);
+    EXPECT_VEC_NEAR(expected_dxsec, dxsec_value, coarse_eps);
 }
 
 TEST_F(RelativisticBremTest, basic_without_lpm)
@@ -221,10 +221,15 @@ TEST_F(RelativisticBremTest, basic_without_lpm)
     }
 
     EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_DOUBLE_EQ(double(rng_engine.count()) / num_samples, 12);
+#else
+    EXPECT_DOUBLE_EQ(double(rng_engine.count()) / num_samples, 6.5);
+#endif
 
     // Note: these are "gold" values based on the host RNG.
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy[] = {
         9.7121539090503, 16.1109589071687, 7.48863745059463, 8338.70226190511};
 
@@ -232,6 +237,11 @@ TEST_F(RelativisticBremTest, basic_without_lpm)
                                      0.999999999999921,
                                      0.999999976998416,
                                      0.999999998137601};
+#else
+    const double expected_energy[]
+        = {4690.4594726562, 11433.18359375, 36.856307983398, 12.045116424561};
+    const double expected_angle[] = {1, 1, 1, 1};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_angle, angle);
@@ -289,6 +299,7 @@ TEST_F(RelativisticBremTest, basic_with_lpm)
 
     // Note: these are "gold" values based on the host RNG.
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_energy[] = {
         18872.4157243063, 43.6117832245235, 4030.31152398788, 217.621447606391};
 
@@ -296,6 +307,11 @@ TEST_F(RelativisticBremTest, basic_with_lpm)
                                      0.999999999587026,
                                      0.999999999683752,
                                      0.999999999474844};
+#else
+    const double expected_energy[]
+        = {4690.4594726562, 11433.18359375, 36.856307983398, 16979.80859375};
+    const double expected_angle[] = {1, 1, 1, 1};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_angle, angle);
@@ -343,11 +359,18 @@ TEST_F(RelativisticBremTest, stress_with_lpm)
     }
     EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_SOFT_EQ(average_energy / num_samples, 2932.1072998587733);
     EXPECT_SOFT_NEAR(
         average_angle[0] / num_samples, 3.3286986548662216e-06, 1e-8);
     EXPECT_SOFT_NEAR(
         average_angle[1] / num_samples, 1.3067055198983571e-06, 1e-8);
+#else
+    // Deflections this small round to zero in single precision
+    EXPECT_SOFT_EQ(average_energy / num_samples, 2520.940673828125);
+    EXPECT_EQ(0, average_angle[0]);
+    EXPECT_EQ(0, average_angle[1]);
+#endif
     EXPECT_SOFT_EQ(average_angle[2] / num_samples, 0.99999999899845182);
 }
 //---------------------------------------------------------------------------//
@@ -184,7 +184,11 @@ TEST_F(SeltzerBergerTest, sb_positron_xs_scaling)
         0.99999599590292, 0.99994914123134, 0.99844428624414, 0.0041293798201,
         0.99999995934326, 0.99999948043882, 0.99998298916928, 0.33428689072689};
     // clang-format on
-    EXPECT_VEC_NEAR(expected_scaling_frac, scaling_frac, 1e-11);
+    // The exponential amplifies roundoff in the difference of inverse speeds
+    EXPECT_VEC_NEAR(expected_scaling_frac,
+                    scaling_frac,
+                    CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE ? 1e-11
+                                                                      : 5e-3);
 }
 
 TEST_F(SeltzerBergerTest, sb_energy_dist)
@@ -289,6 +293,7 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
         12.18911946078, 13.93366489719, 13.85758694967, 13.3353235437};
     const double expected_xs_zero[] = {1.98829818915769, 4.40320232447369,
         12.18911946078, 13.93366489719, 13.85758694967, 13.3353235437};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_avg_exit_frac[] = {0.949115932248866,
         0.497486662164049, 0.082127972143285, 0.0645177016233406,
         0.0774717918229646, 0.0891340819129683, 0.0639090949553034,
@@ -296,10 +301,19 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
     const double expected_avg_engine_samples[] = {4.0791015625, 4.06005859375,
 	5.134765625, 4.65625, 4.43017578125, 4.35693359375, 9.3681640625,
         4.65478515625};
+#else
+    const double expected_avg_exit_frac[] = {
+        0.94942360815803, 0.4948742983745, 0.082831980549645, 0.064870401389314,
+        0.076778480875118, 0.086717491064663, 0.065336025416294,
+        0.063726719781125};
+    const double expected_avg_engine_samples[] = {
+        2.04150390625, 2.029541015625, 2.56298828125, 2.3291015625,
+        2.22705078125, 2.171630859375, 4.65771484375, 2.31787109375};
+#endif
     // clang-format on
 
-    EXPECT_VEC_SOFT_EQ(expected_max_xs, max_xs);
-    EXPECT_VEC_SOFT_EQ(expected_xs_zero, xs_zero);
+    EXPECT_VEC_NEAR(expected_max_xs, max_xs, coarse_eps);
+    EXPECT_VEC_NEAR(expected_xs_zero, xs_zero, coarse_eps);
     EXPECT_VEC_SOFT_EQ(expected_avg_exit_frac, avg_exit_frac);
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
@@ -347,6 +361,7 @@ TEST_F(SeltzerBergerTest, basic)
     EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
 
     // Note: these are "gold" values based on the host RNG.
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const double expected_angle[]  = {0.959441513277674,
                                       0.994350429950924,
                                       0.968866136008621,
@@ -355,6 +370,12 @@ TEST_F(SeltzerBergerTest, basic)
                                       0.0316182310804369,
                                       0.0838794010486177,
                                       0.106195186929141};
+#else
+    const double expected_angle[] = {
+        0.97385364770889, 0.80490833520889, 0.9999588727951, -0.18801872432232};
+    const double expected_energy[] = {
+        0.48727408051491, 0.240134075284, 0.038054831326008, 0.46071639657021};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_angle, angle);
@@ -422,6 +443,7 @@ TEST_F(SeltzerBergerTest, stress_test)
     }
 
     // Gold values for average number of calls to RNG
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     static const double expected_avg_engine_samples[] = {14.088,
                                                          13.2402,
                                                          12.9641,
@@ -432,6 +454,11 @@ TEST_F(SeltzerBergerTest, stress_test)
                                                          12.9431,
                                                          12.5952,
                                                          12.4888};
+#else
+    static const double expected_avg_engine_samples[] = {
+        7.039575, 6.6134, 6.46615, 6.2891, 6.2482, 7.1178, 6.6386, 6.4782,
+        6.2851, 6.2499};
+#endif
 
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
@@ -116,7 +116,10 @@ class UrbanMscTest : public GlobalGeoTestBase
         input.processes.push_back(std::make_shared<EIonizationProcess>(
             this->particle(), processes_data_, ioni_options));
         input.processes.push_back(std::make_shared<MultipleScatteringProcess>(
-            this->particle(), this->material(), processes_data_));
+            this->particle(),
+            this->material(),
+            processes_data_,
+            MultipleScatteringProcess::Options{}));
 
         // Add action manager
         input.action_registry = this->action_reg().get();
@@ -216,7 +219,10 @@ TEST_F(UrbanMscTest, msc_scattering)
 
     // Create the model
     std::shared_ptr<UrbanMscModel> model = std::make_shared<UrbanMscModel>(
-        ActionId{0}, *this->particle(), *this->material());
+        ActionId{0},
+        *this->particle(),
+        *this->material(),
+        UrbanMscModel::Options{});
 
     // Check MscMaterialDara for the current material (G4_STAINLESS-STEEL)
     const UrbanMscMaterialData& msc_
@@ -366,6 +372,73 @@ TEST_F(UrbanMscTest, msc_scattering)
         = {'d', 'd', 'd', 'u', 'd', 'd', 'u', 'u'};
     EXPECT_VEC_EQ(expected_action, action);
 }
+
+TEST_F(UrbanMscTest, step_limit_algorithm)
+{
+    using Alg = MscStepLimitAlgorithm;
+
+    // Only the minimal and safety algorithms are implemented
+    UrbanMscModel::Options options;
+    options.electron_step_limit = Alg::distance_to_boundary;
+    EXPECT_THROW(UrbanMscModel(
+                     ActionId{0}, *this->particle(), *this->material(), options),
+                 RuntimeError);
+
+    options.electron_step_limit = Alg::minimal;
+    UrbanMscModel minimal(
+        ActionId{0}, *this->particle(), *this->material(), options);
+    EXPECT_EQ(Alg::minimal,
+              minimal.host_ref().step_limit_algorithm(
+                  this->particle()->find(pdg::electron())));
+    EXPECT_EQ(Alg::safety,
+              minimal.host_ref().step_limit_algorithm(
+                  this->particle()->find(pdg::positron())));
+    UrbanMscModel safety(ActionId{0},
+                         *this->particle(),
+                         *this->material(),
+                         UrbanMscModel::Options{});
+
+    auto calc_step = [this](const UrbanMscModel& model,
+                            real_type            energy,
+                            real_type            safety_dist) {
+        PhysicsTrackView phys = this->make_track_view(
+            pdg::electron(), MaterialId{1}, MevEnergy{energy});
+        UrbanMscStepLimit calc_limit(model.host_ref(),
+                                     *part_view_,
+                                     phys,
+                                     MaterialId{1},
+                                     safety_dist,
+                                     phys.dedx_range());
+        std::mt19937 rng(12345u);
+        MscStep      result = calc_limit(rng);
+        EXPECT_LE(result.true_path, phys.dedx_range());
+        EXPECT_LE(result.geom_path, result.true_path);
+        return result;
+    };
+
+    for (real_type energy : {0.1, 1.0, 10.0, 50.0})
+    {
+        SCOPED_TRACE(energy);
+
+        // The minimal step limit doesn't depend on the safety distance
+        MscStep near = calc_step(minimal, energy, 0);
+        MscStep far  = calc_step(minimal, energy, 10);
+        EXPECT_EQ(near.true_path, far.true_path);
+        EXPECT_EQ(near.geom_path, far.geom_path);
+        EXPECT_LT(near.true_path, near.phys_step);
+        EXPECT_TRUE(near.is_displaced);
+
+        // Far from a boundary the safety algorithm doesn't limit the step
+        far = calc_step(safety, energy, 10);
+        EXPECT_EQ(far.phys_step, far.true_path);
+        EXPECT_FALSE(far.is_displaced);
+
+        // Near a boundary the safety algorithm limits the step
+        MscStep safety_near = calc_step(safety, energy, 0);
+        EXPECT_LT(safety_near.true_path, safety_near.phys_step);
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
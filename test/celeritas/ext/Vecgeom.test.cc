@@ -7,7 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "Vecgeom.test.hh"
 
+#include <algorithm>
+#include <random>
+
 #include "corecel/cont/ArrayIO.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
 #include "corecel/io/Repr.hh"
 #include "corecel/math/NumericLimits.hh"
@@ -18,6 +22,9 @@
 #include "celeritas/ext/VecgeomData.hh"
 #include "celeritas/ext/VecgeomParams.hh"
 #include "celeritas/ext/VecgeomTrackView.hh"
+#include "celeritas/ext/detail/VecgeomBatchNavigator.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
 
 #include "celeritas_test.hh"
 
@@ -78,6 +85,9 @@ class VecgeomTestBase : virtual public GlobalTestBase
     //! Find linear segments until outside
     TrackingResult track(const Real3& pos, const Real3& dir);
 
+    //! Compare scalar and batched navigation of many tracks
+    void run_batch_navigation(const Real3& lower, const Real3& upper);
+
   protected:
     SPConstParticle    build_particle() final { CELER_ASSERT_UNREACHABLE(); }
     SPConstCutoff      build_cutoff() final { CELER_ASSERT_UNREACHABLE(); }
@@ -136,6 +146,129 @@ auto VecgeomTestBase::track(const Real3& pos, const Real3& dir)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compare scalar and batched navigation of many tracks.
+ *
+ * Isotropic tracks are sampled uniformly in the given box and moved in
+ * straight lines with a fixed maximum step until they leave the world. In
+ * batched mode, the tracks are grouped by volume before each step and the
+ * distances are found by the vectorized navigator. Most steps after the first
+ * start on a boundary, so this checks that the push off the boundary is
+ * applied consistently: both modes must give the same path lengths and
+ * sequence of volumes.
+ */
+void VecgeomTestBase::run_batch_navigation(const Real3& lower,
+                                           const Real3& upper)
+{
+    using ParamsRef = HostCRef<VecgeomParamsData>;
+    using StateRef  = HostRef<VecgeomStateData>;
+
+    constexpr size_type num_tracks = 1024;
+    constexpr size_type batch_size = 16;
+    constexpr real_type max_step   = 1;
+
+    const ParamsRef& params = this->geometry()->host_ref();
+
+    // Sample the same initial tracks for both modes
+    std::vector<GeoTrackInitializer> inits(num_tracks);
+    {
+        std::mt19937             rng;
+        UniformBoxDistribution<> sample_pos(lower, upper);
+        IsotropicDistribution<>  sample_dir;
+        for (GeoTrackInitializer& init : inits)
+        {
+            init.pos = sample_pos(rng);
+            init.dir = sample_dir(rng);
+        }
+    }
+
+    auto transport = [&](bool                    batched,
+                         std::vector<real_type>* path,
+                         std::vector<int>*       volumes) {
+        HostStateStore   states(params, num_tracks);
+        const StateRef&  state_ref = states.ref();
+        std::vector<int> alive(num_tracks, 1);
+        path->assign(num_tracks, 0);
+        volumes->clear();
+        for (auto i : range(num_tracks))
+        {
+            VecgeomTrackView geo(params, state_ref, ThreadId{i});
+            geo      = inits[i];
+            alive[i] = !geo.is_outside();
+        }
+
+        while (std::find(alive.begin(), alive.end(), 1) != alive.end())
+        {
+            if (batched)
+            {
+                // Sort the alive tracks by volume and navigate in batches
+                std::vector<std::pair<VolumeId, ThreadId>> tracks;
+                for (auto i : range(num_tracks))
+                {
+                    if (alive[i])
+                    {
+                        VecgeomTrackView geo(params, state_ref, ThreadId{i});
+                        tracks.push_back({geo.volume_id(), ThreadId{i}});
+                    }
+                }
+                std::sort(tracks.begin(), tracks.end());
+
+                detail::VecgeomBatchNavigator navigate(params, state_ref);
+                std::vector<ThreadId> batch;
+                for (auto i : range(tracks.size()))
+                {
+                    batch.push_back(tracks[i].second);
+                    if (batch.size() == batch_size || i + 1 == tracks.size()
+                        || tracks[i + 1].first != tracks[i].first)
+                    {
+                        std::vector<real_type> steps(batch.size(), max_step);
+                        navigate(make_span(batch), make_span(steps));
+                        batch.clear();
+                    }
+                }
+            }
+
+            for (auto i : range(num_tracks))
+            {
+                if (!alive[i])
+                {
+                    continue;
+                }
+                VecgeomTrackView geo(params, state_ref, ThreadId{i});
+                auto             next = geo.find_next_step(max_step);
+                if (next.boundary)
+                {
+                    geo.move_to_boundary();
+                    geo.cross_boundary();
+                    alive[i] = !geo.is_outside();
+                    volumes->push_back(
+                        alive[i] ? static_cast<int>(geo.volume_id().get())
+                                 : -1);
+                }
+                else
+                {
+                    geo.move_internal(next.distance);
+                }
+                (*path)[i] += next.distance;
+            }
+        }
+    };
+
+    std::vector<real_type> scalar_path;
+    std::vector<int>       scalar_volumes;
+    transport(false, &scalar_path, &scalar_volumes);
+    std::vector<real_type> batch_path;
+    std::vector<int>       batch_volumes;
+    transport(true, &batch_path, &batch_volumes);
+
+    // Batched navigation must not change the tracks
+    EXPECT_VEC_SOFT_EQ(scalar_path, batch_path);
+    EXPECT_VEC_EQ(scalar_volumes, batch_volumes);
+}
+
+//---------------------------------------------------------------------------//
+
 void VecgeomTestBase::TrackingResult::print_expected()
 {
     cout << "/*** ADD THE FOLLOWING UNIT TEST CODE ***/\n"
@@ -388,6 +521,13 @@ TEST_F(FourLevelsTest, safety)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(FourLevelsTest, batch_navigation)
+{
+    this->run_batch_navigation({-20, -20, -20}, {20, 20, 20});
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(FourLevelsTest, TEST_IF_CELERITAS_CUDA(device))
 {
     using StateStore = CollectionStateStore<VecgeomStateData, MemSpace::device>;
@@ -423,6 +563,23 @@ TEST_F(FourLevelsTest, TEST_IF_CELERITAS_CUDA(device))
     EXPECT_VEC_SOFT_EQ(expected_distances, output.distances);
 }
 
+//---------------------------------------------------------------------------//
+// SIMPLE CMS
+//---------------------------------------------------------------------------//
+
+class SimpleCmsTest : public VecgeomTestBase, public GlobalGeoTestBase
+{
+  public:
+    const char* geometry_basename() const final { return "simple-cms"; }
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleCmsTest, batch_navigation)
+{
+    this->run_batch_navigation({-30, -30, -700}, {30, 30, 700});
+}
+
 //---------------------------------------------------------------------------//
 // CONSTRUCT FROM GEANT4 (TODO)
 //---------------------------------------------------------------------------//
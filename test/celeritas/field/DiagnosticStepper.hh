@@ -44,6 +44,21 @@ class DiagnosticStepper
         return do_step_(step, beg_state);
     }
 
+    //! Calculate a step with a known derivative and increment the counter
+    result_type operator()(real_type       step,
+                           const OdeState& beg_state,
+                           const OdeState& beg_deriv) const
+    {
+        ++count_;
+        return do_step_(step, beg_state, beg_deriv);
+    }
+
+    //! Evaluate the derivative without counting a step
+    OdeState calc_deriv(const OdeState& state) const
+    {
+        return do_step_.calc_deriv(state);
+    }
+
     //! Get the number of steps
     size_type count() const { return count_; }
     //! Reset the stepscounter
@@ -5,9 +5,10 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/field/FieldDriver.test.cc
 //---------------------------------------------------------------------------//
-
 #include "celeritas/field/FieldDriver.hh"
 
+#include <cmath>
+
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/math/Algorithms.hh"
@@ -72,11 +73,27 @@ make_mag_field_driver(FieldT&&                  field,
                         ::celeritas::forward<FieldT>(field), charge)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Uniform field that counts the number of evaluations.
+ */
+struct CountingField
+{
+    UniformField      field;
+    mutable size_type count{0};
+
+    Real3 operator()(const Real3& pos) const
+    {
+        ++count;
+        return field(pos);
+    }
+};
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(FieldDriverTest, types)
+TEST_F(FieldDriverTest, TEST_IF_CELERITAS_DOUBLE(types))
 {
     auto driver = make_mag_field_driver<DormandPrinceStepper>(
         UniformField({0, 0, test_params.field_value}),
@@ -88,8 +105,9 @@ TEST_F(FieldDriverTest, types)
         (std::is_same<
             FieldDriver<DormandPrinceStepper<MagFieldEquation<UniformField>>>,
             decltype(driver)>::value));
-    // Size: field vector, q / c, reference to options
-    EXPECT_EQ(sizeof(Real3) + sizeof(real_type) + sizeof(FieldDriverOptions*),
+    // Size: field vector, q / c, reference to options, step estimate
+    EXPECT_EQ(sizeof(Real3) + sizeof(real_type) + sizeof(FieldDriverOptions*)
+                  + sizeof(real_type),
               sizeof(driver));
 }
 
@@ -137,7 +155,7 @@ TEST_F(FieldDriverTest, revolutions)
         total_step_length, circumference * test_params.revolutions, delta);
 }
 
-TEST_F(FieldDriverTest, accurate_advance)
+TEST_F(FieldDriverTest, TEST_IF_CELERITAS_DOUBLE(accurate_advance))
 {
     auto driver = make_mag_field_driver<DormandPrinceStepper>(
         UniformField({0, 0, test_params.field_value}),
@@ -181,6 +199,44 @@ TEST_F(FieldDriverTest, accurate_advance)
               delta);
 }
 
+TEST_F(FieldDriverTest, TEST_IF_CELERITAS_DOUBLE(evaluations))
+{
+    CountingField field{UniformField({0, 0, test_params.field_value})};
+    auto          driver = make_mag_field_driver<DormandPrinceStepper>(
+        field, driver_options, units::ElementaryCharge{-1});
+
+    real_type circumference = 2 * constants::pi * test_params.radius;
+
+    OdeState y;
+    y.pos = {test_params.radius, 0, 0};
+    y.mom = {0, test_params.momentum_y, test_params.momentum_z};
+
+    // Advance by a few large steps that each need several substeps: the
+    // derivative carried between substeps and the step estimate carried
+    // between calls keep the number of field evaluations low
+    real_type              total_step = 0;
+    std::vector<size_type> counts;
+    for (real_type frac : {0.1, 0.25, 0.25, 0.5})
+    {
+        real_type remaining = frac * circumference;
+        field.count         = 0;
+        while (remaining > 0)
+        {
+            auto end = driver.advance(remaining, y);
+            remaining -= end.step;
+            y = end.state;
+            total_step += end.step;
+        }
+        counts.push_back(field.count);
+    }
+    EXPECT_SOFT_EQ(1.1 * circumference, total_step);
+
+    static const size_type expected_counts[] = {39, 49, 49, 98};
+    EXPECT_VEC_EQ(expected_counts, counts);
+    // Same endpoint as without the derivative and step reuse
+    EXPECT_SOFT_NEAR(3.7805041075924, std::hypot(y.pos[0], y.pos[1]), 1e-8);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -210,7 +210,7 @@ constexpr real_type unit_radius_field_strength{3.5019461121752274
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(TwoBoxTest, electron_interior)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_interior))
 {
     // Initialize position and direction so its curved track is centered about
     // the origin, moving counterclockwise from the right
@@ -265,7 +265,7 @@ TEST_F(TwoBoxTest, electron_interior)
         EXPECT_SOFT_EQ(0.5 * pi * radius, result.distance);
         EXPECT_LT(distance(Real3({-radius, 0, 0}), geo.pos()), 1e-6);
         EXPECT_SOFT_EQ(1.0, dot_product(Real3({0, -1, 0}), geo.dir()));
-        EXPECT_EQ(27, stepper.count());
+        EXPECT_EQ(7, stepper.count());
     }
 
     // Test a ridiculously long (half-turn) step to put us back at the start
@@ -276,7 +276,7 @@ TEST_F(TwoBoxTest, electron_interior)
         EXPECT_SOFT_EQ(pi * radius, result.distance);
         EXPECT_LT(distance(Real3({radius, 0, 0}), geo.pos()), 1e-5);
         EXPECT_SOFT_EQ(1.0, dot_product(Real3({0, 1, 0}), geo.dir()));
-        EXPECT_EQ(68, stepper.count());
+        EXPECT_EQ(14, stepper.count());
     }
 
     // Test step that's smaller than driver's minimum (should take one
@@ -287,8 +287,8 @@ TEST_F(TwoBoxTest, electron_interior)
         EXPECT_DOUBLE_EQ(1e-10, result.distance);
         EXPECT_FALSE(result.boundary);
         EXPECT_VEC_NEAR(
-            Real3({3.8085385881855, -2.3814749713353e-07, 0}), geo.pos(), 1e-7);
-        EXPECT_VEC_NEAR(Real3({6.2529888474538e-08, 1, 0}), geo.dir(), 1e-7);
+            Real3({3.8085385881759, -2.3808516144136e-07, 0}), geo.pos(), 1e-7);
+        EXPECT_VEC_NEAR(Real3({6.2513521540335e-08, 1, 0}), geo.dir(), 1e-7);
         EXPECT_EQ(1, stepper.count());
     }
 }
@@ -475,7 +475,7 @@ TEST_F(TwoBoxTest, gamma_exit)
 }
 
 // Electron takes small steps up to and from a boundary
-TEST_F(TwoBoxTest, electron_small_step)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_small_step))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -587,7 +587,7 @@ TEST_F(TwoBoxTest, electron_tangent)
 }
 
 // Electron crosses and reenters
-TEST_F(TwoBoxTest, electron_cross)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_cross))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -659,7 +659,7 @@ TEST_F(TwoBoxTest, electron_cross)
 }
 
 // Electron barely crosses boundary
-TEST_F(TwoBoxTest, electron_tangent_cross)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_tangent_cross))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -715,7 +715,7 @@ TEST_F(TwoBoxTest, electron_tangent_cross)
     }
 }
 
-TEST_F(TwoBoxTest, electron_corner_hit)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_corner_hit))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -809,7 +809,7 @@ TEST_F(TwoBoxTest, electron_corner_hit)
 }
 
 // Endpoint of a step is very close to the boundary.
-TEST_F(TwoBoxTest, electron_step_endpoint)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_step_endpoint))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -908,7 +908,7 @@ TEST_F(TwoBoxTest, electron_step_endpoint)
 }
 
 // Electron barely crosses boundary
-TEST_F(TwoBoxTest, electron_tangent_cross_smallradius)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(electron_tangent_cross_smallradius))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -922,7 +922,8 @@ TEST_F(TwoBoxTest, electron_tangent_cross_smallradius)
     std::vector<int>         substeps;
     std::vector<std::string> volumes;
 
-    for (real_type dtheta : {pi / 4, pi / 7, 1e-3, 1e-6, 1e-9})
+    for (real_type dtheta :
+         {pi / 4, pi / 7, real_type(1e-3), real_type(1e-6), real_type(1e-9)})
     {
         SCOPED_TRACE(dtheta);
         {
@@ -997,7 +998,7 @@ TEST_F(TwoBoxTest, electron_tangent_cross_smallradius)
 
 // Heuristic test: plotting points with finer propagation distance show a track
 // with decreasing radius
-TEST_F(TwoBoxTest, nonuniform_field)
+TEST_F(TwoBoxTest, TEST_IF_CELERITAS_DOUBLE(nonuniform_field))
 {
     auto particle = this->init_particle(
         this->particle()->find(pdg::electron()), MevEnergy{10});
@@ -1009,12 +1010,12 @@ TEST_F(TwoBoxTest, nonuniform_field)
     static const Real3 expected_all_pos[]
         = {{-2.082588410019, 0.698321021704, 0.70710499699532},
            {-2.5772835670309, 1.1563856325251, 1.414208222427},
-           {-3.0638597406072, 0.77477344365218, 2.1213130872532},
-           {-2.5584323246703, 0.58519068474743, 2.8284269544184},
-           {-2.904435093832, 0.86378022294055, 3.5355750279272},
-           {-2.5804988125119, 0.7657810943241, 4.242802666321},
-           {-2.7424915491399, 0.60277842755393, 4.9501038870007},
-           {-2.6941223485135, 0.6137455428308, 5}};
+           {-3.0638593304744, 0.77477268041054, 2.1213127465},
+           {-2.558431743575, 0.58519121243562, 2.828427046728},
+           {-2.9044349008722, 0.86377981603855, 3.5355755145115},
+           {-2.5804985578905, 0.76578144150131, 4.2428035147762},
+           {-2.742490742356, 0.60277855315556, 4.9501049927495},
+           {-2.6941226266466, 0.61374537315465, 5}};
     for (const Real3& pos : expected_all_pos)
     {
         auto geo       = this->make_geo_view();
@@ -1027,7 +1028,7 @@ TEST_F(TwoBoxTest, nonuniform_field)
 
 //---------------------------------------------------------------------------//
 
-TEST_F(LayersTest, revolutions_through_layers)
+TEST_F(LayersTest, TEST_IF_CELERITAS_DOUBLE(revolutions_through_layers))
 {
     const real_type radius{3.8085385437789383};
     auto            particle = this->init_particle(
@@ -1116,7 +1117,7 @@ TEST_F(LayersTest, revolutions_through_cms_field)
 
 //---------------------------------------------------------------------------//
 
-TEST_F(SimpleCmsTest, electron_stuck)
+TEST_F(SimpleCmsTest, TEST_IF_CELERITAS_DOUBLE(electron_stuck))
 {
     auto particle = this->init_particle(this->particle()->find(pdg::electron()),
                                         MevEnergy{4.25402379798713e-01});
@@ -1153,7 +1154,7 @@ TEST_F(SimpleCmsTest, electron_stuck)
             = make_field_propagator(stepper, driver_options, particle, &geo);
         auto result = propagate(1000);
         EXPECT_EQ(result.boundary, geo.is_on_boundary());
-        EXPECT_EQ(92, stepper.count());
+        EXPECT_EQ(36, stepper.count());
         ASSERT_TRUE(geo.is_on_boundary());
         if (!CELERITAS_USE_VECGEOM)
         {
@@ -1183,7 +1184,7 @@ TEST_F(SimpleCmsTest, electron_stuck)
     }
 }
 
-TEST_F(SimpleCmsTest, vecgeom_failure)
+TEST_F(SimpleCmsTest, TEST_IF_CELERITAS_DOUBLE(vecgeom_failure))
 {
     UniformZField      field(1 * units::tesla);
     FieldDriverOptions driver_options;
@@ -1246,9 +1247,9 @@ TEST_F(SimpleCmsTest, vecgeom_failure)
         if (successful_reentry)
         {
             // Extremely long propagation stopped by substep countdown
-            EXPECT_SOFT_EQ(14.946488966946923, result.distance);
+            EXPECT_SOFT_EQ(15.703271482494841, result.distance);
             EXPECT_EQ("em_calorimeter", this->volume_name(geo));
-            EXPECT_EQ(9984, stepper.count());
+            EXPECT_EQ(735, stepper.count());
         }
         else
         {
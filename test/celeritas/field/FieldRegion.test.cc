@@ -0,0 +1,232 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/field/FieldRegion.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/field/FieldRegionParams.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/GlobalGeoTestBase.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/field/UniformField.hh"
+#include "celeritas/field/UniformFieldRegionPropagator.hh"
+#include "celeritas/geo/GeoData.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleData.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FieldRegionTest : public GlobalGeoTestBase
+{
+  public:
+    using VecBool = FieldRegionParams::VecBool;
+
+    const char* geometry_basename() const override { return "field-test"; }
+
+    //! Names of the field-free volumes
+    std::vector<std::string> field_free_names(const VecBool& field_free)
+    {
+        std::vector<std::string> result;
+        for (auto i : range(field_free.size()))
+        {
+            if (field_free[i])
+            {
+                result.push_back(
+                    this->geometry()->id_to_label(VolumeId(i)).name);
+            }
+        }
+        return result;
+    }
+
+    void SetUp() override
+    {
+        geo_state_ = GeoStateStore(this->geometry()->host_ref(), 1);
+        par_state_ = ParStateStore(this->particle()->host_ref(), 1);
+    }
+
+    //! Initialize a 10 MeV electron
+    ParticleTrackView make_electron()
+    {
+        ParticleTrackView view{
+            this->particle()->host_ref(), par_state_.ref(), ThreadId{0}};
+        view = {this->particle()->find(pdg::electron()),
+                units::MevEnergy{10}};
+        return view;
+    }
+
+    //! Initialize the geometry state
+    GeoTrackView make_geo(const Real3& pos, const Real3& dir)
+    {
+        GeoTrackView view{
+            this->geometry()->host_ref(), geo_state_.ref(), ThreadId{0}};
+        view = {pos, dir};
+        return view;
+    }
+
+  protected:
+    using GeoStateStore = CollectionStateStore<GeoStateData, MemSpace::host>;
+    using ParStateStore
+        = CollectionStateStore<ParticleStateData, MemSpace::host>;
+
+    SPConstCutoff   build_cutoff() override { CELER_ASSERT_UNREACHABLE(); }
+    SPConstPhysics  build_physics() override { CELER_ASSERT_UNREACHABLE(); }
+    SPConstAction   build_along_step() override { CELER_ASSERT_UNREACHABLE(); }
+    SPConstMaterial build_material() override { CELER_ASSERT_UNREACHABLE(); }
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        CELER_ASSERT_UNREACHABLE();
+    }
+
+    SPConstParticle build_particle() override
+    {
+        using namespace units;
+        constexpr auto        stable = ParticleRecord::stable_decay_constant();
+        ParticleParams::Input defs   = {{"electron",
+                                       pdg::electron(),
+                                       MevMass{0.5109989461},
+                                       ElementaryCharge{-1},
+                                       stable}};
+        return std::make_shared<ParticleParams>(std::move(defs));
+    }
+
+    GeoStateStore geo_state_;
+    ParStateStore par_state_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FieldRegionTest, from_names)
+{
+    const GeoParams&  geo   = *this->geometry();
+    const std::string world = CELERITAS_USE_VECGEOM ? "World" : "world";
+
+    auto field_free = FieldRegionParams::field_free_volumes(geo, {world});
+    EXPECT_EQ(geo.num_volumes(), field_free.size());
+    static const std::string expected_names[] = {world};
+    EXPECT_VEC_EQ(expected_names, this->field_free_names(field_free));
+
+    FieldRegionParams regions(field_free);
+    EXPECT_EQ(geo.num_volumes(), regions.num_volumes());
+    EXPECT_EQ(1, regions.num_field_free());
+
+    const auto& data = regions.host_ref();
+    for (auto vol : range(VolumeId{geo.num_volumes()}))
+    {
+        EXPECT_EQ(geo.id_to_label(vol).name == world,
+                  data.is_field_free(vol));
+    }
+
+    // Unknown volumes are an error
+    EXPECT_THROW(FieldRegionParams::field_free_volumes(geo, {world, "foo"}),
+                 RuntimeError);
+}
+
+TEST_F(FieldRegionTest, from_threshold)
+{
+    // Bounding boxes of the five layers along y
+    std::vector<BoundingBox> bboxes;
+    for (real_type ymid : {-4, -2, 0, 2, 4})
+    {
+        bboxes.push_back({{-9, ymid - real_type(0.5), -9},
+                          {9, ymid + real_type(0.5), 9}});
+    }
+    // Missing and infinite bounding boxes always have a field
+    bboxes.push_back({});
+    bboxes.push_back(BoundingBox::from_infinite());
+
+    // Field along z that grows linearly with |y|
+    auto calc_field = [](const Real3& pos) -> Real3 {
+        return {0, 0, std::fabs(pos[1]) * units::tesla};
+    };
+
+    auto field_free = FieldRegionParams::field_free_volumes(
+        make_span(bboxes), calc_field, real_type(3) * units::tesla);
+    EXPECT_EQ(VecBool({false, true, true, true, false, false, false}),
+              field_free);
+
+    // A uniform field is either everywhere above or below the threshold
+    UniformField uniform({0, 0, 1 * units::tesla});
+    EXPECT_EQ(VecBool(7, false),
+              FieldRegionParams::field_free_volumes(
+                  make_span(bboxes), uniform, real_type(0.5) * units::tesla));
+    EXPECT_EQ(VecBool({true, true, true, true, true, false, false}),
+              FieldRegionParams::field_free_volumes(
+                  make_span(bboxes), uniform, real_type(2) * units::tesla));
+}
+
+TEST_F(FieldRegionTest, propagate)
+{
+    const GeoParams&  geo   = *this->geometry();
+    const std::string world = CELERITAS_USE_VECGEOM ? "World" : "world";
+
+    UniformFieldParams field;
+    field.field = {0, 0, 1 * units::tesla};
+    FieldRegionParams regions(
+        FieldRegionParams::field_free_volumes(geo, {world}));
+    const Real3 dir{1, 0, 0};
+
+    {
+        // Straight line in the world volume between layers
+        auto geo_view = this->make_geo({0, -3, 0}, dir);
+        EXPECT_EQ(world, geo.id_to_label(geo_view.volume_id()).name);
+        UniformFieldRegionPropagator propagate(
+            field, regions.host_ref(), this->make_electron(), &geo_view);
+        EXPECT_TRUE(propagate.field_free());
+
+        real_type step_estimate = 0.5;
+        auto      result        = propagate(1, &step_estimate);
+        EXPECT_SOFT_EQ(1, result.distance);
+        EXPECT_FALSE(result.boundary);
+        EXPECT_VEC_SOFT_EQ((Real3{1, -3, 0}), geo_view.pos());
+        EXPECT_VEC_SOFT_EQ(dir, geo_view.dir());
+        EXPECT_EQ(0.5, step_estimate);
+    }
+    {
+        // Curved track in the central layer
+        auto geo_view = this->make_geo({0, 0, 0}, dir);
+        EXPECT_EQ("layer2", geo.id_to_label(geo_view.volume_id()).name);
+        UniformFieldRegionPropagator propagate(
+            field, regions.host_ref(), this->make_electron(), &geo_view);
+        EXPECT_FALSE(propagate.field_free());
+
+        real_type step_estimate = 0.5;
+        auto      result        = propagate(1, &step_estimate);
+        EXPECT_SOFT_EQ(1, result.distance);
+        EXPECT_FALSE(result.boundary);
+        EXPECT_LT(0.1, std::fabs(geo_view.pos()[1]));
+        EXPECT_LT(0.01, distance(dir, geo_view.dir()));
+        EXPECT_NE(0.5, step_estimate);
+    }
+    {
+        // Without regions the field applies everywhere
+        auto geo_view = this->make_geo({0, -3, 0}, dir);
+        UniformFieldRegionPropagator propagate(
+            field, {}, this->make_electron(), &geo_view);
+        EXPECT_FALSE(propagate.field_free());
+        real_type step_estimate = 0.5;
+        propagate(1, &step_estimate);
+        EXPECT_LT(0.1, std::fabs(geo_view.pos()[1] + 3));
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -31,7 +31,7 @@ struct MagFieldTraits
     using Equation_t   = MagFieldEquation<const Field_t&>;
     using Stepper_t    = StepperT<const Equation_t&>;
     using Driver_t     = FieldDriver<const Stepper_t&>;
-    using Propagator_t = FieldPropagator<const Driver_t&>;
+    using Propagator_t = FieldPropagator<Driver_t&>;
 };
 
 //---------------------------------------------------------------------------//
@@ -129,7 +129,7 @@ class SteppersTest : public Test
 //---------------------------------------------------------------------------//
 // HOST TESTS
 //---------------------------------------------------------------------------//
-TEST_F(SteppersTest, host_helix)
+TEST_F(SteppersTest, TEST_IF_CELERITAS_DOUBLE(host_helix))
 {
     // Construct a uniform magnetic field along Z axis
     UniformZField field(param.field_value);
@@ -139,7 +139,7 @@ TEST_F(SteppersTest, host_helix)
 }
 
 //---------------------------------------------------------------------------//
-TEST_F(SteppersTest, host_classical_rk4)
+TEST_F(SteppersTest, TEST_IF_CELERITAS_DOUBLE(host_classical_rk4))
 {
     // Construct a uniform magnetic field
     UniformField field({0, 0, param.field_value});
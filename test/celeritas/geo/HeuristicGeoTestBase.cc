@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "HeuristicGeoTestBase.hh"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionAlgorithms.hh"
@@ -16,6 +18,7 @@
 #include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/io/Join.hh"
+#include "corecel/io/Logger.hh"
 #include "corecel/io/Repr.hh"
 #include "corecel/io/ScopedStreamFormat.hh"
 #include "celeritas/geo/GeoParams.hh"
@@ -47,6 +50,8 @@ void HeuristicGeoTestBase::run_host(size_type num_states, real_type tolerance)
         }
     }
 
+    this->log_step_reuse(state.ref().geometry);
+
     auto avg_path = this->get_avg_path(state.ref().accum_path, num_states);
     auto ref_path = this->reference_avg_path();
 
@@ -89,6 +94,8 @@ void HeuristicGeoTestBase::run_device(size_type num_states, real_type tolerance)
         heuristic_test_launch(params, state.ref());
     }
 
+    this->log_step_reuse(state.ref().geometry);
+
     auto avg_path = this->get_avg_path(state.ref().accum_path, num_states);
     EXPECT_VEC_NEAR(this->reference_avg_path(), avg_path, tolerance);
 }
@@ -182,6 +189,38 @@ auto HeuristicGeoTestBase::get_avg_path_impl(const std::vector<real_type>& path,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Log the fraction of boundary distances reused from a previous step.
+ *
+ * The geometry states only tally distance-to-boundary requests in debug mode.
+ */
+template<MemSpace M>
+void HeuristicGeoTestBase::log_step_reuse(
+    CELER_MAYBE_UNUSED const GeoStateData<Ownership::reference, M>& geo) const
+{
+#if CELERITAS_DEBUG
+    using CountRef = StateCollection<size_type, Ownership::reference, M>;
+
+    auto sum_counts = [](const CountRef& counts) {
+        std::vector<size_type> host_counts(counts.size());
+        Copier<size_type, M>   copy_to{counts[AllItems<size_type, M>{}]};
+        copy_to(MemSpace::host, make_span(host_counts));
+        return std::accumulate(
+            host_counts.begin(), host_counts.end(), size_type{0});
+    };
+
+    size_type num_find   = sum_counts(geo.find_step_count);
+    size_type num_cached = sum_counts(geo.cached_step_count);
+
+    CELER_LOG(info) << "Reused " << num_cached << " of " << num_find
+                    << " distance-to-boundary calculations ("
+                    << std::setprecision(3)
+                    << 100.0 * num_cached / std::max(num_find, size_type{1})
+                    << "%)";
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // DEVICE KERNEL EXECUTION
 //---------------------------------------------------------------------------//
@@ -94,6 +94,9 @@ class HeuristicGeoTestBase : public GlobalGeoTestBase
 
     std::vector<real_type> get_avg_path_impl(const std::vector<real_type>& path,
                                              size_type num_states) const;
+
+    template<MemSpace M>
+    void log_step_reuse(const GeoStateData<Ownership::reference, M>& geo) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionSequence.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/detail/ActionSequence.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record the order in which the action is executed.
+ */
+class OrderedAction final : public ExplicitActionInterface,
+                            public ConcreteAction
+{
+  public:
+    OrderedAction(ActionId          id,
+                  std::string       label,
+                  ActionOrder       order,
+                  bool              concurrent,
+                  std::atomic<int>* counter)
+        : ConcreteAction(id, std::move(label))
+        , order_(order)
+        , concurrent_(concurrent)
+        , counter_(counter)
+    {
+    }
+
+    void execute(CoreHostRef const&) const final
+    {
+        ++num_calls_;
+        index_ = counter_->fetch_add(1);
+    }
+
+    void execute(CoreDeviceRef const&) const final
+    {
+        CELER_NOT_IMPLEMENTED("device");
+    }
+
+    ActionOrder order() const final { return order_; }
+    bool        concurrent() const final { return concurrent_; }
+
+    //! Number of times executed
+    int num_calls() const { return num_calls_; }
+
+    //! Position in the sequence when last executed
+    int index() const { return index_; }
+
+  private:
+    ActionOrder       order_;
+    bool              concurrent_;
+    std::atomic<int>* counter_;
+    mutable int       num_calls_{0};
+    mutable int       index_{-1};
+};
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ActionSequenceTest : public ::celeritas::test::Test
+{
+  protected:
+    using SPAction = std::shared_ptr<OrderedAction>;
+
+    SPAction add(std::string label, ActionOrder order, bool concurrent)
+    {
+        auto result = std::make_shared<OrderedAction>(
+            registry.next_id(), std::move(label), order, concurrent, &counter);
+        registry.insert(result);
+        return result;
+    }
+
+    ActionRegistry   registry;
+    std::atomic<int> counter{0};
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ActionSequenceTest, concurrent)
+{
+    // Insert out of order: sorting is by order, then by ID
+    auto end_a  = this->add("end-a", ActionOrder::end, true);
+    auto post_a = this->add("post-a", ActionOrder::post, true);
+    auto post_b = this->add("post-b", ActionOrder::post, true);
+    auto post_d = this->add("post-d", ActionOrder::post, false);
+    auto post_e = this->add("post-e", ActionOrder::post, true);
+    auto pre_a  = this->add("pre-a", ActionOrder::pre, true);
+    auto post_c = this->add("post-c", ActionOrder::post, true);
+
+    ActionSequence::Options opts;
+    opts.concurrent = true;
+    ActionSequence actions(registry, opts);
+
+    std::vector<std::string> labels;
+    for (const auto& action : actions.actions())
+    {
+        labels.push_back(action->label());
+    }
+    static const std::string expected_labels[] = {
+        "pre-a", "post-a", "post-b", "post-d", "post-e", "post-c", "end-a"};
+    EXPECT_VEC_EQ(expected_labels, labels);
+
+    // Concurrent groups never span different orders or non-concurrent actions
+    static const size_type expected_concurrent_end[] = {1, 3, 3, 4, 6, 6, 7};
+    EXPECT_VEC_EQ(expected_concurrent_end, actions.concurrent_end());
+
+    for (int i = 0; i < 2; ++i)
+    {
+        counter = 0;
+        actions.execute(CoreRef<MemSpace::host>{});
+
+        EXPECT_EQ(0, pre_a->index());
+        std::vector<int> group{post_a->index(), post_b->index()};
+        std::sort(group.begin(), group.end());
+        EXPECT_EQ(1, group.front());
+        EXPECT_EQ(2, group.back());
+        EXPECT_EQ(3, post_d->index());
+        group = {post_e->index(), post_c->index()};
+        std::sort(group.begin(), group.end());
+        EXPECT_EQ(4, group.front());
+        EXPECT_EQ(5, group.back());
+        EXPECT_EQ(6, end_a->index());
+    }
+
+    for (const auto& action : {pre_a, post_a, post_b, post_c, post_d, post_e, end_a})
+    {
+        EXPECT_EQ(2, action->num_calls()) << action->label();
+    }
+    for (double t : actions.accum_time())
+    {
+        EXPECT_GE(t, 0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace detail
+} // namespace celeritas
@@ -6,6 +6,7 @@
 //! \file celeritas/global/AlongStep.test.cc
 //---------------------------------------------------------------------------//
 #include "celeritas/TestEm3Base.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 
@@ -26,6 +27,29 @@ class KnAlongStepTest : public SimpleTestBase, public AlongStepTestBase
   public:
 };
 
+class TransparentKnAlongStepTest : public KnAlongStepTest
+{
+  public:
+    //! Optionally fill the world with the detector material
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        GeoMaterialParams::Input input;
+        input.geometry      = this->geometry();
+        input.materials     = this->material();
+        input.volume_to_mat
+            = {MaterialId{0},
+               same_material_ ? MaterialId{0} : MaterialId{1},
+               MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    bool transparent_boundaries() const override { return true; }
+
+    bool same_material_{false};
+};
+
 #define Em3AlongStepTest TEST_IF_CELERITAS_GEANT(Em3AlongStepTest)
 class Em3AlongStepTest : public TestEm3Base, public AlongStepTestBase
 {
@@ -79,6 +103,43 @@ TEST_F(KnAlongStepTest, basic)
     }
 }
 
+TEST_F(TransparentKnAlongStepTest, different_material)
+{
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy      = MevEnergy{1};
+    auto result     = this->run(inp);
+    EXPECT_SOFT_EQ(5, result.displacement);
+    EXPECT_SOFT_EQ(5, result.step);
+    EXPECT_EQ("geo-crossed-boundary", result.action);
+}
+
+TEST_F(TransparentKnAlongStepTest, same_material)
+{
+    same_material_ = true;
+
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    {
+        SCOPED_TRACE("passing through the inner box and out of the world");
+        inp.energy  = MevEnergy{1};
+        auto result = this->run(inp);
+        EXPECT_SOFT_EQ(50, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(50, result.step);
+        EXPECT_EQ("geo-crossed-boundary", result.action);
+    }
+    {
+        SCOPED_TRACE("interacting outside the inner box");
+        inp.energy   = MevEnergy{10};
+        inp.phys_mfp = 0.02;
+        auto result  = this->run(inp);
+        EXPECT_SOFT_EQ(20, result.displacement);
+        EXPECT_SOFT_EQ(20, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+}
+
 TEST_F(Em3AlongStepTest, nofluct_nomsc)
 {
     msc_   = false;
@@ -0,0 +1,135 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/BatchNavigation.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/BatchNavigationAction.hh"
+
+#include "celeritas_config.h"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_VECGEOM
+#    define TEST_IF_CELERITAS_VECGEOM(name) name
+#else
+#    define TEST_IF_CELERITAS_VECGEOM(name) DISABLED_##name
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BatchNavigationTestBase : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    //! Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    void SetUp() override
+    {
+        this->insert_clear_secondaries();
+    }
+
+    RunResult run_host()
+    {
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 2));
+        return this->run(step, num_primaries);
+    }
+
+  protected:
+    static constexpr size_type num_primaries = 256;
+    static constexpr size_type num_tracks    = 256;
+};
+
+constexpr size_type BatchNavigationTestBase::num_primaries;
+constexpr size_type BatchNavigationTestBase::num_tracks;
+
+//---------------------------------------------------------------------------//
+class UnbatchedTest : public BatchNavigationTestBase
+{
+};
+
+class BatchNavigationTest : public BatchNavigationTestBase
+{
+  protected:
+    size_type navigation_batch_size() const override { return 16; }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(UnbatchedTest, host)
+{
+    auto setup = this->check_setup();
+    static const char* const expected_actions[] = {"pre-step",
+                                                   "along-step-neutral",
+                                                   "physics-discrete-select",
+                                                   "scat-klein-nishina",
+                                                   "geo-boundary",
+                                                   "dummy-action",
+                                                   "clear-secondaries"};
+    EXPECT_VEC_EQ(expected_actions, setup.actions);
+
+    auto result = this->run_host();
+    ASSERT_TRUE(result);
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+    EXPECT_EQ(4, result.num_step_iters());
+#else
+    EXPECT_EQ(3, result.num_step_iters());
+#endif
+    EXPECT_SOFT_EQ(2.07421875, result.calc_avg_steps_per_primary());
+    EXPECT_EQ(2, result.calc_emptying_step());
+    EXPECT_EQ(RunResult::StepCount({0, 0}), result.calc_queue_hwm());
+}
+
+TEST_F(BatchNavigationTest, TEST_IF_CELERITAS_VECGEOM(input))
+{
+    EXPECT_THROW(BatchNavigationAction(ActionId{0}, 0), RuntimeError);
+}
+
+TEST_F(BatchNavigationTest, TEST_IF_CELERITAS_VECGEOM(host))
+{
+    auto setup = this->check_setup();
+    static const char* const expected_actions[] = {"pre-step",
+                                                   "geo-batch-navigate",
+                                                   "along-step-neutral",
+                                                   "physics-discrete-select",
+                                                   "scat-klein-nishina",
+                                                   "geo-boundary",
+                                                   "dummy-action",
+                                                   "clear-secondaries"};
+    EXPECT_VEC_EQ(expected_actions, setup.actions);
+
+    auto result = this->run_host();
+    ASSERT_TRUE(result);
+
+    // Transport is unchanged
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+    EXPECT_EQ(4, result.num_step_iters());
+#else
+    EXPECT_EQ(3, result.num_step_iters());
+#endif
+    EXPECT_SOFT_EQ(2.07421875, result.calc_avg_steps_per_primary());
+    EXPECT_EQ(2, result.calc_emptying_step());
+    EXPECT_EQ(RunResult::StepCount({0, 0}), result.calc_queue_hwm());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
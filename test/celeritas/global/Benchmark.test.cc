@@ -0,0 +1,801 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/Benchmark.test.cc
+//! \brief End-to-end stepping benchmarks with regression thresholds.
+//---------------------------------------------------------------------------//
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <nlohmann/json.hpp>
+#include <sys/resource.h>
+
+#include "celeritas_cmake_strings.h"
+#include "celeritas_config.h"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/ext/GeantPhysicsOptions.hh"
+#include "celeritas/field/FieldRegionParams.hh"
+#include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/global/detail/ActionSequence.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/phys/Secondary.hh"
+
+#include "../SimpleTestBase.hh"
+#include "../TestEm3Base.hh"
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using celeritas::units::MevEnergy;
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get a positive integer from the environment, or a default value.
+ */
+size_type getenv_size(const char* key, size_type default_value)
+{
+    const std::string& str = celeritas::getenv(key);
+    if (str.empty())
+    {
+        return default_value;
+    }
+    long result = std::stol(str);
+    CELER_VALIDATE(result > 0,
+                   << "invalid value '" << str << "' for " << key
+                   << " (must be positive)");
+    return static_cast<size_type>(result);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a positive fraction from the environment, or a default value.
+ */
+double getenv_fraction(const char* key, double default_value)
+{
+    const std::string& str = celeritas::getenv(key);
+    if (str.empty())
+    {
+        return default_value;
+    }
+    double result = std::stod(str);
+    CELER_VALIDATE(result > 0,
+                   << "invalid value '" << str << "' for " << key
+                   << " (must be positive)");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Peak resident memory of this process [KiB].
+ */
+long get_peak_memory_kib()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    // Reported in bytes rather than kilobytes
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of host threads available to the actions.
+ */
+int get_num_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the number of tracks that took their first step.
+ *
+ * The total energy deposition is also accumulated so that changes to the
+ * physics (such as the MSC step limitation) can be compared.
+ */
+class TrackCounterAction final : public ExplicitActionInterface,
+                                 public ConcreteAction
+{
+  public:
+    // Construct with ID and label
+    using ConcreteAction::ConcreteAction;
+
+    void execute(CoreHostRef const& data) const final
+    {
+        size_type count = 0;
+        real_type edep  = 0;
+#pragma omp parallel for reduction(+ : count, edep)
+        for (size_type i = 0; i < data.states.size(); ++i)
+        {
+            CoreTrackView track(data.params, data.states, ThreadId{i});
+            auto          sim = track.make_sim_view();
+            if (sim.status() == TrackStatus::inactive)
+            {
+                continue;
+            }
+            if (sim.num_steps() == 1)
+            {
+                ++count;
+            }
+            edep += value_as<MevEnergy>(
+                track.make_physics_step_view().energy_deposition());
+        }
+        num_tracks_ += count;
+        energy_deposition_ += edep;
+    }
+
+    void execute(CoreDeviceRef const&) const final
+    {
+        CELER_NOT_IMPLEMENTED("device");
+    }
+
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    //! Number of tracks counted so far
+    size_type num_tracks() const { return num_tracks_; }
+
+    //! Energy deposited so far [MeV]
+    double energy_deposition() const { return energy_deposition_; }
+
+  private:
+    mutable size_type num_tracks_{0};
+    mutable double    energy_deposition_{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all benchmark results when the test program exits.
+ */
+class BenchmarkEnvironment : public ::testing::Environment
+{
+  public:
+    //! Results for all problems, keyed on the problem name
+    static nlohmann::json& results()
+    {
+        static nlohmann::json result = nlohmann::json::object();
+        return result;
+    }
+
+    void TearDown() final
+    {
+        const std::string& filename = celeritas::getenv("CELER_BENCH_OUTPUT");
+        if (filename.empty() || results().empty())
+        {
+            return;
+        }
+        // Merge with results from previous invocations
+        nlohmann::json all_results = nlohmann::json::object();
+        {
+            std::ifstream infile(filename);
+            if (infile)
+            {
+                all_results = nlohmann::json::parse(infile);
+            }
+        }
+        all_results.update(results());
+
+        std::ofstream outf(filename);
+        CELER_VALIDATE(outf, << "failed to open '" << filename << "'");
+        outf << all_results.dump(1) << std::endl;
+    }
+};
+
+::testing::Environment* const benchmark_env
+    = ::testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Time a full host transport loop over a fixed set of primaries.
+ *
+ * The problem size defaults to a small smoke test so that it can run as part
+ * of the unit tests. The \c benchmark build target runs the same problems at
+ * production scale by setting environment variables:
+ * - \c CELER_BENCH_PRODUCTION: use the production number of primaries
+ * - \c CELER_BENCH_PRIMARIES: override the number of primaries
+ * - \c CELER_BENCH_TRACKS: number of track slots (default: one per primary)
+ * - \c OMP_NUM_THREADS: number of host threads
+ * - \c CELER_BENCH_OUTPUT: JSON file to write (or merge) results into
+ * - \c CELER_BENCH_BASELINE: JSON file of results to compare against
+ * - \c CELER_BENCH_TOLERANCE: allowed relative slowdown (default 0.1)
+ * - \c CELER_BENCH_PHYSICS_TOLERANCE: allowed relative difference in steps,
+ *   tracks, and energy deposition from a baseline built with a different
+ *   floating point precision (default 0.02)
+ *
+ * The numbers of steps and tracks and the total energy deposition are
+ * reported along with the throughput. Primaries are sampled from a fixed seed
+ * so that runs are reproducible. Baseline results are only compared when the
+ * problem size and thread count match. A baseline run with the other
+ * \c real_type samples a different random sequence, so its tallies are
+ * compared statistically rather than exactly.
+ */
+class BenchmarkTestBase : public StepperTestBase
+{
+  public:
+    // Add track counter action at construction
+    BenchmarkTestBase();
+
+    //! Default number of primaries for the smoke test
+    virtual size_type default_num_primaries() const = 0;
+
+    //! Default number of primaries at production scale
+    virtual size_type production_num_primaries() const = 0;
+
+    //! Whether to run independent actions concurrently
+    virtual bool concurrent_actions() const { return false; }
+
+    //! Order in which initializers fill empty track slots
+    virtual TrackInitPolicy init_policy() const
+    {
+        return TrackInitPolicy::lifo;
+    }
+
+    // Transport all primaries, write the result, and compare to the baseline
+    void run_benchmark(const std::string& name);
+
+  private:
+    std::shared_ptr<TrackCounterAction> counter_;
+};
+
+//---------------------------------------------------------------------------//
+BenchmarkTestBase::BenchmarkTestBase()
+{
+    auto& action_reg = *this->action_reg();
+    counter_         = std::make_shared<TrackCounterAction>(
+        action_reg.next_id(), "count-tracks", "count started tracks");
+    action_reg.insert(counter_);
+}
+
+//---------------------------------------------------------------------------//
+void BenchmarkTestBase::run_benchmark(const std::string& name)
+{
+    bool production = !celeritas::getenv("CELER_BENCH_PRODUCTION").empty();
+    size_type num_primaries = getenv_size(
+        "CELER_BENCH_PRIMARIES",
+        production ? this->production_num_primaries()
+                   : this->default_num_primaries());
+    size_type num_tracks = getenv_size("CELER_BENCH_TRACKS", num_primaries);
+
+    StepperInput input = this->make_stepper_input(num_tracks, 4);
+    input.concurrent_actions = this->concurrent_actions();
+    input.init_policy        = this->init_policy();
+    Stepper<MemSpace::host> step(std::move(input));
+    size_type start_tracks = counter_->num_tracks();
+    double    start_edep   = counter_->energy_deposition();
+
+    Stopwatch get_time;
+    auto      counts     = step(this->make_primaries(num_primaries));
+    size_type num_steps  = counts.active;
+    size_type max_queued = counts.queued;
+    size_type max_steps  = this->max_average_steps() * num_primaries;
+    while (counts && num_steps < max_steps)
+    {
+        counts = step();
+        num_steps += counts.active;
+        max_queued = std::max(max_queued, counts.queued);
+    }
+    double time = get_time();
+    EXPECT_LT(num_steps, max_steps) << "max steps exceeded";
+    EXPECT_EQ(0, counts.alive);
+
+    size_type num_tracks_started = counter_->num_tracks() - start_tracks;
+    double    edep = counter_->energy_deposition() - start_edep;
+
+    nlohmann::json result = {
+        {"num_primaries", num_primaries},
+        {"num_track_slots", num_tracks},
+        {"num_threads", get_num_threads()},
+        {"real_type", celeritas_real_type},
+        {"concurrent_actions", this->concurrent_actions()},
+        {"init_policy", to_cstring(this->init_policy())},
+        {"transparent_boundaries", this->transparent_boundaries()},
+        {"num_steps", num_steps},
+        {"num_tracks", num_tracks_started},
+        {"max_queued", max_queued},
+        {"energy_deposition", edep},
+        {"time", time},
+        {"steps_per_sec", num_steps / time},
+        {"tracks_per_sec", num_tracks_started / time},
+        {"peak_memory_kib", get_peak_memory_kib()},
+    };
+    {
+        const auto& actions    = step.actions().actions();
+        const auto& accum_time = step.actions().accum_time();
+        CELER_ASSERT(actions.size() == accum_time.size());
+        nlohmann::json action_times = nlohmann::json::object();
+        for (auto i : range(actions.size()))
+        {
+            action_times[actions[i]->label()] = accum_time[i];
+        }
+        result["actions"] = std::move(action_times);
+    }
+    BenchmarkEnvironment::results()[name] = result;
+
+    const std::string& baseline_filename
+        = celeritas::getenv("CELER_BENCH_BASELINE");
+    if (baseline_filename.empty())
+    {
+        return;
+    }
+
+    std::ifstream infile(baseline_filename);
+    CELER_VALIDATE(infile,
+                   << "failed to open baseline file '" << baseline_filename
+                   << "'");
+    auto baseline = nlohmann::json::parse(infile);
+    if (!baseline.contains(name))
+    {
+        GTEST_SKIP() << "No baseline for problem '" << name << "'";
+    }
+    const auto& expected = baseline[name];
+    for (const char* key : {"num_primaries", "num_track_slots", "num_threads"})
+    {
+        if (expected.at(key) != result.at(key))
+        {
+            GTEST_SKIP() << "Baseline " << key << " (" << expected.at(key)
+                         << ") does not match this run (" << result.at(key)
+                         << ")";
+        }
+    }
+
+    if (expected.value("real_type", "") == result.at("real_type"))
+    {
+        // Same seed and problem: the physics should be identical
+        EXPECT_EQ(expected.at("num_steps").get<size_type>(), num_steps);
+    }
+    else
+    {
+        // Single precision samples different random numbers: compare tallies
+        double phys_tol
+            = getenv_fraction("CELER_BENCH_PHYSICS_TOLERANCE", 0.02);
+        for (const char* key : {"num_steps", "num_tracks", "energy_deposition"})
+        {
+            double exp_val = expected.at(key).get<double>();
+            double act_val = result.at(key).get<double>();
+            EXPECT_SOFT_NEAR(exp_val, act_val, phys_tol)
+                << "Physics tally '" << key << "' for '" << name
+                << "' differs from the " << expected.value("real_type", "?")
+                << " baseline";
+        }
+    }
+
+    double tol = getenv_fraction("CELER_BENCH_TOLERANCE", 0.1);
+    double expected_rate = expected.at("steps_per_sec").get<double>();
+    EXPECT_GE(result["steps_per_sec"].get<double>(), (1 - tol) * expected_rate)
+        << "Throughput for '" << name << "' regressed more than " << tol * 100
+        << "% from the baseline";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering of gammas in a single box, without Geant4 data.
+ */
+class SimpleBenchmarkTest : public SimpleTestBase, public BenchmarkTestBase
+{
+  public:
+    //! Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+    size_type default_num_primaries() const override { return 256; }
+    size_type production_num_primaries() const override { return 262144; }
+
+    //! Discard electrons, which the simple physics can't transport
+    void SetUp() override
+    {
+        this->insert_clear_secondaries();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Electromagnetic showers in the TestEm3 sampling calorimeter.
+ */
+#define TestEm3BenchmarkTest TEST_IF_CELERITAS_GEANT(TestEm3BenchmarkTest)
+class TestEm3BenchmarkTest : public TestEm3Base, public BenchmarkTestBase
+{
+  public:
+    //! Make 10 GeV electrons along +x
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        CELER_ASSERT(p.particle_id);
+        p.energy    = MevEnergy{10000};
+        p.track_id  = TrackId{0};
+        p.position  = {-22, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time      = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    size_type max_average_steps() const override { return 100000; }
+    size_type default_num_primaries() const override { return 2; }
+    size_type production_num_primaries() const override { return 64; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 showers with multiple scattering.
+ */
+#define TestEm3MscBenchmarkTest TEST_IF_CELERITAS_GEANT(TestEm3MscBenchmarkTest)
+class TestEm3MscBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Use MSC
+    bool enable_msc() const override { return true; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 with the minimal MSC step limitation.
+ *
+ * Compare the energy deposition to the default MSC problem to check the
+ * effect of the cheaper step limitation on the physics.
+ */
+#define TestEm3MscMinimalBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3MscMinimalBenchmarkTest)
+class TestEm3MscMinimalBenchmarkTest : public TestEm3MscBenchmarkTest
+{
+  public:
+    //! Limit MSC steps without querying the safety distance
+    MscStepLimitAlgorithm msc_step_limit() const override
+    {
+        return MscStepLimitAlgorithm::minimal;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 with coarse production cuts in the back half of the absorbers.
+ *
+ * The energy deposition shows the effect of the cuts on the physics.
+ */
+#define TestEm3RegionCutsBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3RegionCutsBenchmarkTest)
+class TestEm3RegionCutsBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Use 1 cm production cuts in the back half of the lead absorbers
+    GeantPhysicsOptions build_geant_options() const override
+    {
+        GeantRegionCuts dead;
+        dead.name           = "dead";
+        dead.production_cut = 1;
+        for (auto i : range(25, 50))
+        {
+            dead.volumes.push_back("absorber_lv_" + std::to_string(i));
+        }
+
+        auto result = TestEm3BenchmarkTest::build_geant_options();
+        result.region_cuts.push_back(std::move(dead));
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 in a uniform magnetic field.
+ */
+#define TestEm3FieldBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3FieldBenchmarkTest)
+class TestEm3FieldBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Fluctuations aren't supported with the field along-step action
+    bool enable_fluctuation() const override { return false; }
+
+    //! Volumes that ignore the field
+    virtual std::vector<std::string> field_free_volumes() const { return {}; }
+
+    //! Propagate charged particles in a 1 T field along z
+    SPConstAction build_along_step() override
+    {
+        UniformFieldParams field_params;
+        field_params.field = {0, 0, 1 * units::tesla};
+
+        auto names = this->field_free_volumes();
+        std::shared_ptr<const FieldRegionParams> field_region;
+        if (!names.empty())
+        {
+            field_region = std::make_shared<FieldRegionParams>(
+                FieldRegionParams::field_free_volumes(*this->geometry(),
+                                                      names));
+        }
+        auto result = AlongStepUniformMscAction::from_params(
+            *this->physics(),
+            field_params,
+            this->action_reg().get(),
+            std::move(field_region));
+        CELER_ENSURE(result->has_field_region() == !names.empty());
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 in a field that is neglected in the back of the calorimeter.
+ */
+#define TestEm3FieldFreeBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3FieldFreeBenchmarkTest)
+class TestEm3FieldFreeBenchmarkTest : public TestEm3FieldBenchmarkTest
+{
+  public:
+    //! Neglect the field in the back half of the calorimeter
+    std::vector<std::string> field_free_volumes() const override
+    {
+        std::vector<std::string> result;
+        for (auto i : range(25, 50))
+        {
+            result.push_back("gap_lv_" + std::to_string(i));
+            result.push_back("absorber_lv_" + std::to_string(i));
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 with independent interaction actions run as concurrent host tasks.
+ *
+ * This matters most in the shower tail when each model has few tracks.
+ */
+#define TestEm3ConcurrentBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3ConcurrentBenchmarkTest)
+class TestEm3ConcurrentBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Run the interactions of different models as concurrent tasks
+    bool concurrent_actions() const override { return true; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 with each order in which initializers fill empty track slots.
+ *
+ * The order bounds the peak number of queued initializers in showers.
+ */
+#define TestEm3InitPolicyBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3InitPolicyBenchmarkTest)
+class TestEm3InitPolicyBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Policy for the current run
+    TrackInitPolicy init_policy() const override { return policy; }
+
+    TrackInitPolicy policy{TrackInitPolicy::lifo};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * TestEm3 with photons passing through same-material boundaries.
+ *
+ * This reduces the number of steps in segmented calorimeters.
+ */
+#define TestEm3TransparentBenchmarkTest \
+    TEST_IF_CELERITAS_GEANT(TestEm3TransparentBenchmarkTest)
+class TestEm3TransparentBenchmarkTest : public TestEm3BenchmarkTest
+{
+  public:
+    //! Don't stop neutral particles at same-material boundaries
+    bool transparent_boundaries() const override { return true; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time host secondary allocation as the number of threads increases.
+ *
+ * Each track slot allocates one to three secondaries per step, as an
+ * interaction kernel would, with either a single atomic size or per-thread
+ * chunks that are compacted at the end of the step. The number of threads is
+ * doubled up to \c OMP_NUM_THREADS, and \c CELER_BENCH_PRODUCTION increases
+ * the number of track slots and steps.
+ */
+class SecondaryAllocBenchmarkTest : public Test
+{
+  public:
+    using HostData
+        = StackAllocatorData<Secondary, Ownership::value, MemSpace::host>;
+    using HostRef
+        = StackAllocatorData<Secondary, Ownership::reference, MemSpace::host>;
+
+    // Allocate secondaries for all steps and return the elapsed time
+    double run(size_type chunk_size, int num_threads) const;
+
+    size_type num_tracks{4096};
+    size_type num_steps{16};
+};
+
+//---------------------------------------------------------------------------//
+double SecondaryAllocBenchmarkTest::run(size_type chunk_size,
+                                        int       num_threads) const
+{
+    size_type expected_size = 0;
+    for (auto i : range(num_tracks))
+    {
+        expected_size += 1 + i % 3;
+    }
+
+    HostData data;
+    resize(&data, 3 * num_tracks, chunk_size);
+    HostRef ref;
+    ref = data;
+
+    std::vector<Span<Secondary>>  secondaries(num_tracks);
+    std::vector<Span<Secondary>*> allocations(num_tracks);
+    for (auto i : range(num_tracks))
+    {
+        allocations[i] = &secondaries[i];
+    }
+
+    Stopwatch get_time;
+    for (size_type step = 0; step < num_steps; ++step)
+    {
+        StackAllocator<Secondary> allocate(ref);
+        allocate.clear();
+
+#pragma omp parallel for num_threads(num_threads)
+        for (size_type i = 0; i < num_tracks; ++i)
+        {
+            StackAllocator<Secondary> allocate_thread(ref);
+            size_type                 count = 1 + i % 3;
+            Secondary*                ptr   = allocate_thread(count);
+            CELER_ASSERT(ptr);
+            secondaries[i] = {ptr, count};
+        }
+
+        if (allocate.chunked())
+        {
+            allocate.compact(make_span(allocations));
+        }
+        CELER_ASSERT(allocate.size() == expected_size);
+    }
+    return get_time();
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleBenchmarkTest, host)
+{
+    this->run_benchmark("simple");
+}
+
+TEST_F(TestEm3BenchmarkTest, host)
+{
+    this->run_benchmark("testem3");
+}
+
+TEST_F(TestEm3MscBenchmarkTest, host)
+{
+    this->run_benchmark("testem3-msc");
+}
+
+TEST_F(TestEm3MscMinimalBenchmarkTest, host)
+{
+    // Compare step count, throughput, and energy deposition against
+    // "testem3-msc"
+    this->run_benchmark("testem3-msc-minimal");
+}
+
+TEST_F(TestEm3RegionCutsBenchmarkTest, host)
+{
+    // Lead with coarse cuts is a separate material-cuts couple
+    EXPECT_EQ(2, this->material()->find_materials("Pb").size());
+
+    // Compare the number of tracks and throughput against "testem3"
+    this->run_benchmark("testem3-region-cuts");
+}
+
+TEST_F(TestEm3FieldBenchmarkTest, host)
+{
+    this->run_benchmark("testem3-field");
+}
+
+TEST_F(TestEm3FieldFreeBenchmarkTest, host)
+{
+    // Compare the along-step time for charged particles against
+    // "testem3-field"
+    this->run_benchmark("testem3-field-free");
+}
+
+TEST_F(TestEm3ConcurrentBenchmarkTest, host)
+{
+    this->run_benchmark("testem3-concurrent");
+}
+
+TEST_F(TestEm3TransparentBenchmarkTest, host)
+{
+    // Compare step count and throughput against "testem3"
+    this->run_benchmark("testem3-transparent");
+}
+
+TEST_F(TestEm3InitPolicyBenchmarkTest, host)
+{
+    // Compare the peak number of queued initializers for each policy
+    for (auto p : range(TrackInitPolicy::size_))
+    {
+        policy = p;
+        this->run_benchmark(std::string("testem3-init-") + to_cstring(p));
+    }
+}
+
+TEST_F(SecondaryAllocBenchmarkTest, host)
+{
+    if (!celeritas::getenv("CELER_BENCH_PRODUCTION").empty())
+    {
+        num_tracks = 1048576;
+        num_steps  = 64;
+    }
+    const size_type chunk_size = 64;
+
+    nlohmann::json atomic_times  = nlohmann::json::object();
+    nlohmann::json chunked_times = nlohmann::json::object();
+    for (int n = 1; n <= get_num_threads(); n *= 2)
+    {
+        atomic_times[std::to_string(n)]  = this->run(0, n);
+        chunked_times[std::to_string(n)] = this->run(chunk_size, n);
+    }
+
+    BenchmarkEnvironment::results()["secondary-alloc"] = {
+        {"num_track_slots", num_tracks},
+        {"num_steps", num_steps},
+        {"chunk_size", chunk_size},
+        {"atomic", std::move(atomic_times)},
+        {"chunked", std::move(chunked_times)},
+    };
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
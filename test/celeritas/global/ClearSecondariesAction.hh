@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ClearSecondariesAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Discard secondaries, since the simple physics cannot transport electrons.
+ */
+class ClearSecondariesAction final : public ExplicitActionInterface,
+                                     public ConcreteAction
+{
+  public:
+    // Construct with ID and label
+    using ConcreteAction::ConcreteAction;
+
+    void execute(CoreHostRef const& data) const final
+    {
+        for (auto tid : range(ThreadId{data.states.size()}))
+        {
+            CoreTrackView track(data.params, data.states, tid);
+            track.make_physics_step_view().secondaries({});
+        }
+    }
+
+    void execute(CoreDeviceRef const&) const final
+    {
+        CELER_NOT_IMPLEMENTED("device");
+    }
+
+    ActionOrder order() const final { return ActionOrder::post_post; }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -0,0 +1,183 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EnergyMonitor.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/EnergyMonitorAction.hh"
+
+#include <algorithm>
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/TrackSlotPolicy.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EnergyMonitorTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    using Input = EnergyMonitorAction::Input;
+
+    //! Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    std::shared_ptr<EnergyMonitorAction>
+    add_monitor(size_type num_track_slots = num_tracks)
+    {
+        Input inp;
+        inp.num_track_slots = num_track_slots;
+        inp.num_events      = num_primaries;
+        return EnergyMonitorAction::from_params(
+            *this->particle(), inp, this->action_reg().get());
+    }
+
+    RunResult run_host()
+    {
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 2));
+        return this->run(step, num_primaries);
+    }
+
+  protected:
+    static constexpr size_type num_primaries = 512;
+    static constexpr size_type num_tracks    = 512;
+};
+
+constexpr size_type EnergyMonitorTest::num_primaries;
+constexpr size_type EnergyMonitorTest::num_tracks;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EnergyMonitorTest, input)
+{
+    Input inp;
+    inp.num_track_slots = 16;
+    EXPECT_FALSE(inp);
+    EXPECT_THROW(EnergyMonitorAction::from_params(
+                     *this->particle(), inp, this->action_reg().get()),
+                 RuntimeError);
+}
+
+TEST_F(EnergyMonitorTest, conserved)
+{
+    auto monitor = this->add_monitor();
+    this->insert_clear_secondaries();
+
+    auto setup = this->check_setup();
+    static const char* const expected_actions[] = {"energy-monitor-pre",
+                                                   "pre-step",
+                                                   "along-step-neutral",
+                                                   "physics-discrete-select",
+                                                   "scat-klein-nishina",
+                                                   "geo-boundary",
+                                                   "dummy-action",
+                                                   "energy-monitor",
+                                                   "clear-secondaries"};
+    EXPECT_VEC_EQ(expected_actions, setup.actions);
+
+    auto result = this->run_host();
+    ASSERT_TRUE(result);
+
+    auto tallies = monitor->tallies();
+    ASSERT_EQ(num_primaries, tallies.size());
+    size_type num_scattered = 0;
+    for (const EnergyTally& t : tallies)
+    {
+        EXPECT_SOFT_EQ(1.0, t.primary);
+        EXPECT_EQ(0, t.deposited);
+        EXPECT_SOFT_EQ(t.primary, t.escaped + t.secondary);
+        EXPECT_SOFT_NEAR(0, t.imbalance, 1e-12);
+        if (t.secondary > 0)
+        {
+            ++num_scattered;
+        }
+    }
+    EXPECT_LT(0, num_scattered);
+    EXPECT_EQ(0, monitor->nonconserving_events().size());
+}
+
+TEST_F(EnergyMonitorTest, resized)
+{
+    // Start with few slots that grow while primaries are queued
+    const size_type initial_slots = 8;
+    auto            monitor       = this->add_monitor(initial_slots);
+    this->insert_clear_secondaries();
+
+    ScaledTrackSlotPolicy::Input slot_inp;
+    slot_inp.min_slots = 4;
+    slot_inp.max_slots = 128;
+
+    StepperInput inp = this->make_stepper_input(initial_slots, 64);
+    inp.slot_policy  = std::make_shared<ScaledTrackSlotPolicy>(slot_inp);
+    Stepper<MemSpace::host> step(std::move(inp));
+
+    size_type num_steps = 1;
+    size_type max_slots = 0;
+    auto      counts    = step(this->make_primaries(num_primaries));
+    while (counts)
+    {
+        ASSERT_LT(num_steps++, 1000);
+        max_slots = std::max(max_slots, counts.slots);
+        counts    = step();
+    }
+    EXPECT_EQ(128, max_slots);
+
+    // Every event is tallied once despite its tracks changing slots
+    auto tallies = monitor->tallies();
+    ASSERT_EQ(num_primaries, tallies.size());
+    for (const EnergyTally& t : tallies)
+    {
+        EXPECT_SOFT_EQ(1.0, t.primary);
+        EXPECT_SOFT_EQ(t.primary, t.escaped + t.secondary);
+        EXPECT_SOFT_NEAR(0, t.imbalance, 1e-12);
+    }
+    EXPECT_EQ(0, monitor->nonconserving_events().size());
+}
+
+TEST_F(EnergyMonitorTest, lost_secondaries)
+{
+    // Discarding secondaries before the monitor sees them loses energy
+    this->insert_clear_secondaries();
+    auto monitor = this->add_monitor();
+
+    auto result = this->run_host();
+    ASSERT_TRUE(result);
+
+    auto      tallies = monitor->tallies();
+    size_type num_lost = 0;
+    for (const EnergyTally& t : tallies)
+    {
+        EXPECT_EQ(0, t.secondary);
+        EXPECT_SOFT_EQ(t.primary, t.escaped + t.imbalance);
+        if (t.imbalance > 0)
+        {
+            ++num_lost;
+        }
+    }
+    EXPECT_LT(0, num_lost);
+    EXPECT_EQ(num_lost, monitor->nonconserving_events().size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/EventTally.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/EventTallyAction.hh"
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EventTallyTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    //! Make isotropic 1 MeV gammas, two per event, in the detector center
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count, 2);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    void SetUp() override
+    {
+        auto& action_reg = *this->action_reg();
+        tally_ = std::make_shared<EventTallyAction>(action_reg.next_id(),
+                                                    MemSpace::host);
+        action_reg.insert(tally_);
+        this->insert_clear_secondaries();
+    }
+
+  protected:
+    static constexpr size_type num_primaries = 64;
+    static constexpr size_type num_tracks    = 16;
+
+    std::shared_ptr<EventTallyAction> tally_;
+};
+
+constexpr size_type EventTallyTest::num_primaries;
+constexpr size_type EventTallyTest::num_tracks;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventTallyTest, host)
+{
+    const size_type num_events = num_primaries / 2;
+    tally_->reset(num_events);
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 8));
+
+    // Step until all events are done, saving the step at which each finished
+    std::vector<int> completion_step(num_events, -1);
+    std::vector<EventTally> completed(num_events);
+    auto counts = step(this->make_primaries(num_primaries));
+    for (int step_idx = 0; counts; ++step_idx)
+    {
+        for (const auto& event_result : tally_->pop_completed(
+                 step.track_counters()))
+        {
+            auto event = event_result.first.get();
+            ASSERT_LT(event, num_events);
+            EXPECT_EQ(-1, completion_step[event]) << "event " << event;
+            completion_step[event] = step_idx;
+            completed[event]       = event_result.second;
+        }
+        ASSERT_LT(step_idx, 1000);
+        counts = step();
+    }
+    for (const auto& event_result :
+         tally_->pop_completed(step.track_counters()))
+    {
+        completion_step[event_result.first.get()] = -2;
+        completed[event_result.first.get()]       = event_result.second;
+    }
+
+    // Secondaries are discarded, so each event has only its two primaries
+    auto track_counters = step.track_counters();
+    ASSERT_EQ(num_events, track_counters.size());
+    size_type total_steps = 0;
+    for (auto i : range(num_events))
+    {
+        EXPECT_EQ(2, track_counters[i]);
+        EXPECT_EQ(2, completed[i].num_tracks);
+        EXPECT_LE(2, completed[i].num_steps);
+        EXPECT_EQ(0, completed[i].energy_deposition);
+        EXPECT_NE(-1, completion_step[i]) << "event " << i;
+        total_steps += completed[i].num_steps;
+    }
+
+    // Events in the first batch of track slots finish before the last ones
+    // start
+    EXPECT_LT(completion_step.front(), completion_step.back());
+    EXPECT_TRUE(tally_->pop_completed(track_counters).empty());
+
+    // Steps are all accounted for
+    size_type accum_steps = 0;
+    for (const EventTally& t : tally_->tallies())
+    {
+        accum_steps += t.num_steps;
+    }
+    EXPECT_EQ(total_steps, accum_steps);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
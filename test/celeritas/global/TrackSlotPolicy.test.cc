@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TrackSlotPolicy.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/TrackSlotPolicy.hh"
+
+#include <algorithm>
+
+#include "corecel/io/Repr.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/EventTallyAction.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class DynamicSlotsTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    //! Make isotropic 1 MeV gammas, two per event, in the detector center
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count, 2);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    void SetUp() override
+    {
+        auto& action_reg = *this->action_reg();
+        tally_ = std::make_shared<EventTallyAction>(action_reg.next_id(),
+                                                    MemSpace::host);
+        action_reg.insert(tally_);
+        this->insert_clear_secondaries();
+    }
+
+  protected:
+    std::shared_ptr<EventTallyAction> tally_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ScaledTrackSlotPolicyTest, scaling)
+{
+    ScaledTrackSlotPolicy::Input inp;
+    inp.min_slots = 4;
+    inp.max_slots = 100;
+    ScaledTrackSlotPolicy choose_slots(inp);
+
+    auto counts = [](size_type alive, size_type queued) {
+        StepperResult result;
+        result.alive  = alive;
+        result.queued = queued;
+        return result;
+    };
+
+    // Grow when tracks are queued, up to the maximum
+    EXPECT_EQ(32, choose_slots(16, counts(16, 1)));
+    EXPECT_EQ(100, choose_slots(64, counts(64, 100)));
+    EXPECT_EQ(100, choose_slots(100, counts(100, 100)));
+
+    // Keep the size in the hysteresis band
+    EXPECT_EQ(16, choose_slots(16, counts(16, 0)));
+    EXPECT_EQ(16, choose_slots(16, counts(4, 0)));
+    EXPECT_EQ(16, choose_slots(16, counts(2, 2)));
+
+    // Shrink when mostly empty, down to the minimum
+    EXPECT_EQ(8, choose_slots(16, counts(3, 0)));
+    EXPECT_EQ(4, choose_slots(4, counts(0, 0)));
+    EXPECT_EQ(4, choose_slots(6, counts(1, 0)));
+
+    // Invalid options
+    inp.min_occupancy = 0.5;
+    EXPECT_THROW(ScaledTrackSlotPolicy{inp}, RuntimeError);
+}
+
+TEST_F(DynamicSlotsTest, host)
+{
+    const size_type num_primaries = 64;
+    const size_type num_events    = num_primaries / 2;
+    tally_->reset(num_events);
+
+    ScaledTrackSlotPolicy::Input slot_inp;
+    slot_inp.min_slots = 4;
+    slot_inp.max_slots = 32;
+
+    StepperInput inp = this->make_stepper_input(8, 16);
+    inp.slot_policy  = std::make_shared<ScaledTrackSlotPolicy>(slot_inp);
+    Stepper<MemSpace::host> step(std::move(inp));
+    EXPECT_EQ(8, step.num_track_slots());
+
+    // Step until all events are done, saving the number of slots
+    std::vector<size_type> slots;
+    auto counts = step(this->make_primaries(num_primaries));
+    slots.push_back(counts.slots);
+    while (counts)
+    {
+        ASSERT_LT(slots.size(), 1000);
+        counts = step();
+        EXPECT_EQ(counts.slots, step.num_track_slots());
+        slots.push_back(counts.slots);
+    }
+
+    // Slots grow while primaries are queued and shrink as the events finish
+    auto max_slots = std::max_element(slots.begin(), slots.end());
+    EXPECT_EQ(32, *max_slots);
+    EXPECT_TRUE(std::is_sorted(slots.begin(), max_slots)) << repr(slots);
+    EXPECT_TRUE(std::is_sorted(slots.rbegin(),
+                               std::make_reverse_iterator(max_slots)))
+        << repr(slots);
+    EXPECT_LT(slots.back(), *max_slots) << repr(slots);
+
+    // Moved tracks are neither duplicated nor lost
+    auto track_counters = step.track_counters();
+    ASSERT_EQ(num_events, track_counters.size());
+    auto completed = tally_->pop_completed(track_counters);
+    EXPECT_EQ(num_events, completed.size());
+    for (const auto& event_result : completed)
+    {
+        EXPECT_EQ(2, event_result.second.num_tracks);
+        EXPECT_LE(2, event_result.second.num_steps);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
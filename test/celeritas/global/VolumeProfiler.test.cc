@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/VolumeProfiler.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/VolumeProfilerAction.hh"
+
+#include "celeritas_config.h"
+#include "corecel/io/JsonPimpl.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/global/VolumeProfilerOutput.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class VolumeProfilerTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    using Input = VolumeProfilerAction::Input;
+
+    //! Make isotropic 1 MeV gammas in the center of the detector
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        return this->make_isotropic_gammas(count);
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    std::shared_ptr<VolumeProfilerAction> add_profiler(size_type num_copies)
+    {
+        Input inp;
+        inp.num_copies = num_copies;
+        return VolumeProfilerAction::from_params(
+            *this->geometry(), inp, this->action_reg().get());
+    }
+
+    RunResult run_host()
+    {
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks, 2));
+        return this->run(step, num_primaries);
+    }
+
+  protected:
+    static constexpr size_type num_primaries = 256;
+    static constexpr size_type num_tracks    = 256;
+};
+
+constexpr size_type VolumeProfilerTest::num_primaries;
+constexpr size_type VolumeProfilerTest::num_tracks;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(VolumeProfilerTest, input)
+{
+    Input inp;
+    inp.num_copies = 0;
+    EXPECT_FALSE(inp);
+    EXPECT_THROW(VolumeProfilerAction::from_params(
+                     *this->geometry(), inp, this->action_reg().get()),
+                 RuntimeError);
+}
+
+TEST_F(VolumeProfilerTest, host)
+{
+    auto profiler = this->add_profiler(7);
+    this->insert_clear_secondaries();
+
+    auto setup = this->check_setup();
+    static const char* const expected_actions[] = {"volume-profiler-pre",
+                                                   "pre-step",
+                                                   "along-step-neutral",
+                                                   "volume-profiler",
+                                                   "physics-discrete-select",
+                                                   "scat-klein-nishina",
+                                                   "geo-boundary",
+                                                   "dummy-action",
+                                                   "clear-secondaries"};
+    EXPECT_VEC_EQ(expected_actions, setup.actions);
+
+    auto result = this->run_host();
+    ASSERT_TRUE(result);
+
+    auto tallies = profiler->tallies();
+    ASSERT_EQ(this->geometry()->num_volumes(), tallies.size());
+    std::vector<ull_int>   steps, crossings, zero_safety;
+    std::vector<real_type> length;
+    for (const VolumeTally& t : tallies)
+    {
+        steps.push_back(t.steps);
+        crossings.push_back(t.crossings);
+        zero_safety.push_back(t.zero_safety);
+        length.push_back(t.length);
+    }
+
+    // Volumes are exterior, inner, world: every photon leaves both boxes,
+    // and only the steps entering the world start on a boundary
+    static const ull_int expected_steps[]       = {0ull, 275ull, 256ull};
+    static const ull_int expected_crossings[]   = {0ull, 256ull, 256ull};
+    static const ull_int expected_zero_safety[] = {0ull, 0ull, 256ull};
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+    static const double  expected_length[]
+        = {0, 1577.6296591626, 14057.468030764};
+#else
+    static const double  expected_length[]
+        = {0, 1605.5618896484, 14152.41015625};
+#endif
+    EXPECT_VEC_EQ(expected_steps, steps);
+    EXPECT_VEC_EQ(expected_crossings, crossings);
+    EXPECT_VEC_EQ(expected_zero_safety, zero_safety);
+    EXPECT_VEC_SOFT_EQ(expected_length, length);
+
+    if (CELERITAS_USE_JSON)
+    {
+        VolumeProfilerOutput out(profiler, this->geometry(), 1);
+        EXPECT_EQ("volume-hotspots", out.label());
+#if CELERITAS_USE_JSON
+        JsonPimpl json_wrap;
+        out.output(&json_wrap);
+        const auto& hotspots = json_wrap.obj.at("hotspots");
+        ASSERT_EQ(1, hotspots.size());
+        EXPECT_EQ("inner", hotspots[0].at("label").get<std::string>());
+        EXPECT_EQ(275, hotspots[0].at("steps").get<ull_int>());
+        EXPECT_EQ(531, json_wrap.obj.at("total").at("steps").get<ull_int>());
+#endif
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
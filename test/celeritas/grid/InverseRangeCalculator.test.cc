@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/grid/InverseRangeCalculator.hh"
 
+#include "corecel/cont/Range.hh"
 #include "corecel/math/SoftEqual.hh"
+#include "celeritas/grid/InverseRangeInserter.hh"
 
 #include "CalculatorTestBase.hh"
 #include "celeritas_test.hh"
@@ -64,6 +66,45 @@ TEST_F(InverseRangeCalculatorTest, all)
 #endif
 }
 
+TEST_F(InverseRangeCalculatorTest, uniform_lookup)
+{
+    // Energy from 1e-3 to 1e2 MeV; range scales nonlinearly with energy
+    this->build(1e-3, 1e2, 51);
+    for (real_type& r : this->mutable_values())
+    {
+        r = 0.1 * std::pow(r, real_type(1.7)) + 1e-4 * r;
+    }
+    auto range = this->mutable_values();
+
+    Collection<size_type, Ownership::value, MemSpace::host> bins;
+    InverseRangeInserter insert(&bins);
+    InverseRangeGridData inverse = insert(range);
+    ASSERT_TRUE(inverse);
+    EXPECT_EQ(101, inverse.log_range.size);
+
+    Collection<size_type, Ownership::const_reference, MemSpace::host> bins_ref(
+        bins);
+    InverseRangeCalculator calc_energy(this->data(), this->values());
+    InverseRangeCalculator calc_fast_energy(
+        this->data(), this->values(), inverse, bins_ref);
+
+    // Results should be identical, including at grid points and below/above
+    // the tabulated range
+    EXPECT_EQ(calc_energy(range.back()).value(),
+              calc_fast_energy(range.back()).value());
+    EXPECT_EQ(calc_energy(0.5 * range.front()).value(),
+              calc_fast_energy(0.5 * range.front()).value());
+    for (auto i : celeritas::range(range.size() - 1))
+    {
+        for (real_type frac : {0.0, 1e-12, 0.25, 0.5, 0.999999})
+        {
+            real_type r = range[i] + frac * (range[i + 1] - range[i]);
+            EXPECT_EQ(calc_energy(r).value(), calc_fast_energy(r).value())
+                << "at r=" << r;
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -72,7 +72,7 @@ TEST_F(UniformGridTest, from_bounds)
     EXPECT_EQ(1, grid.find(0.0));
 }
 
-TEST_F(UniformGridTest, from_logbounds)
+TEST_F(UniformGridTest, TEST_IF_CELERITAS_DOUBLE(from_logbounds))
 {
     const double log_emin = std::log(1.0);
     const double log_emax = std::log(1e5);
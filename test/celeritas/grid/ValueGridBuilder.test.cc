@@ -68,10 +68,10 @@ TEST_F(ValueGridBuilderTest, xs_grid)
             1e1, 1e2, 1e3, VecReal{.1, .2 * 1e2, .3 * 1e3}));
     }
     {
-        const real_type lambda_energy[]      = {1e-3, 1e-2, 1e-1};
-        const real_type lambda[]             = {10, 1, .1};
-        const real_type lambda_prim_energy[] = {1e-1, 1e0, 10};
-        const real_type lambda_prim[]        = {.1 * 1e-1, .01 * 1, .001 * 10};
+        const double lambda_energy[]      = {1e-3, 1e-2, 1e-1};
+        const double lambda[]             = {10, 1, .1};
+        const double lambda_prim_energy[] = {1e-1, 1e0, 10};
+        const double lambda_prim[]        = {.1 * 1e-1, .01 * 1, .001 * 10};
 
         entries.push_back(Builder_t::from_geant(
             lambda_energy, lambda, lambda_prim_energy, lambda_prim));
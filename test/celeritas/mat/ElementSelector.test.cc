@@ -73,15 +73,11 @@ class ElementSelectorTest : public Test
         };
         mats      = std::make_shared<MaterialParams>(std::move(inp));
         host_mats = mats->host_ref();
-
-        // Allocate storage
-        storage.assign(mats->max_element_components(), -1);
     }
 
     std::shared_ptr<MaterialParams> mats;
     MaterialParamsRef               host_mats;
     RandomEngine                    rng;
-    std::vector<real_type>          storage;
 };
 
 // Return cross section proportional to the element ID offset by 1.
@@ -111,6 +107,19 @@ struct CalcFancyMicroXs
     real_type                inv_energy_;
 };
 
+// Calculate the cross section of every component
+template<class Selector>
+std::vector<real_type>
+elemental_micro_xs(const MaterialView& material, const Selector& select_el)
+{
+    std::vector<real_type> result;
+    for (auto id : range(ElementComponentId{material.num_elements()}))
+    {
+        result.push_back(select_el.elemental_micro_xs(id));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -119,20 +128,19 @@ struct CalcFancyMicroXs
 TEST_F(ElementSelectorTest, TEST_IF_CELERITAS_DEBUG(vacuum))
 {
     MaterialView material(mats->host_ref(), mats->find_material("hard_vacuum"));
-    EXPECT_THROW(ElementSelector(material, mock_micro_xs, make_span(storage)),
-                 DebugError);
+    EXPECT_THROW(make_element_selector(material, mock_micro_xs), DebugError);
 }
 
 //! Single element should always select the first one.
 TEST_F(ElementSelectorTest, single)
 {
-    MaterialView    material(host_mats, mats->find_material("Al"));
-    ElementSelector select_el(material, mock_micro_xs, make_span(storage));
+    MaterialView material(host_mats, mats->find_material("Al"));
+    auto         select_el = make_element_selector(material, mock_micro_xs);
 
-    // Construction should have precalculated cross sections
+    // Construction should have calculated the total cross section
     const double expected_elemental_micro_xs[] = {3};
     EXPECT_VEC_SOFT_EQ(expected_elemental_micro_xs,
-                       select_el.elemental_micro_xs());
+                       elemental_micro_xs(material, select_el));
     EXPECT_SOFT_EQ(3.0, select_el.material_micro_xs());
 
     // Select a single element
@@ -144,15 +152,15 @@ TEST_F(ElementSelectorTest, single)
 }
 
 //! Equal number densities but unequal cross sections
-TEST_F(ElementSelectorTest, everything_even)
+TEST_F(ElementSelectorTest, TEST_IF_CELERITAS_DOUBLE(everything_even))
 {
     MaterialView material(host_mats, mats->find_material("everything_even"));
-    ElementSelector select_el(material, mock_micro_xs, make_span(storage));
+    auto         select_el = make_element_selector(material, mock_micro_xs);
 
     // Test cross sections
     const double expected_elemental_micro_xs[] = {1, 2, 3, 4};
     EXPECT_VEC_SOFT_EQ(expected_elemental_micro_xs,
-                       select_el.elemental_micro_xs());
+                       elemental_micro_xs(material, select_el));
     EXPECT_SOFT_EQ(2.5, select_el.material_micro_xs());
 
     // Select a single element
@@ -184,16 +192,16 @@ TEST_F(ElementSelectorTest, everything_even)
 }
 
 //! Number densities scaled to 1/xs so equiprobable
-TEST_F(ElementSelectorTest, everything_weighted)
+TEST_F(ElementSelectorTest, TEST_IF_CELERITAS_DOUBLE(everything_weighted))
 {
-    MaterialView    material(host_mats,
+    MaterialView material(host_mats,
                           mats->find_material("everything_weighted"));
-    ElementSelector select_el(material, mock_micro_xs, make_span(storage));
+    auto         select_el = make_element_selector(material, mock_micro_xs);
 
     // Test cross sections
     const double expected_elemental_micro_xs[] = {1, 2, 3, 4};
     EXPECT_VEC_SOFT_EQ(expected_elemental_micro_xs,
-                       select_el.elemental_micro_xs());
+                       elemental_micro_xs(material, select_el));
     EXPECT_SOFT_EQ(1.92, select_el.material_micro_xs());
 
     // Select a single element
@@ -216,7 +224,7 @@ TEST_F(ElementSelectorTest, even_zero_xs)
     MaterialView material(host_mats, mats->find_material("everything_even"));
     auto         calc_xs
         = [](ElementId el) -> real_type { return (el.get() % 2 ? 1 : 0); };
-    ElementSelector select_el(material, calc_xs, make_span(storage));
+    auto select_el = make_element_selector(material, calc_xs);
 
     auto seq_rng = SequenceEngine::from_reals({0.0, 0.01, 0.49, 0.5, 0.51});
     std::vector<int> selection;
@@ -235,14 +243,14 @@ TEST_F(ElementSelectorTest, fancy_xs)
     units::MevEnergy energy{123};
     MaterialView     material(host_mats,
                           mats->find_material("everything_weighted"));
-    ElementSelector  select_el(
-        material, CalcFancyMicroXs{host_mats, energy}, make_span(storage));
+    auto             select_el = make_element_selector(
+        material, CalcFancyMicroXs{host_mats, energy});
 
     // Test cross sections
     const double expected_elemental_micro_xs[] = {
         0.008130081300813, 0.01808113894772, 0.01911654217659, 0.0305389085709};
     EXPECT_VEC_SOFT_EQ(expected_elemental_micro_xs,
-                       select_el.elemental_micro_xs());
+                       elemental_micro_xs(material, select_el));
     EXPECT_SOFT_EQ(0.014965228148605575, select_el.material_micro_xs());
 }
 //---------------------------------------------------------------------------//
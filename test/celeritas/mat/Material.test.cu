@@ -50,21 +50,13 @@ __global__ void m_test_kernel(unsigned int const                  size,
     temperatures[tid.get()] = mat.temperature();
     rad_len[tid.get()]      = mat.radiation_length();
 
-    // Fill elements with finctional cross sections
-    Span<real_type> scratch = mat_track.element_scratch();
-
-    for (auto ec : range(mat.num_elements()))
-    {
-        // Pretend to calculate cross section for the ec'th element
-        const auto& element = mat.make_element_view(ElementComponentId{ec});
-        scratch[ec]         = static_cast<real_type>(element.atomic_number());
-    }
-
     real_type tz = 0.0;
     for (auto ec : range(mat.num_elements()))
     {
         // Get its atomic number weighted by its fractional number density
-        tz += scratch[ec] * mat.get_element_density(ElementComponentId{ec});
+        const auto& element = mat.make_element_view(ElementComponentId{ec});
+        tz += static_cast<real_type>(element.atomic_number())
+              * mat.get_element_density(ElementComponentId{ec});
     }
     tot_z[tid.get()] = tz;
 }
@@ -106,7 +106,7 @@ TEST_F(CutoffParamsTest, empty_cutoffs)
     EXPECT_VEC_SOFT_EQ(expected_ranges, ranges);
 }
 
-TEST_F(CutoffParamsTest, electron_cutoffs)
+TEST_F(CutoffParamsTest, TEST_IF_CELERITAS_DOUBLE(electron_cutoffs))
 {
     CutoffParams::Input           input;
     CutoffParams::MaterialCutoffs mat_cutoffs;
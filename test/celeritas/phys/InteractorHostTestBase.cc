@@ -300,7 +300,7 @@ void InteractorHostTestBase::check_momentum_conservation(
         axpy(-parent_track.momentum().value(), inc_direction_, &delta_momentum);
         EXPECT_SOFT_NEAR(0.0,
                          dot_product(delta_momentum, delta_momentum),
-                         parent_track.momentum().value() * 1e-12)
+                         parent_track.momentum().value() * coarse_eps)
             << "Incident: " << inc_direction_
             << " with p = " << parent_track.momentum().value()
             << "* MeV/c; exiting p = " << exit_momentum;
@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/MortonSort.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/MortonSort.hh"
+
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(MortonSortTest, code)
+{
+    // Quantized coordinates are the same as the real ones
+    const real_type max_int = (1 << 21) - 1;
+    const real_type half    = 1 << 20;
+    const Real3     lower{0, 0, 0};
+    const Real3     upper{max_int, max_int, max_int};
+
+    EXPECT_EQ(0, morton_code({0, 0, 0}, lower, upper));
+    EXPECT_EQ(0x7fffffffffffffffull, morton_code(upper, lower, upper));
+
+    // Bits of each coordinate are interleaved with x lowest
+    EXPECT_EQ(0x1ull, morton_code({1, 0, 0}, lower, upper));
+    EXPECT_EQ(0x2ull, morton_code({0, 1, 0}, lower, upper));
+    EXPECT_EQ(0x4ull, morton_code({0, 0, 1}, lower, upper));
+    EXPECT_EQ(0x38ull, morton_code({2, 2, 2}, lower, upper));
+    EXPECT_EQ(0x1000000000000000ull, morton_code({half, 0, 0}, lower, upper));
+    EXPECT_EQ(0x4000000000000000ull, morton_code({0, 0, half}, lower, upper));
+    EXPECT_EQ(0x1249249249249249ull,
+              morton_code({max_int, 0, 0}, lower, upper));
+
+    // Points outside are clamped, and degenerate axes are ignored
+    EXPECT_EQ(0x1249249249249249ull,
+              morton_code({1e8, -1, -1}, lower, upper));
+    EXPECT_EQ(0x1249249249249249ull,
+              morton_code({1, 5, 5}, {0, 0, 0}, {1, 0, 0}));
+}
+
+TEST(MortonSortTest, sort)
+{
+    // Octant corners of a unit cube, in reverse order, plus duplicates
+    std::vector<Primary> primaries;
+    for (int i = 7; i >= 0; --i)
+    {
+        Primary p;
+        p.position
+            = {real_type(i & 1), real_type((i >> 1) & 1), real_type(i >> 2)};
+        p.event_id = EventId(i);
+        p.track_id = TrackId(0);
+        primaries.push_back(p);
+        if (i % 4 == 0)
+        {
+            p.track_id = TrackId(1);
+            primaries.push_back(p);
+        }
+    }
+
+    morton_sort(make_span(primaries));
+
+    std::vector<int> event_id;
+    std::vector<int> track_id;
+    for (const auto& p : primaries)
+    {
+        event_id.push_back(p.event_id.unchecked_get());
+        track_id.push_back(p.track_id.unchecked_get());
+    }
+    static const int expected_event_id[] = {0, 0, 1, 2, 3, 4, 4, 5, 6, 7};
+    static const int expected_track_id[] = {0, 1, 0, 0, 0, 0, 1, 0, 0, 0};
+    EXPECT_VEC_EQ(expected_event_id, event_id);
+    EXPECT_VEC_EQ(expected_track_id, track_id);
+
+    // Empty and single-element sorts are no-ops
+    morton_sort(Span<Primary>{});
+    morton_sort(make_span(primaries).first(1));
+    EXPECT_EQ(EventId{0}, primaries.front().event_id);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
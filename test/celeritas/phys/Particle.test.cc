@@ -144,7 +144,7 @@ class ParticleTestHost : public ParticleTest
     HostRef<ParticleStateData> state_ref;
 };
 
-TEST_F(ParticleTestHost, electron)
+TEST_F(ParticleTestHost, TEST_IF_CELERITAS_DOUBLE(electron))
 {
     ParticleTrackView particle(
         particle_params->host_ref(), state_ref, ThreadId(0));
@@ -183,7 +183,7 @@ TEST_F(ParticleTestHost, gamma)
     EXPECT_DOUBLE_EQ(10, particle.momentum().value());
 }
 
-TEST_F(ParticleTestHost, neutron)
+TEST_F(ParticleTestHost, TEST_IF_CELERITAS_DOUBLE(neutron))
 {
     ParticleTrackView particle(
         particle_params->host_ref(), state_ref, ThreadId(0));
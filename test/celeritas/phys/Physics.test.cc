@@ -119,7 +119,7 @@ TEST_F(PhysicsParamsTest, accessors)
     EXPECT_VEC_EQ(expected_process_map, process_map);
 }
 
-TEST_F(PhysicsParamsTest, output)
+TEST_F(PhysicsParamsTest, TEST_IF_CELERITAS_DOUBLE(output))
 {
     PhysicsParamsOutput out(this->physics());
     EXPECT_EQ("physics", out.label());
@@ -239,7 +239,7 @@ class PhysicsTrackViewHostTest : public PhysicsParamsTest
     RandomEngine                     rng_;
 };
 
-TEST_F(PhysicsTrackViewHostTest, track_view)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE(track_view))
 {
     PhysicsTrackView gamma = this->make_track_view("gamma", MaterialId{0});
     PhysicsTrackView celer = this->make_track_view("celeriton", MaterialId{1});
@@ -276,7 +276,7 @@ TEST_F(PhysicsTrackViewHostTest, track_view)
                         real_type(1 + 100 * eps) * rho,
                         real_type(1.00000001) * rho,
                         real_type(1.000001) * rho,
-                        1.5 * rho,
+                        real_type(1.5) * rho,
                         10 * rho,
                         100 * rho})
     {
@@ -298,7 +298,7 @@ TEST_F(PhysicsTrackViewHostTest, track_view)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
-TEST_F(PhysicsTrackViewHostTest, step_view)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE(step_view))
 {
     PhysicsStepView        gamma      = this->make_step_view(ThreadId{0});
     PhysicsStepView        celer      = this->make_step_view(ThreadId{1});
@@ -555,7 +555,7 @@ TEST_F(PhysicsTrackViewHostTest, model_finder)
     EXPECT_FALSE(find_model(MevEnergy{100.1}));
 }
 
-TEST_F(PhysicsTrackViewHostTest, element_selector)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE(element_selector))
 {
     MevEnergy  energy{2};
     MaterialId mid{2};
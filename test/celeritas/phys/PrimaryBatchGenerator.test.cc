@@ -0,0 +1,194 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/PrimaryBatchGenerator.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/PrimaryBatchGenerator.hh"
+
+#include <iostream>
+#include <random>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/phys/PrimaryGenerator.hh"
+
+#include "celeritas_test.hh"
+
+using std::cout;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class PrimaryBatchGeneratorTest : public Test
+{
+  protected:
+    using DS = DistributionSelection;
+
+    void SetUp() override
+    {
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleRecord::stable_decay_constant();
+
+        // Create particle defs
+        ParticleParams::Input defs{{"gamma", pdg::gamma(), zero, zero, stable},
+                                   {"electron",
+                                    pdg::electron(),
+                                    units::MevMass{0.5109989461},
+                                    units::ElementaryCharge{-1},
+                                    stable}};
+        particles_ = std::make_shared<ParticleParams>(std::move(defs));
+
+        opts_.pdg                 = {pdg::gamma(), pdg::electron()};
+        opts_.num_events          = 3;
+        opts_.primaries_per_event = 5;
+        opts_.energy              = {DS::delta, {10}};
+        opts_.position            = {DS::box, {-3, -2, -1, 1, 2, 3}};
+        opts_.direction           = {DS::isotropic, {}};
+    }
+
+    //! Generate primaries with the per-event generator
+    std::vector<Primary> generate_by_event()
+    {
+        std::mt19937 rng;
+        auto         generate_event
+            = PrimaryGenerator<std::mt19937>::from_options(particles_, opts_);
+        std::vector<Primary> result;
+        for (auto event = generate_event(rng); !event.empty();
+             event      = generate_event(rng))
+        {
+            result.insert(result.end(), event.begin(), event.end());
+        }
+        return result;
+    }
+
+    std::shared_ptr<ParticleParams> particles_;
+    PrimaryGeneratorOptions         opts_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(PrimaryBatchGeneratorTest, same_as_event)
+{
+    std::vector<Primary> expected = this->generate_by_event();
+    ASSERT_EQ(15, expected.size());
+
+    // Generate in chunks that don't line up with the events
+    std::vector<Primary> actual(expected.size() + 2);
+    std::vector<size_type> counts;
+    std::mt19937           rng;
+    visit_primary_batch_generator(
+        particles_, opts_, [&](auto& generate) {
+            EXPECT_EQ(15, generate.num_remaining());
+            Span<Primary> buffer = make_span(actual);
+            size_type     count;
+            do
+            {
+                count = generate(rng, buffer.first(std::min<size_type>(
+                                          4, buffer.size())));
+                counts.push_back(count);
+                buffer = buffer.subspan(count, buffer.size() - count);
+            } while (count > 0);
+            EXPECT_EQ(0, generate.num_remaining());
+        });
+
+    static const size_type expected_counts[] = {4, 4, 4, 3, 0};
+    EXPECT_VEC_EQ(expected_counts, counts);
+
+    for (auto i : range(expected.size()))
+    {
+        const Primary& e = expected[i];
+        const Primary& a = actual[i];
+        EXPECT_EQ(e.particle_id, a.particle_id) << "i=" << i;
+        EXPECT_EQ(e.energy.value(), a.energy.value()) << "i=" << i;
+        EXPECT_VEC_EQ(e.position, a.position) << "i=" << i;
+        EXPECT_VEC_EQ(e.direction, a.direction) << "i=" << i;
+        EXPECT_EQ(e.time, a.time) << "i=" << i;
+        EXPECT_EQ(e.event_id, a.event_id) << "i=" << i;
+        EXPECT_EQ(e.track_id, a.track_id) << "i=" << i;
+    }
+    // Remaining storage is untouched
+    EXPECT_FALSE(actual[15].event_id);
+    EXPECT_FALSE(actual[16].event_id);
+}
+
+TEST_F(PrimaryBatchGeneratorTest, delta)
+{
+    opts_.position  = {DS::delta, {1, 2, 3}};
+    opts_.direction = {DS::delta, {0, 0, 1}};
+
+    std::vector<Primary> primaries(4);
+    std::mt19937         rng;
+    visit_primary_batch_generator(particles_, opts_, [&](auto& generate) {
+        EXPECT_EQ(4, generate(rng, make_span(primaries)));
+    });
+
+    std::vector<int> particle_id;
+    std::vector<int> event_id;
+    std::vector<int> track_id;
+    for (const auto& p : primaries)
+    {
+        EXPECT_EQ(units::MevEnergy{10}, p.energy);
+        EXPECT_VEC_EQ(Real3({1, 2, 3}), p.position);
+        EXPECT_VEC_EQ(Real3({0, 0, 1}), p.direction);
+        particle_id.push_back(p.particle_id.unchecked_get());
+        event_id.push_back(p.event_id.unchecked_get());
+        track_id.push_back(p.track_id.unchecked_get());
+    }
+    static const int expected_particle_id[] = {0, 1, 0, 1};
+    static const int expected_event_id[]    = {0, 0, 0, 0};
+    static const int expected_track_id[]    = {0, 1, 2, 3};
+    EXPECT_VEC_EQ(expected_particle_id, particle_id);
+    EXPECT_VEC_EQ(expected_event_id, event_id);
+    EXPECT_VEC_EQ(expected_track_id, track_id);
+}
+
+TEST_F(PrimaryBatchGeneratorTest, benchmark)
+{
+    opts_.num_events          = 64;
+    opts_.primaries_per_event = 1024;
+    const size_type num_primaries
+        = opts_.num_events * opts_.primaries_per_event;
+
+    double event_time;
+    {
+        Stopwatch            get_time;
+        std::vector<Primary> primaries = this->generate_by_event();
+        event_time                     = get_time();
+        EXPECT_EQ(num_primaries, primaries.size());
+    }
+
+    double batch_time;
+    {
+        Stopwatch            get_time;
+        std::vector<Primary> primaries(num_primaries);
+        std::mt19937         rng;
+        visit_primary_batch_generator(
+            particles_, opts_, [&](auto& generate) {
+                EXPECT_EQ(num_primaries,
+                          generate(rng, make_span(primaries)));
+            });
+        batch_time = get_time();
+    }
+
+    cout << "Generated " << num_primaries << " primaries: "
+         << num_primaries / event_time << " per second by event, "
+         << num_primaries / batch_time << " per second in a batch"
+         << std::endl;
+    this->RecordProperty("event_primaries_per_sec",
+                         std::to_string(num_primaries / event_time));
+    this->RecordProperty("batch_primaries_per_sec",
+                         std::to_string(num_primaries / batch_time));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -19,7 +19,7 @@ namespace test
 {
 //---------------------------------------------------------------------------//
 
-TEST(BernoulliDistributionTest, single_constructor)
+TEST(BernoulliDistributionTest, TEST_IF_CELERITAS_DOUBLE(single_constructor))
 {
     std::mt19937          rng;
     BernoulliDistribution quarter_true(0.25);
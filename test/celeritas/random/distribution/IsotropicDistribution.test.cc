@@ -47,8 +47,8 @@ TEST(IsotropicDistributionTest, bin)
         double octant = static_cast<double>(count) / num_samples;
         EXPECT_SOFT_NEAR(octant, 1. / 8, 0.1);
     }
-    // 2 32-bit samples per double, 2 doubles per sample
-    EXPECT_EQ(num_samples * 4, rng.count());
+    // One 32-bit sample per float or two per double, 2 reals per sample
+    EXPECT_EQ(num_samples * 2 * sizeof(real_type) / 4, rng.count());
 }
 
 //---------------------------------------------------------------------------//
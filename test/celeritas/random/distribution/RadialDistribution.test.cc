@@ -37,9 +37,14 @@ TEST(RadialDistributionTest, bin)
         counters[int(r)] += 1;
     }
 
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     const int expected_counters[] = {80, 559, 1608, 2860, 4893};
+#else
+    const int expected_counters[] = {86, 540, 1550, 2892, 4932};
+#endif
     EXPECT_VEC_EQ(expected_counters, counters);
-    EXPECT_EQ(2 * num_samples, rng.count());
+    // One 32-bit sample per float, two per double
+    EXPECT_EQ(num_samples * sizeof(real_type) / 4, rng.count());
 }
 
 //---------------------------------------------------------------------------//
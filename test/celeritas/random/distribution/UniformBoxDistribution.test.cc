@@ -47,8 +47,8 @@ TEST(UniformBoxDistributionTest, all)
         double octant = static_cast<double>(count) / num_samples;
         EXPECT_SOFT_NEAR(octant, 1. / 8, 0.1);
     }
-    // 2 32-bit samples per double, 3 doubles per sample
-    EXPECT_EQ(num_samples * 6, rng.count());
+    // One 32-bit sample per float or two per double, 3 reals per sample
+    EXPECT_EQ(num_samples * 3 * sizeof(real_type) / 4, rng.count());
 }
 
 //---------------------------------------------------------------------------//
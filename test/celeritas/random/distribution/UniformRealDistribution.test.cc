@@ -44,7 +44,7 @@ TEST_F(UniformRealDistributionTest, constructors)
     }
 }
 
-TEST_F(UniformRealDistributionTest, bin)
+TEST_F(UniformRealDistributionTest, TEST_IF_CELERITAS_DOUBLE(bin))
 {
     int num_samples = 10000;
 
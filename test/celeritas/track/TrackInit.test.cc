@@ -17,6 +17,7 @@
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/track/TrackInitParams.hh"
 #include "celeritas/track/TrackInitUtils.hh"
+#include "celeritas/track/detail/TrackInitAlgorithms.hh"
 
 #include "celeritas_test.hh"
 
@@ -360,6 +361,81 @@ TEST_F(TrackInitSecondaryTest, secondaries)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST(TrackInitPolicyTest, reorder_host)
+{
+    struct Result
+    {
+        std::vector<int> track_ids;
+        std::vector<int> parents;
+    };
+
+    // Reorder six initializers to fill two vacancies; the last three were
+    // created in the previous step by the tracks in slots 1, 2, and 3
+    auto reorder = [](TrackInitPolicy policy) {
+        static const double    energy[] = {5, 1, 4, 2, 6, 3};
+        static const size_type event[]  = {0, 1, 0, 2, 1, 0};
+
+        std::vector<TrackInitializer> inits(6);
+        for (auto i : range(inits.size()))
+        {
+            inits[i].sim.track_id    = TrackId{i};
+            inits[i].sim.event_id    = EventId{event[i]};
+            inits[i].particle.energy = units::MevEnergy{energy[i]};
+        }
+        std::vector<ThreadId> parents
+            = {ThreadId{0}, ThreadId{1}, ThreadId{2}, ThreadId{3}};
+
+        std::vector<size_type>        scratch_indices(inits.size());
+        std::vector<TrackInitializer> scratch_inits(inits.size());
+        std::vector<ThreadId>         scratch_parents(inits.size());
+        detail::ReorderScratch        scratch{make_span(scratch_indices),
+                                       make_span(scratch_inits),
+                                       make_span(scratch_parents)};
+
+        size_type num_secondaries
+            = detail::reorder_initializers<MemSpace::host>(
+                policy, 2, make_span(inits), make_span(parents), 3, scratch);
+        EXPECT_EQ(2, num_secondaries);
+
+        Result result;
+        for (const auto& init : inits)
+        {
+            result.track_ids.push_back(init.sim.track_id.unchecked_get());
+        }
+        for (auto parent : parents)
+        {
+            result.parents.push_back(parent ? int(parent.get()) : -1);
+        }
+        return result;
+    };
+
+    {
+        // Oldest initializers are moved to the back
+        auto result = reorder(TrackInitPolicy::fifo);
+        static const int expected_track_ids[] = {2, 3, 4, 5, 0, 1};
+        static const int expected_parents[]   = {0, 1, -1, -1};
+        EXPECT_VEC_EQ(expected_track_ids, result.track_ids);
+        EXPECT_VEC_EQ(expected_parents, result.parents);
+    }
+    {
+        auto result = reorder(TrackInitPolicy::lowest_energy);
+        static const int expected_track_ids[] = {0, 2, 4, 5, 1, 3};
+        static const int expected_parents[]   = {0, 1, -1, 1};
+        EXPECT_VEC_EQ(expected_track_ids, result.track_ids);
+        EXPECT_VEC_EQ(expected_parents, result.parents);
+    }
+    {
+        // Ties within the first event go to the most recent initializers
+        auto result = reorder(TrackInitPolicy::event);
+        static const int expected_track_ids[] = {0, 1, 3, 4, 2, 5};
+        static const int expected_parents[]   = {0, 1, -1, 3};
+        EXPECT_VEC_EQ(expected_track_ids, result.track_ids);
+        EXPECT_VEC_EQ(expected_parents, result.parents);
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
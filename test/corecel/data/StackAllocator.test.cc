@@ -8,6 +8,7 @@
 #include "corecel/data/StackAllocator.hh"
 
 #include <cstdint>
+#include <vector>
 
 #include "corecel/data/CollectionStateStore.hh"
 
@@ -85,6 +86,93 @@ TEST_F(StackAllocatorTest, host)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(StackAllocatorTest, host_chunked)
+{
+    MockAllocatorData<Ownership::value, MemSpace::host> data;
+    resize(&data, 16, 4);
+    ASSERT_FALSE(data.chunks.empty());
+    MockAllocatorData<Ownership::reference, MemSpace::host> ref;
+    ref = data;
+    Allocator alloc(ref);
+    EXPECT_TRUE(alloc.chunked());
+
+    auto allocate = [&alloc](size_type count, int id) {
+        Span<MockSecondary> result;
+        if (MockSecondary* ptr = alloc(count))
+        {
+            result = {ptr, count};
+            for (MockSecondary& p : result)
+            {
+                EXPECT_EQ(-1, p.mock_id);
+                p.mock_id = id;
+            }
+        }
+        return result;
+    };
+    auto offset = [&ref](const Span<MockSecondary>& s) {
+        return s.data() - &ref.storage[ItemId<MockSecondary>{0}];
+    };
+
+    // First allocation reserves a full chunk
+    Span<MockSecondary> a = allocate(1, 0);
+    EXPECT_EQ(0, offset(a));
+    EXPECT_EQ(4, alloc.size());
+    Span<MockSecondary> b = allocate(2, 1);
+    EXPECT_EQ(1, offset(b));
+    EXPECT_EQ(4, alloc.size());
+
+    // Remainder of the chunk is abandoned
+    Span<MockSecondary> c = allocate(2, 2);
+    EXPECT_EQ(4, offset(c));
+    EXPECT_EQ(8, alloc.size());
+
+    // Allocations larger than a chunk reserve exactly
+    Span<MockSecondary> d = allocate(5, 3);
+    EXPECT_EQ(8, offset(d));
+    EXPECT_EQ(13, alloc.size());
+
+    // Near the end of the storage, a partial chunk can still be used
+    EXPECT_EQ(0, allocate(4, 4).size());
+    EXPECT_EQ(13, alloc.size());
+    Span<MockSecondary> e = allocate(3, 4);
+    EXPECT_EQ(13, offset(e));
+    EXPECT_EQ(16, alloc.size());
+
+    // Compact (given in arbitrary order)
+    Span<MockSecondary>* allocations[] = {&d, &b, &e, &a, &c};
+    alloc.compact(make_span(allocations));
+    EXPECT_EQ(13, alloc.size());
+
+    std::vector<int> offsets;
+    for (const auto* s : {&a, &b, &c, &d, &e})
+    {
+        offsets.push_back(offset(*s));
+    }
+    static const int expected_offsets[] = {0, 1, 3, 5, 10};
+    EXPECT_VEC_EQ(expected_offsets, offsets);
+
+    std::vector<int> ids;
+    for (const MockSecondary& p : alloc.get())
+    {
+        ids.push_back(p.mock_id);
+    }
+    static const int expected_ids[]
+        = {0, 1, 1, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4};
+    EXPECT_VEC_EQ(expected_ids, ids);
+
+    // Chunks are reset after compaction
+    Span<MockSecondary> f = allocate(1, 5);
+    EXPECT_EQ(13, offset(f));
+    EXPECT_EQ(14, alloc.size());
+
+    alloc.clear();
+    EXPECT_EQ(0, alloc.size());
+    EXPECT_EQ(0, offset(allocate(2, 6)));
+    EXPECT_EQ(4, alloc.size());
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(StackAllocatorTest, TEST_IF_CELER_DEVICE(device))
 {
     using StateStore
@@ -88,7 +88,7 @@ TEST(ArrayUtilsTest, is_soft_unit_vector)
     EXPECT_TRUE(is_soft_unit_vector(dir));
 }
 
-TEST(ArrayUtilsTest, rotate)
+TEST(ArrayUtilsTest, TEST_IF_CELERITAS_DOUBLE(rotate))
 {
     Real3 vec = {-1.1, 2.3, 0.9};
     normalize_direction(&vec);
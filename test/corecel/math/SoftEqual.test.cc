@@ -21,7 +21,7 @@ namespace test
 
 TEST(SoftEqual, default_precisions)
 {
-    using Comp_t = SoftEqual<>;
+    using Comp_t = SoftEqual<double>;
 
     EXPECT_DOUBLE_EQ(1e-12, Comp_t().rel());
     EXPECT_DOUBLE_EQ(1e-14, Comp_t().abs());
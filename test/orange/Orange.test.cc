@@ -6,8 +6,14 @@
 //! \file orange/Orange.test.cc
 //---------------------------------------------------------------------------//
 #include "orange/OrangeParams.hh"
+
+#include <cstdint>
+#include <fstream>
+
 #include "orange/OrangeTrackView.hh"
 #include "orange/construct/OrangeInput.hh"
+#include "orange/construct/SurfaceInputBuilder.hh"
+#include "orange/surf/PlaneAligned.hh"
 #include "celeritas/Constants.hh"
 
 #include "OrangeGeoTestBase.hh"
@@ -15,6 +21,21 @@
 
 using celeritas::constants::sqrt_two;
 
+// Distance-to-boundary requests are only tallied in debug mode
+#if CELERITAS_DEBUG
+#    define EXPECT_STEP_COUNTS(FIND, CACHED)              \
+        do                                                \
+        {                                                 \
+            EXPECT_EQ(FIND, this->find_step_count());     \
+            EXPECT_EQ(CACHED, this->cached_step_count()); \
+        } while (0)
+#else
+#    define EXPECT_STEP_COUNTS(FIND, CACHED) \
+        do                                   \
+        {                                    \
+        } while (0)
+#endif
+
 namespace celeritas
 {
 namespace test
@@ -38,6 +59,20 @@ class OrangeTest : public OrangeGeoTestBase
             this->params().host_ref(), host_state_.ref(), ThreadId{0});
     }
 
+#if CELERITAS_DEBUG
+    //! Number of distance-to-boundary requests for the host track
+    size_type find_step_count() const
+    {
+        return host_state_.ref().find_step_count[ThreadId{0}];
+    }
+
+    //! Number of requests satisfied by a previously calculated distance
+    size_type cached_step_count() const
+    {
+        return host_state_.ref().cached_step_count[ThreadId{0}];
+    }
+#endif
+
   private:
     using HostStateStore
         = CollectionStateStore<OrangeStateData, MemSpace::host>;
@@ -63,6 +98,44 @@ class TwoVolumeTest : public OrangeTest
     }
 };
 
+class CoincidentSlabsTest : public OrangeTest
+{
+    //! Two slabs whose shared face is defined separately for each
+    void SetUp() override
+    {
+        UnitInput input;
+        {
+            SurfaceInputBuilder insert(&input.surfaces);
+            insert(PlaneX(-2), "left.mx");
+            insert(PlaneX(0), "left.px");
+            insert(PlaneX(1e-12), "right.mx");
+            insert(PlaneX(2), "right.px");
+        }
+        {
+            VolumeInput vi;
+            vi.faces = {SurfaceId{0}, SurfaceId{3}};
+            vi.logic = {0, logic::lnot, 1, logic::lor};
+            vi.flags = VolumeInput::Flags::implicit_cell;
+            vi.label = "outside";
+            input.volumes.push_back(vi);
+
+            vi.flags = 0;
+            vi.logic = {0, 1, logic::lnot, logic::land};
+            vi.faces = {SurfaceId{0}, SurfaceId{1}};
+            vi.label = "left";
+            input.volumes.push_back(vi);
+
+            vi.faces = {SurfaceId{2}, SurfaceId{3}};
+            vi.label = "right";
+            input.volumes.push_back(vi);
+        }
+        input.bbox  = {{-2, -1, -1}, {2, 1, 1}};
+        input.label = "coincident slabs";
+
+        this->build_geometry(std::move(input));
+    }
+};
+
 #define FiveVolumesTest TEST_IF_CELERITAS_JSON(FiveVolumesTest)
 class FiveVolumesTest : public OrangeTest
 {
@@ -209,7 +282,7 @@ TEST_F(TwoVolumeTest, simple_track)
 
 // Leaving the volume almost at a tangent, but magnetic field changes direction
 // on boundary so it ends up heading back in
-TEST_F(TwoVolumeTest, reentrant_boundary_setdir)
+TEST_F(TwoVolumeTest, TEST_IF_CELERITAS_DOUBLE(reentrant_boundary_setdir))
 {
     auto geo = this->make_track_view();
     geo      = Initializer_t{{1.49, 0, 0}, {0, 1, 0}};
@@ -249,7 +322,7 @@ TEST_F(TwoVolumeTest, reentrant_boundary_setdir)
     }
 }
 
-TEST_F(TwoVolumeTest, nonreentrant_boundary_setdir)
+TEST_F(TwoVolumeTest, TEST_IF_CELERITAS_DOUBLE(nonreentrant_boundary_setdir))
 {
     auto geo = this->make_track_view();
     geo      = Initializer_t{{1.49, 0, 0}, {0, 1, 0}};
@@ -286,7 +359,8 @@ TEST_F(TwoVolumeTest, nonreentrant_boundary_setdir)
 // Leaving the voume almost at a tangent, but magnetic field changes direction
 // on boundary so it ends up heading back in, then MSC changes it back outward
 // again
-TEST_F(TwoVolumeTest, doubly_reentrant_boundary_setdir)
+TEST_F(TwoVolumeTest,
+       TEST_IF_CELERITAS_DOUBLE(doubly_reentrant_boundary_setdir))
 {
     auto geo = this->make_track_view();
     geo      = Initializer_t{{1.49, 0, 0}, {0, 1, 0}};
@@ -328,7 +402,7 @@ TEST_F(TwoVolumeTest, doubly_reentrant_boundary_setdir)
 
 // After leaving the volume almost at a tangent, change direction before moving
 // as part of the field propagation algorithm.
-TEST_F(TwoVolumeTest, reentrant_boundary_setdir_post)
+TEST_F(TwoVolumeTest, TEST_IF_CELERITAS_DOUBLE(reentrant_boundary_setdir_post))
 {
     auto geo = this->make_track_view();
     geo      = Initializer_t{{1.49, 0, 0}, {0, 1, 0}};
@@ -456,6 +530,7 @@ TEST_F(TwoVolumeTest, intersect_limited)
     next = geo.find_next_step(0.5);
     EXPECT_SOFT_EQ(0.5, next.distance);
     EXPECT_FALSE(next.boundary);
+    EXPECT_STEP_COUNTS(2, 1);
     if (CELERITAS_DEBUG)
     {
         EXPECT_THROW(geo.move_to_boundary(), DebugError);
@@ -493,6 +568,92 @@ TEST_F(TwoVolumeTest, intersect_limited)
     EXPECT_FALSE(next.boundary);
 }
 
+TEST_F(TwoVolumeTest, reuse_next_step)
+{
+    {
+        auto geo = this->make_track_view();
+        geo      = Initializer_t{{0.0, 0, 0}, {1, 0, 0}};
+        auto next = geo.find_next_step();
+        EXPECT_SOFT_EQ(1.5, next.distance);
+        EXPECT_TRUE(next.boundary);
+        geo.move_internal(0.5);
+    }
+    EXPECT_STEP_COUNTS(1, 0);
+    {
+        // Physics-limited step with a new view reuses the distance
+        auto geo  = this->make_track_view();
+        auto next = geo.find_next_step(0.25);
+        EXPECT_SOFT_EQ(0.25, next.distance);
+        EXPECT_FALSE(next.boundary);
+        geo.move_internal(0.25);
+    }
+    EXPECT_STEP_COUNTS(2, 1);
+    {
+        auto geo  = this->make_track_view();
+        auto next = geo.find_next_step(2.0);
+        EXPECT_SOFT_EQ(0.75, next.distance);
+        EXPECT_TRUE(next.boundary);
+    }
+    EXPECT_STEP_COUNTS(3, 2);
+    {
+        // Changing direction invalidates the distance
+        auto geo = this->make_track_view();
+        geo.set_dir({0, 1, 0});
+    }
+    {
+        auto geo  = this->make_track_view();
+        auto next = geo.find_next_step(0.25);
+        EXPECT_SOFT_EQ(0.25, next.distance);
+        EXPECT_FALSE(next.boundary);
+        EXPECT_STEP_COUNTS(4, 2);
+
+        // Limited search in a simple volume still saves the full distance
+        next = geo.find_next_step();
+        EXPECT_SOFT_EQ(1.299038105676658, next.distance);
+        EXPECT_TRUE(next.boundary);
+        geo.move_to_boundary();
+        geo.cross_boundary();
+        EXPECT_EQ(VolumeId{0}, geo.volume_id());
+    }
+    EXPECT_STEP_COUNTS(5, 3);
+    {
+        // Crossing a boundary invalidates the distance
+        auto geo  = this->make_track_view();
+        auto next = geo.find_next_step(1.0);
+        EXPECT_SOFT_EQ(1.0, next.distance);
+        EXPECT_FALSE(next.boundary);
+    }
+    EXPECT_STEP_COUNTS(6, 3);
+}
+
+TEST_F(CoincidentSlabsTest, track)
+{
+    const OrangeParams& params = this->params();
+    EXPECT_EQ(3, params.num_volumes());
+    EXPECT_EQ(3, params.num_surfaces());
+    EXPECT_EQ(SurfaceId{1}, params.find_surface("left.px"));
+    EXPECT_EQ(SurfaceId{}, params.find_surface("right.mx"));
+
+    auto geo = this->make_track_view();
+    geo      = Initializer_t{{-1, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ("left", params.id_to_label(geo.volume_id()).name);
+
+    // Cross the merged surface into the adjacent slab
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(1, next.distance);
+    EXPECT_TRUE(next.boundary);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_EQ("right", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ(SurfaceId{1}, geo.surface_id());
+
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(2, next.distance);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_TRUE(geo.is_outside());
+}
+
 TEST_F(FiveVolumesTest, params)
 {
     const OrangeParams& geo = this->params();
@@ -512,6 +673,69 @@ TEST_F(Geant4Testem15Test, params)
     EXPECT_FALSE(geo.supports_safety());
 }
 
+TEST_F(Geant4Testem15Test, binary)
+{
+    const OrangeParams& orig = this->params();
+    std::string         filename = this->make_unique_filename(".org.bin");
+    orig.write_binary(filename);
+
+    OrangeParams geo(filename);
+    EXPECT_EQ(orig.num_volumes(), geo.num_volumes());
+    EXPECT_EQ(orig.num_surfaces(), geo.num_surfaces());
+    EXPECT_EQ(orig.supports_safety(), geo.supports_safety());
+    EXPECT_VEC_SOFT_EQ(orig.bbox().lower(), geo.bbox().lower());
+    EXPECT_VEC_SOFT_EQ(orig.bbox().upper(), geo.bbox().upper());
+    for (auto vid : range(VolumeId{geo.num_volumes()}))
+    {
+        EXPECT_EQ(orig.id_to_label(vid), geo.id_to_label(vid));
+    }
+    for (auto sid : range(SurfaceId{geo.num_surfaces()}))
+    {
+        EXPECT_EQ(orig.id_to_label(sid), geo.id_to_label(sid));
+    }
+    EXPECT_EQ(VolumeId{1}, geo.find_volume("box"));
+
+    // Reloaded data should be identical
+    const auto& orig_ref = orig.host_ref();
+    const auto& ref      = geo.host_ref();
+    EXPECT_EQ(orig_ref.scalars.max_faces, ref.scalars.max_faces);
+    EXPECT_EQ(orig_ref.scalars.max_surfaces, ref.scalars.max_surfaces);
+    EXPECT_EQ(orig_ref.scalars.max_intersections,
+              ref.scalars.max_intersections);
+    EXPECT_VEC_EQ(orig_ref.reals[AllItems<real_type>{}],
+                  ref.reals[AllItems<real_type>{}]);
+    EXPECT_VEC_EQ(orig_ref.logic_ints[AllItems<logic_int>{}],
+                  ref.logic_ints[AllItems<logic_int>{}]);
+
+    // Track through the reloaded geometry
+    CollectionStateStore<OrangeStateData, MemSpace::host> state(ref, 1);
+    OrangeTrackView track(ref, state.ref(), ThreadId{0});
+    track = Initializer_t{{0, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ(VolumeId{1}, track.volume_id());
+    EXPECT_SOFT_EQ(5000.0, track.find_safety());
+    auto next = track.find_next_step();
+    EXPECT_SOFT_EQ(5000.0, next.distance);
+    EXPECT_TRUE(next.boundary);
+}
+
+TEST_F(Geant4Testem15Test, binary_version)
+{
+    std::string filename = this->make_unique_filename(".org.bin");
+    this->params().write_binary(filename);
+
+    // Overwrite the format version that follows the magic bytes
+    {
+        std::fstream f(filename,
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(8);
+        std::uint32_t old_version = 1;
+        f.write(reinterpret_cast<const char*>(&old_version),
+                sizeof(old_version));
+        ASSERT_TRUE(f);
+    }
+    EXPECT_THROW(OrangeParams{filename}, RuntimeError);
+}
+
 TEST_F(Geant4Testem15Test, safety)
 {
     OrangeTrackView geo = this->make_track_view();
@@ -0,0 +1,213 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SurfaceDeduplicator.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/SurfaceDeduplicator.hh"
+
+#include "orange/construct/OrangeInput.hh"
+#include "orange/construct/SurfaceInputBuilder.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SphereCentered.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SurfaceDeduplicatorTest : public ::celeritas::test::Test
+{
+  protected:
+    static std::vector<size_type> get_faces(const VolumeInput& v)
+    {
+        std::vector<size_type> result;
+        for (SurfaceId f : v.faces)
+        {
+            result.push_back(f.unchecked_get());
+        }
+        return result;
+    }
+
+    static std::vector<std::string> get_labels(const SurfaceInput& s)
+    {
+        std::vector<std::string> result;
+        for (const Label& l : s.labels)
+        {
+            result.push_back(l.name);
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SurfaceDeduplicatorTest, planes)
+{
+    UnitInput unit;
+    {
+        SurfaceInputBuilder insert(&unit.surfaces);
+        insert(PlaneX(-2), "left.mx");
+        insert(PlaneX(0), "left.px");
+        insert(PlaneX(1e-12), "right.mx");
+        insert(PlaneY(0), "py");
+        insert(PlaneX(2), "right.px");
+        insert(PlaneX(-1e-13), "mid");
+    }
+    {
+        VolumeInput v;
+        v.label = "left";
+        v.faces = {SurfaceId{0}, SurfaceId{1}};
+        v.logic = {0, 1, logic::lnot, logic::land};
+        unit.volumes.push_back(v);
+
+        v.label = "right";
+        v.faces = {SurfaceId{2}, SurfaceId{3}, SurfaceId{4}};
+        v.logic = {0, 1, logic::land, 2, logic::lnot, logic::land};
+        unit.volumes.push_back(v);
+
+        // Degenerate volume using two coincident faces
+        v.label = "mid";
+        v.faces = {SurfaceId{1}, SurfaceId{5}};
+        v.logic = {0, 1, logic::lnot, logic::land};
+        unit.volumes.push_back(v);
+    }
+
+    SurfaceDeduplicator merge_surfaces(1e-8);
+    EXPECT_EQ(2, merge_surfaces(&unit));
+
+    const SurfaceInput& surfaces = unit.surfaces;
+    ASSERT_EQ(4, surfaces.size());
+    static const std::string expected_labels[]
+        = {"left.mx", "left.px", "py", "right.px"};
+    EXPECT_VEC_EQ(expected_labels, get_labels(surfaces));
+    static const real_type expected_data[] = {-2, 0, 0, 2};
+    EXPECT_VEC_SOFT_EQ(expected_data, surfaces.data);
+
+    static const size_type expected_left_faces[] = {0, 1};
+    EXPECT_VEC_EQ(expected_left_faces, get_faces(unit.volumes[0]));
+    static const logic_int expected_left_logic[]
+        = {0, 1, logic::lnot, logic::land};
+    EXPECT_VEC_EQ(expected_left_logic, unit.volumes[0].logic);
+
+    static const size_type expected_right_faces[] = {1, 2, 3};
+    EXPECT_VEC_EQ(expected_right_faces, get_faces(unit.volumes[1]));
+    static const logic_int expected_right_logic[]
+        = {0, 1, logic::land, 2, logic::lnot, logic::land};
+    EXPECT_VEC_EQ(expected_right_logic, unit.volumes[1].logic);
+
+    static const size_type expected_mid_faces[] = {1};
+    EXPECT_VEC_EQ(expected_mid_faces, get_faces(unit.volumes[2]));
+    static const logic_int expected_mid_logic[]
+        = {0, 0, logic::lnot, logic::land};
+    EXPECT_VEC_EQ(expected_mid_logic, unit.volumes[2].logic);
+}
+
+TEST_F(SurfaceDeduplicatorTest, quadrics)
+{
+    UnitInput unit;
+    {
+        // Unit sphere defined as a quadric with two different scales, and
+        // with a flipped sign; plus a plane
+        SurfaceInputBuilder insert(&unit.surfaces);
+        insert(GeneralQuadric({2, 2, 2}, {0, 0, 0}, {0, 0, 0}, -2), "gq");
+        insert(GeneralQuadric({-1, -1, -1}, {0, 0, 0}, {0, 0, 0}, 1), "neg");
+        insert(PlaneZ(0), "pz");
+        insert(GeneralQuadric({0.5, 0.5, 0.5}, {0, 0, 0}, {0, 0, 0}, -0.5),
+               "half");
+    }
+    {
+        VolumeInput v;
+        v.label = "inside";
+        v.faces = {SurfaceId{0}};
+        v.logic = {0, logic::lnot};
+        unit.volumes.push_back(v);
+
+        v.label = "inside-neg";
+        v.faces = {SurfaceId{1}, SurfaceId{2}};
+        v.logic = {0, 1, logic::land};
+        unit.volumes.push_back(v);
+
+        v.label = "outside-neg";
+        v.faces = {SurfaceId{1}};
+        v.logic = {0, logic::lnot};
+        unit.volumes.push_back(v);
+
+        v.label = "outside-half";
+        v.faces = {SurfaceId{3}};
+        v.logic = {0};
+        unit.volumes.push_back(v);
+    }
+
+    SurfaceDeduplicator merge_surfaces(1e-8);
+    EXPECT_EQ(2, merge_surfaces(&unit));
+
+    const SurfaceInput& surfaces = unit.surfaces;
+    ASSERT_EQ(2, surfaces.size());
+    static const std::string expected_labels[] = {"gq", "pz"};
+    EXPECT_VEC_EQ(expected_labels, get_labels(surfaces));
+    static const real_type expected_data[]
+        = {1, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0};
+    EXPECT_VEC_SOFT_EQ(expected_data, surfaces.data);
+
+    static const logic_int expected_inside_logic[] = {0, logic::lnot};
+    EXPECT_VEC_EQ(expected_inside_logic, unit.volumes[0].logic);
+
+    // Flipped quadric is negated
+    static const size_type expected_neg_faces[] = {0, 1};
+    EXPECT_VEC_EQ(expected_neg_faces, get_faces(unit.volumes[1]));
+    static const logic_int expected_neg_logic[]
+        = {0, logic::lnot, 1, logic::land};
+    EXPECT_VEC_EQ(expected_neg_logic, unit.volumes[1].logic);
+
+    // Double negation is removed
+    static const logic_int expected_outside_logic[] = {0};
+    EXPECT_VEC_EQ(expected_outside_logic, unit.volumes[2].logic);
+    EXPECT_VEC_EQ(expected_outside_logic, unit.volumes[3].logic);
+}
+
+TEST_F(SurfaceDeduplicatorTest, unique)
+{
+    UnitInput unit;
+    {
+        SurfaceInputBuilder insert(&unit.surfaces);
+        insert(PlaneX(1), "a");
+        insert(PlaneX(1 + 1e-6), "b");
+        insert(CCylZ(1), "c");
+        insert(SphereCentered(1), "d");
+    }
+    {
+        VolumeInput v;
+        v.faces = {SurfaceId{0}, SurfaceId{1}, SurfaceId{2}, SurfaceId{3}};
+        v.logic = {0, 1, logic::land, 2, logic::land, 3, logic::land};
+        unit.volumes.push_back(v);
+    }
+    const auto orig_volume = unit.volumes.front();
+
+    SurfaceDeduplicator merge_surfaces(1e-8);
+    EXPECT_EQ(0, merge_surfaces(&unit));
+    EXPECT_EQ(4, unit.surfaces.size());
+    EXPECT_EQ(orig_volume.faces, unit.volumes.front().faces);
+    EXPECT_VEC_EQ(orig_volume.logic, unit.volumes.front().logic);
+
+    // Larger tolerance merges the nearby planes
+    EXPECT_EQ(1, SurfaceDeduplicator(1e-4)(&unit));
+    EXPECT_EQ(3, unit.surfaces.size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace detail
+} // namespace celeritas
@@ -57,9 +57,14 @@ TEST(GeneralQuadricTest, all)
     EXPECT_SOFT_EQ(6.0, distances[0]);
     EXPECT_SOFT_EQ(no_intersection(), distances[1]);
 
-    // "Not on surface", inward
+    // "Not on surface", inward: roundoff puts the point just outside the
+    // surface in double precision and just inside in single precision
     distances = gq.calc_intersections(on_surface, inward, SurfaceState::off);
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_SOFT_EQ(1e-16, distances[0]);
+#else
+    EXPECT_SOFT_EQ(no_intersection(), distances[0]);
+#endif
     EXPECT_SOFT_EQ(6.0, distances[1]);
 
     // On surface, outward
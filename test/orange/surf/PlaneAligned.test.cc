@@ -36,7 +36,7 @@ class PlaneAlignedTest : public Test
                                 Real3        dir,
                                 SurfaceState s = SurfaceState::off)
     {
-        static_assert(sizeof(typename S::Intersections) == sizeof(double),
+        static_assert(sizeof(typename S::Intersections) == sizeof(real_type),
                       "Expected plane to have a single intercept");
         return surf.calc_intersections(pos, dir, s)[0];
     }
@@ -48,9 +48,14 @@ TEST(SphereCenteredTest, all)
     EXPECT_SOFT_EQ(2 * radius, distances[0]);
     EXPECT_SOFT_EQ(no_intersection(), distances[1]);
 
-    // "Not on surface", inward
+    // "Not on surface", inward: roundoff puts the point just outside the
+    // surface in double precision and just inside in single precision
     distances = s.calc_intersections(on_surface, inward, SurfaceState::off);
+#if CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
     EXPECT_SOFT_EQ(1e-16, distances[0]);
+#else
+    EXPECT_SOFT_EQ(no_intersection(), distances[0]);
+#endif
     EXPECT_SOFT_EQ(2 * radius, distances[1]);
 
     // On surface, outward
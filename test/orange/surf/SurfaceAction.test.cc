@@ -177,12 +177,14 @@ TEST_F(SurfaceActionTest, string)
         "Cyl y: r=6",
         "Cyl z: r=7",
         "Sphere: r=1.5 at {1,2,3}",
-        "GQuadric: {0,1,2} {3,4,5} {6,7,8} 9"};
+        // Quadric coefficients are normalized during construction
+        "GQuadric: {0,0.111111,0.222222} {0.333333,0.444444,0.555556} "
+        "{0.666667,0.777778,0.888889} 1"};
     // clang-format on
     EXPECT_VEC_EQ(expected_strings, strings);
 }
 
-TEST_F(SurfaceActionTest, host_distances)
+TEST_F(SurfaceActionTest, TEST_IF_CELERITAS_DOUBLE(host_distances))
 {
     const auto& host_ref = this->params().host_ref();
 
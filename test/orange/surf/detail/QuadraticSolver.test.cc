@@ -150,7 +150,7 @@ TEST(SolveGeneral, no_roots)
     EXPECT_SOFT_EQ(no_intersection(), x[1]);
 }
 
-TEST(SolveGeneral, one_root)
+TEST(SolveGeneral, TEST_IF_CELERITAS_DOUBLE(one_root))
 {
     // 1.0e-15*x^2 + 2*x - 2000 = 0 -> x = 1e3
     double a   = 1e-15;
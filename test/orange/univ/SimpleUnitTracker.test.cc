@@ -125,6 +125,7 @@ LocalState SimpleUnitTrackerTest::make_state(Real3 pos, Real3 dir)
     const auto& hsref        = this->host_state();
     auto        face_storage = hsref.temp_face[AllItems<FaceId>{}];
     state.temp_sense         = hsref.temp_sense[AllItems<Sense>{}];
+    state.temp_surf_sense    = hsref.temp_surf_sense[AllItems<SenseMemo>{}];
     state.temp_next.face     = face_storage.data();
     state.temp_next.distance
         = hsref.temp_distance[AllItems<real_type>{}].data();
@@ -587,7 +588,7 @@ TEST_F(TwoVolumeTest, normal)
     }
 }
 
-TEST_F(TwoVolumeTest, heuristic_init)
+TEST_F(TwoVolumeTest, TEST_IF_CELERITAS_DOUBLE(heuristic_init))
 {
     size_type num_tracks = 1024;
 
@@ -784,7 +785,7 @@ TEST_F(FiveVolumesTest, safety)
     EXPECT_SOFT_EQ(0.5, tracker.safety({-5, 20, 0}, d));
 }
 
-TEST_F(FiveVolumesTest, heuristic_init)
+TEST_F(FiveVolumesTest, TEST_IF_CELERITAS_DOUBLE(heuristic_init))
 {
     size_type num_tracks = 10000;
 
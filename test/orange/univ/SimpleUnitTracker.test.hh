@@ -51,6 +51,10 @@ inline CELER_FUNCTION LocalState build_local_state(ParamsRef<M> params,
     const size_type max_faces = params.scalars.max_faces;
     lstate.temp_sense = states.temp_sense[build_range<Sense>(max_faces, tid)];
 
+    const size_type max_surfaces = params.scalars.max_surfaces;
+    lstate.temp_surf_sense
+        = states.temp_surf_sense[build_range<SenseMemo>(max_surfaces, tid)];
+
     const size_type max_isect = params.scalars.max_intersections;
     lstate.temp_next.face
         = states.temp_face[build_range<FaceId>(max_isect, tid)].data();
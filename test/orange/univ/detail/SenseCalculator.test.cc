@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "orange/univ/detail/SenseCalculator.hh"
 
+#include <algorithm>
+
 #include "orange/OrangeGeoTestBase.hh"
 #include "orange/surf/Surfaces.hh"
 #include "orange/univ/VolumeView.hh"
@@ -69,6 +71,12 @@ class SenseCalculatorTest : public ::celeritas::test::OrangeGeoTestBase
     {
         return this->host_state().temp_sense[AllItems<Sense>{}];
     }
+
+    //! Access the shared CPU storage space for memoized surface senses
+    Span<SenseMemo> memo_storage()
+    {
+        return this->host_state().temp_surf_sense[AllItems<SenseMemo>{}];
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -271,6 +279,76 @@ TEST_F(SenseCalculatorTest, five_volumes)
         }
     }
 }
+
+TEST_F(SenseCalculatorTest, five_volumes_memo)
+{
+    if (!CELERITAS_USE_JSON)
+    {
+        GTEST_SKIP() << "JSON is not enabled";
+    }
+
+    this->build_geometry("five-volumes.org.json");
+
+    VolumeView vol_b = this->make_volume_view(VolumeId{2});
+    VolumeView vol_c = this->make_volume_view(VolumeId{3});
+    VolumeView vol_e = this->make_volume_view(VolumeId{5});
+
+    Span<SenseMemo> memo = this->memo_storage();
+    ASSERT_EQ(this->make_surfaces().num_surfaces(), memo.size());
+    auto count_known = [&memo] {
+        return std::count_if(memo.begin(), memo.end(), [](SenseMemo m) {
+            return m != SenseMemo::unknown;
+        });
+    };
+    EXPECT_EQ(0, count_known());
+
+    // Point is between spheres, on square edge (surface 8)
+    SenseCalculator calc_senses(this->make_surfaces(),
+                                Real3{0.5, -0.25, 0},
+                                this->sense_storage(),
+                                memo);
+    {
+        auto result = calc_senses(vol_e);
+        EXPECT_EQ("{+}", senses_to_string(result.senses));
+        EXPECT_FALSE(result.face);
+    }
+    EXPECT_EQ(1, count_known());
+    {
+        // Inner sphere is shared with volume E
+        auto result = calc_senses(vol_c);
+        EXPECT_EQ("{- +}", senses_to_string(result.senses));
+    }
+    EXPECT_EQ(2, count_known());
+    {
+        // Memoized "on" state should still be reported
+        auto result = calc_senses(vol_b);
+        EXPECT_EQ("{- + - - + - +}", senses_to_string(result.senses));
+        EXPECT_EQ(FaceId{4}, result.face.id());
+        EXPECT_EQ(Sense::outside, result.face.sense());
+        EXPECT_EQ(SenseMemo::on,
+                  memo[vol_b.get_surface(FaceId{4}).unchecked_get()]);
+    }
+    {
+        // Repeated evaluation uses the memo and gives the same result
+        auto result = calc_senses(vol_b, OnFace{FaceId{4}, Sense::inside});
+        EXPECT_EQ("{- + - - - - +}", senses_to_string(result.senses));
+        EXPECT_EQ(FaceId{4}, result.face.id());
+    }
+
+    // Clear the faces of the tested volumes
+    calc_senses.clear_memo(vol_e);
+    calc_senses.clear_memo(vol_c);
+    EXPECT_NE(0, count_known());
+    calc_senses.clear_memo(vol_b);
+    EXPECT_EQ(0, count_known());
+
+    // Clear the whole memo
+    calc_senses(vol_b);
+    EXPECT_NE(0, count_known());
+    calc_senses.clear_memo();
+    EXPECT_EQ(0, count_known());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace detail
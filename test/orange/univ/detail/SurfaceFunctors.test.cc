@@ -119,7 +119,7 @@ TEST_F(SurfaceFunctorsTest, calc_normal)
 
 //---------------------------------------------------------------------------//
 
-TEST_F(SurfaceFunctorsTest, calc_safety_distance)
+TEST_F(SurfaceFunctorsTest, TEST_IF_CELERITAS_DOUBLE(calc_safety_distance))
 {
     Real3 pos;
 